@@ -0,0 +1,82 @@
+// Copyright (c) 2026  agent <agent@local>.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s) : agent <agent@local>
+//
+
+#ifndef CGAL_AABB_TRAITS_WITH_COMPACT_NODES_H
+#define CGAL_AABB_TRAITS_WITH_COMPACT_NODES_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <CGAL/disable_warnings.h>
+
+#include <cstdint>
+#include <type_traits>
+
+/// \file AABB_traits_with_compact_nodes.h
+
+namespace CGAL {
+
+/// \addtogroup PkgAABBTreeRef
+/// @{
+
+/// This traits class is a model of `AABBTraits` that behaves exactly as `AABBTraits`,
+/// except that an `AABB_tree` using it stores its nodes in a compact form.
+///
+/// The nodes are stored in a single array, in depth-first order. Each node stores
+/// the bounding boxes of its two children and two 32-bit indices of either nodes or primitives,
+/// so that the two boxes tested when visiting a node are read from the same cache line.
+/// The boxes are stored with a reduced precision, and are rounded outwards so that they
+/// always contain the primitives of the node: queries return the same results as with `AABBTraits`,
+/// at the price of a few more box tests.
+///
+/// \tparam AABBTraits must be a model of `AABBTraits`, such as `AABB_traits`.
+/// \tparam BoxCoordinate the type used to store the coordinates of the boxes.
+///         It must be either `float`, for boxes in single precision (56 bytes per node),
+///         or `std::uint16_t`, for boxes quantized on 16 bits relative to the box of their parent
+///         (32 bytes per node). In comparison, the default nodes of `AABB_tree` take 64 bytes.
+///
+/// \cgalModels AABBTraits
+///
+/// \note The member function `AABB_tree::root_node()` and the traversal traits written
+///       for `AABB_node` are not available with this traits class. Custom traversal
+///       traits must accept as node any type with a member function `bbox()`.
+///
+/// \sa `AABB_traits`
+/// \sa `AABB_tree`
+template <typename AABBTraits, typename BoxCoordinate = float>
+class AABB_traits_with_compact_nodes
+  : public AABBTraits
+{
+  static_assert(std::is_same<BoxCoordinate, float>::value ||
+                std::is_same<BoxCoordinate, std::uint16_t>::value,
+                "BoxCoordinate must be float or std::uint16_t");
+
+public:
+  /// the type used to store the coordinates of the boxes of the nodes.
+  typedef BoxCoordinate Compact_box_coordinate;
+
+  /// Default constructor.
+  AABB_traits_with_compact_nodes() { }
+
+  /// constructs the traits class from a traits class of the underlying type.
+  AABB_traits_with_compact_nodes(const AABBTraits& traits)
+    : AABBTraits(traits)
+  { }
+};
+
+/// @}
+
+} // end namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif // CGAL_AABB_TRAITS_WITH_COMPACT_NODES_H
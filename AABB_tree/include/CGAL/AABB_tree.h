@@ -21,8 +21,10 @@
 
 #include <vector>
 #include <iterator>
+#include <limits>
 #include <CGAL/AABB_tree/internal/AABB_traversal_traits.h>
 #include <CGAL/AABB_tree/internal/AABB_node.h>
+#include <CGAL/AABB_tree/internal/AABB_compact_nodes.h>
 #include <CGAL/AABB_tree/internal/AABB_search_tree.h>
 #include <CGAL/AABB_tree/internal/Has_nested_type_Shared_data.h>
 #include <CGAL/AABB_tree/internal/Primitive_helper.h>
@@ -33,6 +35,10 @@
 #include <CGAL/mutex.h>
 #endif
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_invoke.h>
+#endif
+
 /// \file AABB_tree.h
 
 namespace CGAL {
@@ -66,6 +72,10 @@ namespace CGAL {
     typedef internal::Primitive_helper<AABBTraits> Helper;
     typedef AABB_tree<AABBTraits> Self;
 
+    // storage of the nodes if the traits request compact nodes
+    typedef typename internal::AABB_tree::Compact_nodes_selector<AABBTraits>::type Compact_nodes;
+    typedef Boolean_tag<internal::AABB_tree::Has_nested_type_Compact_box_coordinate<AABBTraits>::value> Use_compact_nodes;
+
   public:
     typedef AABBTraits AABB_traits;
 
@@ -147,6 +157,49 @@ namespace CGAL {
     /// primitives of the tree.
     template<typename ... T>
     void build(T&& ...);
+
+    /// is the same as `build(t...)`, except that the two subtrees of each node
+    /// holding many primitives are constructed in parallel if `ConcurrencyTag` is `Parallel_tag`.
+    /// The constructed tree is identical to the one obtained with `Sequential_tag`.
+    /// \tparam ConcurrencyTag enables sequential versus parallel construction.
+    /// Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    /// \note The functors `Compute_bbox` and `Split_primitives` of the traits class must be
+    ///       safe to be called concurrently on disjoint ranges of primitives.
+    template<typename ConcurrencyTag, typename ... T>
+    void build(T&& ... t);
+
+    /// updates the tree after the geometry of its primitives has changed, the set of
+    /// primitives being unchanged (e.g. after moving the vertices of a mesh with a fixed connectivity).
+    /// The structure of the tree is kept and the bounding boxes of the nodes are recomputed bottom-up,
+    /// which has a complexity of \f$O(n)\f$ instead of the \f$O(n \log n)\f$ of `build()`.
+    ///
+    /// As the primitives move, the boxes of sibling nodes may overlap more and more, which
+    /// slows down the queries. To limit this, the subtrees whose quality has degraded too much
+    /// since the last construction of the tree are rebuilt. The quality of a node is measured by the ratio
+    /// between the areas of the boxes of its children, weighted by their numbers of primitives, and the area of its box.
+    /// The subtree of a node is rebuilt if this ratio has increased by a factor larger than `rebuild_threshold`
+    /// (a value such as `1.2` is reasonable). By default, no subtree is rebuilt.
+    /// The ratio of a node whose children have flat boxes (e.g. collinear primitives) is zero, and
+    /// would increase by an infinite factor after any deformation: the ratios at construction
+    /// that are smaller than the mean ratio of the tree are replaced by this mean.
+    /// If the tree needs to be built (e.g. after a call to `insert()`), it is built instead.
+    ///
+    /// The internal search tree used to accelerate the distance queries is cleared, and will be
+    /// rebuilt by the next distance query, unless `do_not_accelerate_distance_queries()` was called,
+    /// or a point set was given to `accelerate_distance_queries()`, in which case the user is responsible
+    /// for updating it.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel update of the tree.
+    /// Possible values are `Sequential_tag` (the default), `Parallel_tag`, and `Parallel_if_available_tag`.
+    ///
+    /// \returns the number of subtrees that have been rebuilt.
+    ///
+    /// \note The primitives must not store their datum (see the template parameter `CacheDatum`
+    ///       of the primitive classes), as the stored datum would not be updated.
+    /// \note Subtrees are never rebuilt if `AABBTraits` requests compact nodes
+    ///       (see `AABB_traits_with_compact_nodes`): only the boxes are updated.
+    template<typename ConcurrencyTag = Sequential_tag>
+    std::size_t refit(const double rebuild_threshold = (std::numeric_limits<double>::max)());
 #ifndef DOXYGEN_RUNNING
     void build();
 
@@ -156,6 +209,10 @@ namespace CGAL {
     template <class ComputeBbox, class SplitPrimitives>
     void custom_build(const ComputeBbox& compute_bbox,
                       const SplitPrimitives& split_primitives);
+
+    template <class ConcurrencyTag, class ComputeBbox, class SplitPrimitives>
+    void custom_build(const ComputeBbox& compute_bbox,
+                      const SplitPrimitives& split_primitives);
 #endif
     ///@}
 
@@ -205,7 +262,7 @@ namespace CGAL {
     const Bounding_box bbox() const {
       CGAL_precondition(!empty());
       if(size() > 1)
-        return root_node()->bbox();
+        return root_bbox(Use_compact_nodes());
       else
         return traits().compute_bbox_object()(m_primitives.begin(),
                       m_primitives.end());
@@ -230,6 +287,13 @@ namespace CGAL {
       set_primitive_data_impl(CGAL::Boolean_tag<internal::Has_nested_type_Shared_data<Primitive>::value>(),std::forward<T>(t)...);
     }
 
+    // as with `build()`, the shared data is kept if no argument is given
+    void set_shared_data_if_any(){}
+    template <typename ... T>
+    void set_shared_data_if_any(T&& ...t){
+      set_shared_data(std::forward<T>(t)...);
+    }
+
     bool build_kd_tree();
     template<typename ConstPointIterator>
     bool build_kd_tree(ConstPointIterator first, ConstPointIterator beyond);
@@ -354,6 +418,19 @@ public:
       return first_intersected_primitive(query, boost::lambda::constant(false));
     }
     /// \endcond
+
+    /// puts in `out`, for each ray of `rays` and in the same order, the result of `first_intersection()`
+    /// for this ray, as an object of type `boost::optional<Intersection_and_primitive_id<Ray>::%Type>`.
+    /// The rays are traversed by packets sharing the same node visits, which is efficient
+    /// when consecutive rays are coherent (e.g. similar sources and directions).
+    /// \tparam ConcurrencyTag enables sequential versus parallel processing of the packets.
+    /// Possible values are `Sequential_tag` (the default), `Parallel_tag`, and `Parallel_if_available_tag`.
+    /// \tparam RayRange a model of `ConstRange` with value type `AABBTraits::Ray_3`.
+    ///
+    /// `AABBTraits` must be a model of `AABBRayIntersectionTraits` to
+    /// call this member function.
+    template<typename ConcurrencyTag = Sequential_tag, typename RayRange, typename OutputIterator>
+    OutputIterator first_intersections(const RayRange& rays, OutputIterator out) const;
     ///@}
 
     /// \name Distance Queries
@@ -378,6 +455,22 @@ public:
     /// \pre `!empty()`
     Point_and_primitive_id closest_point_and_primitive(const Point& query) const;
 
+    /// puts in `out`, for each point of `points` and in the same order, the result of `closest_point()`
+    /// for this point. The points are traversed by packets sharing the same node visits,
+    /// which is efficient when consecutive points are close to each other.
+    /// \tparam ConcurrencyTag enables sequential versus parallel processing of the packets.
+    /// Possible values are `Sequential_tag` (the default), `Parallel_tag`, and `Parallel_if_available_tag`.
+    /// \tparam PointRange a model of `ConstRange` with value type `Point`.
+    /// \pre `!empty()`
+    template<typename ConcurrencyTag = Sequential_tag, typename PointRange, typename OutputIterator>
+    OutputIterator closest_points(const PointRange& points, OutputIterator out) const;
+
+    /// is the same as `closest_points()`, but puts in `out` the results of
+    /// `closest_point_and_primitive()`, as objects of type `Point_and_primitive_id`.
+    /// \pre `!empty()`
+    template<typename ConcurrencyTag = Sequential_tag, typename PointRange, typename OutputIterator>
+    OutputIterator closest_points_and_primitives(const PointRange& points, OutputIterator out) const;
+
 
     ///@}
 
@@ -488,6 +581,39 @@ public:
     void clear_nodes()
     {
       m_nodes.clear();
+      m_compact_nodes.clear();
+      m_reference_split_costs.clear();
+    }
+
+    const Bounding_box& root_bbox(Tag_false) const { return root_node()->bbox(); }
+    const Bounding_box& root_bbox(Tag_true) const
+    {
+      build_if_needed();
+      return m_compact_nodes.root_bbox();
+    }
+
+    template <class ConcurrencyTag, class ComputeBbox, class SplitPrimitives>
+    void build_nodes(const ComputeBbox& compute_bbox,
+                     const SplitPrimitives& split_primitives,
+                     Tag_false)
+    {
+      // allocates tree nodes
+      m_nodes.resize(m_primitives.size()-1);
+
+      // constructs the tree
+      expand<ConcurrencyTag>(0,
+                             m_primitives.begin(), m_primitives.end(),
+                             m_primitives.size(),
+                             compute_bbox,
+                             split_primitives);
+    }
+
+    template <class ConcurrencyTag, class ComputeBbox, class SplitPrimitives>
+    void build_nodes(const ComputeBbox& compute_bbox,
+                     const SplitPrimitives& split_primitives,
+                     Tag_true)
+    {
+      m_compact_nodes.template build<ConcurrencyTag>(m_primitives, compute_bbox, split_primitives);
     }
 
     // clears internal KD tree
@@ -523,7 +649,7 @@ public:
         traits.intersection(query, singleton_data());
         break;
       default: // if(size() >= 2)
-        root_node()->template traversal<Traversal_traits,Query>(query, traits, m_primitives.size());
+        traversal(query, traits, Use_compact_nodes());
       }
     }
 
@@ -538,7 +664,7 @@ public:
         traits.intersection(query, singleton_data());
         break;
       default: // if(size() >= 2)
-        root_node()->template traversal_with_priority<Traversal_traits,Query>(query, traits, m_primitives.size());
+        traversal_with_priority(query, traits, Use_compact_nodes());
       }
     }
 
@@ -553,16 +679,58 @@ public:
         traits.intersection(query, singleton_data());
         break;
       default: // if(size() >= 2)
-        root_node()->template traversal_with_priority_and_group_traversal(m_primitives, query, traits, m_primitives.size(), 0, group_traversal_bound);
+        traversal_with_priority_and_group_traversal(query, traits, group_traversal_bound, Use_compact_nodes());
       }
     }
 
+  private:
+    template <class Query, class Traversal_traits>
+    void traversal(const Query& query, Traversal_traits& traits, Tag_false) const
+    {
+      root_node()->template traversal<Traversal_traits,Query>(query, traits, m_primitives.size());
+    }
+
+    template <class Query, class Traversal_traits>
+    void traversal(const Query& query, Traversal_traits& traits, Tag_true) const
+    {
+      build_if_needed();
+      m_compact_nodes.traversal(m_primitives, query, traits);
+    }
+
+    template <class Query, class Traversal_traits>
+    void traversal_with_priority(const Query& query, Traversal_traits& traits, Tag_false) const
+    {
+      root_node()->template traversal_with_priority<Traversal_traits,Query>(query, traits, m_primitives.size());
+    }
+
+    template <class Query, class Traversal_traits>
+    void traversal_with_priority(const Query& query, Traversal_traits& traits, Tag_true) const
+    {
+      build_if_needed();
+      m_compact_nodes.traversal_with_priority(m_primitives, query, traits);
+    }
+
+    template <class Query, class Traversal_traits>
+    void traversal_with_priority_and_group_traversal(const Query& query, Traversal_traits& traits,
+                                                     const std::size_t group_traversal_bound, Tag_false) const
+    {
+      root_node()->template traversal_with_priority_and_group_traversal(m_primitives, query, traits, m_primitives.size(), 0, group_traversal_bound);
+    }
+
+    template <class Query, class Traversal_traits>
+    void traversal_with_priority_and_group_traversal(const Query& query, Traversal_traits& traits,
+                                                     const std::size_t group_traversal_bound, Tag_true) const
+    {
+      build_if_needed();
+      m_compact_nodes.traversal_with_priority_and_group_traversal(m_primitives, query, traits, group_traversal_bound);
+    }
+
   private:
     typedef AABB_node<AABBTraits> Node;
 
     /**
      * @brief Builds the tree by recursive expansion.
-     * @param node the root node of the subtree to generate
+     * @param node_id the index in `m_nodes` of the root node of the subtree to generate
      * @param first the first primitive to insert
      * @param beyond the last primitive to insert
      * @param range the number of primitive of the range
@@ -570,15 +738,144 @@ public:
      * @param split_primitives a functor
      *
      * [first,beyond[ is the range of primitives to be added to the tree.
+     * The nodes are stored in depth-first order: the subtree of a node covering
+     * `range` primitives occupies the `range-1` consecutive nodes starting at `node_id`,
+     * so that disjoint subtrees can be expanded concurrently.
      */
-    template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
-    void expand(Node& node,
+    template<typename ConcurrencyTag, typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+    void expand(const std::size_t node_id,
                 ConstPrimitiveIterator first,
                 ConstPrimitiveIterator beyond,
                 const std::size_t range,
                 const ComputeBbox& compute_bbox,
                 const SplitPrimitives& split_primitives);
 
+    template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+    void expand_children(const std::size_t left_id, const std::size_t right_id,
+                         ConstPrimitiveIterator first,
+                         ConstPrimitiveIterator middle,
+                         ConstPrimitiveIterator beyond,
+                         const std::size_t range,
+                         const ComputeBbox& compute_bbox,
+                         const SplitPrimitives& split_primitives,
+                         const Sequential_tag&)
+    {
+      const std::size_t new_range = range/2;
+      expand<Sequential_tag>(left_id, first, middle, new_range, compute_bbox, split_primitives);
+      expand<Sequential_tag>(right_id, middle, beyond, range - new_range, compute_bbox, split_primitives);
+    }
+
+#ifdef CGAL_LINKED_WITH_TBB
+    template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+    void expand_children(const std::size_t left_id, const std::size_t right_id,
+                         ConstPrimitiveIterator first,
+                         ConstPrimitiveIterator middle,
+                         ConstPrimitiveIterator beyond,
+                         const std::size_t range,
+                         const ComputeBbox& compute_bbox,
+                         const SplitPrimitives& split_primitives,
+                         const Parallel_tag&)
+    {
+      // Below this number of primitives, spawning tasks costs more than it saves.
+      const std::size_t parallel_threshold = 4096;
+      const std::size_t new_range = range/2;
+      if(range < parallel_threshold)
+      {
+        expand<Sequential_tag>(left_id, first, middle, new_range, compute_bbox, split_primitives);
+        expand<Sequential_tag>(right_id, middle, beyond, range - new_range, compute_bbox, split_primitives);
+        return;
+      }
+
+      tbb::parallel_invoke(
+        [&]{ expand<Parallel_tag>(left_id, first, middle, new_range, compute_bbox, split_primitives); },
+        [&]{ expand<Parallel_tag>(right_id, middle, beyond, range - new_range, compute_bbox, split_primitives); });
+    }
+#endif
+
+    // calls `left()` and `right()`, which process the two subtrees of a node covering `range` primitives
+    template<typename LeftFunctor, typename RightFunctor>
+    static void for_children(const LeftFunctor& left, const RightFunctor& right,
+                             const std::size_t, const Sequential_tag&)
+    {
+      left();
+      right();
+    }
+
+#ifdef CGAL_LINKED_WITH_TBB
+    template<typename LeftFunctor, typename RightFunctor>
+    static void for_children(const LeftFunctor& left, const RightFunctor& right,
+                             const std::size_t range, const Parallel_tag&)
+    {
+      // Same threshold as in `expand_children()`
+      const std::size_t parallel_threshold = 4096;
+      if(range < parallel_threshold)
+      {
+        left();
+        right();
+      }
+      else
+        tbb::parallel_invoke(left, right);
+    }
+#endif
+
+    template<typename ConcurrencyTag>
+    std::size_t refit_nodes(const double rebuild_threshold, Tag_false);
+
+    template<typename ConcurrencyTag>
+    std::size_t refit_nodes(const double /* rebuild_threshold */, Tag_true)
+    {
+      m_compact_nodes.template refit<ConcurrencyTag>(m_primitives, m_traits.compute_bbox_object());
+      return 0;
+    }
+
+    // returns the ratio between the sum of the areas of the boxes of the children of a node,
+    // weighted by their numbers of primitives, and the area of its box, times its number of primitives.
+    // Both children must be nodes, that is `range` must be at least 4.
+    double split_cost(const std::size_t node_id, const std::size_t range) const;
+
+    // recomputes the boxes of the subtree of `node_id`, storing first
+    // the split costs of its nodes if `store_split_costs` is `true`
+    template<typename ConcurrencyTag, typename ConstPrimitiveIterator, typename ComputeBbox>
+    void refit_node(const std::size_t node_id,
+                    ConstPrimitiveIterator first,
+                    const std::size_t range,
+                    const ComputeBbox& compute_bbox,
+                    const bool store_split_costs);
+
+    // rebuilds the largest subtrees of the subtree of `node_id` whose split cost has increased
+    // by a factor larger than `rebuild_threshold`, and returns their number. The reference
+    // split costs are clamped to `min_reference_split_cost`.
+    template<typename ConcurrencyTag, typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+    std::size_t rebuild_degraded_subtrees(const std::size_t node_id,
+                                          ConstPrimitiveIterator first,
+                                          const std::size_t range,
+                                          const double rebuild_threshold,
+                                          const double min_reference_split_cost,
+                                          const ComputeBbox& compute_bbox,
+                                          const SplitPrimitives& split_primitives);
+
+    void store_split_costs(const std::size_t node_id, const std::size_t range)
+    {
+      if(range < 4)
+        return;
+      m_reference_split_costs[node_id] = static_cast<float>(split_cost(node_id, range));
+      store_split_costs(node_id + 1, range/2);
+      store_split_costs(node_id + range/2, range - range/2);
+    }
+
+    // adds the reference split costs of the nodes of the subtree of `node_id` to `sum`,
+    // and their number to `nb`
+    void sum_split_costs(const std::size_t node_id, const std::size_t range,
+                         double& sum, std::size_t& nb) const
+    {
+      if(range < 4)
+        return;
+      sum += m_reference_split_costs[node_id];
+      ++nb;
+      sum_split_costs(node_id + 1, range/2, sum, nb);
+      sum_split_costs(node_id + range/2, range - range/2, sum, nb);
+    }
+
   public:
     // returns a point which must be on one primitive
     Point_and_primitive_id any_reference_point_and_id() const
@@ -631,13 +928,14 @@ public:
     Primitives m_primitives;
     // tree nodes. first node is the root node
     std::vector<Node> m_nodes;
+    // tree nodes, if the traits request compact nodes (`m_nodes` is then empty)
+    Compact_nodes m_compact_nodes;
+    // split costs of the nodes at their construction, filled by `refit()`
+    std::vector<float> m_reference_split_costs;
     #ifdef CGAL_HAS_THREADS
     mutable CGAL_MUTEX build_mutex; // mutex used to protect const calls inducing build() and build_kd_tree()
     #endif
-  public:
-    const Node* root_node() const {
-      CGAL_assertion(size() > 1);
-
+    void build_if_needed() const {
 #ifdef CGAL_HAS_THREADS
       bool m_need_build = m_atomic_need_build.load(std::memory_order_acquire);
 #endif
@@ -650,14 +948,23 @@ public:
 #endif
         const_cast< AABB_tree<AABBTraits>* >(this)->build();
       }
+    }
+
+  public:
+    // Not available if the traits request compact nodes.
+    const Node* root_node() const {
+      CGAL_assertion(size() > 1);
+      CGAL_assertion(!Use_compact_nodes::value);
+      build_if_needed();
       return std::addressof(m_nodes[0]);
     }
 
-    Node& new_node()
-    {
-      m_nodes.emplace_back();
-      return m_nodes.back();
+    const Compact_nodes& compact_nodes() const {
+      CGAL_assertion(size() > 1);
+      build_if_needed();
+      return m_compact_nodes;
     }
+
   private:
     const Primitive& singleton_data() const {
       CGAL_assertion(size() == 1);
@@ -695,6 +1002,8 @@ public:
     m_traits = std::move(tree.m_traits);
     m_primitives = std::move(tree.m_primitives);
     m_nodes = std::move(tree.m_nodes);
+    m_compact_nodes = std::move(tree.m_compact_nodes);
+    m_reference_split_costs = std::move(tree.m_reference_split_costs);
     m_p_search_tree = std::move(tree.m_p_search_tree);
     m_use_default_search_tree = std::exchange(tree.m_use_default_search_tree, true);
 #ifdef CGAL_HAS_THREADS
@@ -772,6 +1081,15 @@ public:
     build();
   }
 
+  template<typename Tr>
+  template<typename ConcurrencyTag, typename ... T>
+  void AABB_tree<Tr>::build(T&& ... t)
+  {
+    set_shared_data_if_any(std::forward<T>(t)...);
+    custom_build<ConcurrencyTag>(m_traits.compute_bbox_object(),
+                                 m_traits.split_primitives_object());
+  }
+
   template<typename Tr>
   void AABB_tree<Tr>::insert(const Primitive& p)
   {
@@ -786,15 +1104,16 @@ public:
   }
 
   template<typename Tr>
-  template<typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+  template<typename ConcurrencyTag, typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
   void
-  AABB_tree<Tr>::expand(Node& node,
+  AABB_tree<Tr>::expand(const std::size_t node_id,
                         ConstPrimitiveIterator first,
                         ConstPrimitiveIterator beyond,
                         const std::size_t range,
                         const ComputeBbox& compute_bbox,
                         const SplitPrimitives& split_primitives)
   {
+    Node& node = m_nodes[node_id];
     node.set_bbox(compute_bbox(first, beyond));
 
     // sort primitives along longest axis aabb
@@ -806,17 +1125,168 @@ public:
       node.set_children(*first, *(first+1));
       break;
     case 3:
-      node.set_children(*first, new_node());
-      expand(node.right_child(), first+1, beyond, 2, compute_bbox, split_primitives);
+      node.set_children(*first, m_nodes[node_id+1]);
+      expand<Sequential_tag>(node_id+1, first+1, beyond, 2, compute_bbox, split_primitives);
+      break;
+    default:
+      // the left subtree covers range/2 primitives and thus uses range/2-1 nodes
+      const std::size_t new_range = range/2;
+      const std::size_t left_id = node_id + 1;
+      const std::size_t right_id = node_id + new_range;
+      node.set_children(m_nodes[left_id], m_nodes[right_id]);
+      expand_children(left_id, right_id, first, first + new_range, beyond, range,
+                      compute_bbox, split_primitives, ConcurrencyTag());
+    }
+  }
+
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  std::size_t AABB_tree<Tr>::refit(const double rebuild_threshold)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    CGAL_static_assertion_msg (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                               "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+#ifdef CGAL_HAS_THREADS
+    bool m_need_build = m_atomic_need_build.load(std::memory_order_relaxed);
+#endif
+    if(m_need_build)
+    {
+      build<ConcurrencyTag>();
+      return 0;
+    }
+
+    // the reference points of the primitives have moved
+    if(m_use_default_search_tree)
+      clear_search_tree();
+
+    if(m_primitives.size() < 2)
+      return 0;
+    return refit_nodes<ConcurrencyTag>(rebuild_threshold, Use_compact_nodes());
+  }
+
+  template<typename Tr>
+  template<typename ConcurrencyTag>
+  std::size_t AABB_tree<Tr>::refit_nodes(const double rebuild_threshold, Tag_false)
+  {
+    // the split costs are those of the nodes before their first refit,
+    // that is right after the construction of the tree
+    const bool store_split_costs = m_reference_split_costs.empty();
+    if(store_split_costs)
+      m_reference_split_costs.resize(m_nodes.size());
+
+    const typename Tr::Compute_bbox compute_bbox = m_traits.compute_bbox_object();
+    refit_node<ConcurrencyTag>(0, m_primitives.begin(), m_primitives.size(),
+                               compute_bbox, store_split_costs);
+
+    if(rebuild_threshold == (std::numeric_limits<double>::max)())
+      return 0;
+
+    double sum = 0;
+    std::size_t nb = 0;
+    sum_split_costs(0, m_primitives.size(), sum, nb);
+    return rebuild_degraded_subtrees<ConcurrencyTag>(0, m_primitives.begin(), m_primitives.size(),
+                                                     rebuild_threshold, (nb == 0) ? 0. : sum / nb,
+                                                     compute_bbox, m_traits.split_primitives_object());
+  }
+
+  template<typename Tr>
+  double AABB_tree<Tr>::split_cost(const std::size_t node_id, const std::size_t range) const
+  {
+    CGAL_precondition(range >= 4);
+    auto half_area = [](const Bounding_box& b)
+    {
+      const double dx = b.xmax() - b.xmin();
+      const double dy = b.ymax() - b.ymin();
+      const double dz = b.zmax() - b.zmin();
+      return dx*dy + dy*dz + dz*dx;
+    };
+
+    const double area = half_area(m_nodes[node_id].bbox());
+    if(!(area > 0))
+      return 1;
+    const std::size_t new_range = range/2;
+    return (half_area(m_nodes[node_id + 1].bbox()) * new_range +
+            half_area(m_nodes[node_id + new_range].bbox()) * (range - new_range)) / (area * range);
+  }
+
+  template<typename Tr>
+  template<typename ConcurrencyTag, typename ConstPrimitiveIterator, typename ComputeBbox>
+  void
+  AABB_tree<Tr>::refit_node(const std::size_t node_id,
+                            ConstPrimitiveIterator first,
+                            const std::size_t range,
+                            const ComputeBbox& compute_bbox,
+                            const bool store_split_costs)
+  {
+    Node& node = m_nodes[node_id];
+    switch(range)
+    {
+    case 2:
+      node.set_bbox(compute_bbox(first, first + 2));
+      break;
+    case 3:
+      refit_node<Sequential_tag>(node_id + 1, first + 1, 2, compute_bbox, store_split_costs);
+      node.set_bbox(compute_bbox(first, first + 1) + m_nodes[node_id + 1].bbox());
       break;
     default:
+    {
+      if(store_split_costs)
+        m_reference_split_costs[node_id] = static_cast<float>(split_cost(node_id, range));
+
       const std::size_t new_range = range/2;
-      node.set_children(new_node(), new_node());
-      expand(node.left_child(), first, first + new_range, new_range, compute_bbox, split_primitives);
-      expand(node.right_child(), first + new_range, beyond, range - new_range, compute_bbox, split_primitives);
+      const std::size_t left_id = node_id + 1;
+      const std::size_t right_id = node_id + new_range;
+      for_children(
+        [&]{ refit_node<ConcurrencyTag>(left_id, first, new_range, compute_bbox, store_split_costs); },
+        [&]{ refit_node<ConcurrencyTag>(right_id, first + new_range, range - new_range, compute_bbox, store_split_costs); },
+        range, ConcurrencyTag());
+      node.set_bbox(m_nodes[left_id].bbox() + m_nodes[right_id].bbox());
+    }
     }
   }
 
+  template<typename Tr>
+  template<typename ConcurrencyTag, typename ConstPrimitiveIterator, typename ComputeBbox, typename SplitPrimitives>
+  std::size_t
+  AABB_tree<Tr>::rebuild_degraded_subtrees(const std::size_t node_id,
+                                           ConstPrimitiveIterator first,
+                                           const std::size_t range,
+                                           const double rebuild_threshold,
+                                           const double min_reference_split_cost,
+                                           const ComputeBbox& compute_bbox,
+                                           const SplitPrimitives& split_primitives)
+  {
+    // smaller subtrees cannot be improved
+    if(range < 4)
+      return 0;
+
+    // The split cost of a node whose children have flat boxes (e.g. collinear primitives) is 0,
+    // and any deformation would increase it by an infinite factor: the reference costs are
+    // clamped to the mean reference cost of the tree, such that these subtrees are only rebuilt
+    // if their cost becomes large compared to the costs of the other nodes.
+    const double reference_split_cost = (std::max)(double(m_reference_split_costs[node_id]), min_reference_split_cost);
+    if(split_cost(node_id, range) > rebuild_threshold * reference_split_cost)
+    {
+      // the subtree keeps the same nodes and primitives, only their order changes
+      expand<ConcurrencyTag>(node_id, first, first + range, range, compute_bbox, split_primitives);
+      store_split_costs(node_id, range);
+      return 1;
+    }
+
+    const std::size_t new_range = range/2;
+    std::size_t nb_left = 0, nb_right = 0;
+    for_children(
+      [&]{ nb_left = rebuild_degraded_subtrees<ConcurrencyTag>(node_id + 1, first, new_range,
+                                                               rebuild_threshold, min_reference_split_cost,
+                                                               compute_bbox, split_primitives); },
+      [&]{ nb_right = rebuild_degraded_subtrees<ConcurrencyTag>(node_id + new_range, first + new_range, range - new_range,
+                                                                rebuild_threshold, min_reference_split_cost,
+                                                                compute_bbox, split_primitives); },
+      range, ConcurrencyTag());
+    return nb_left + nb_right;
+  }
+
 
   // Build the data structure, after calls to insert(..)
   template<typename Tr>
@@ -833,20 +1303,25 @@ public:
     const ComputeBbox& compute_bbox,
     const SplitPrimitives& split_primitives)
   {
-    clear_nodes();
+    custom_build<Sequential_tag>(compute_bbox, split_primitives);
+  }
 
-    if(m_primitives.size() > 1) {
+  template<typename Tr>
+  template <class ConcurrencyTag, class ComputeBbox, class SplitPrimitives>
+  void AABB_tree<Tr>::custom_build(
+    const ComputeBbox& compute_bbox,
+    const SplitPrimitives& split_primitives)
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    CGAL_static_assertion_msg (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                               "Parallel_tag is enabled but TBB is unavailable.");
+#endif
 
-      // allocates tree nodes
-      m_nodes.reserve(m_primitives.size()-1);
+    clear_nodes();
+
+    if(m_primitives.size() > 1)
+      build_nodes<ConcurrencyTag>(compute_bbox, split_primitives, Use_compact_nodes());
 
-      // constructs the tree
-      expand(new_node(),
-             m_primitives.begin(), m_primitives.end(),
-             m_primitives.size(),
-             compute_bbox,
-             split_primitives);
-    }
 #ifdef CGAL_HAS_THREADS
     m_atomic_need_build.store(false, std::memory_order_release); // in case build() is triggered by a call to root_node()
 #else
@@ -1059,6 +1534,7 @@ public:
 } // end namespace CGAL
 
 #include <CGAL/AABB_tree/internal/AABB_ray_intersection.h>
+#include <CGAL/AABB_tree/internal/AABB_packet_traversal.h>
 
 #include <CGAL/enable_warnings.h>
 
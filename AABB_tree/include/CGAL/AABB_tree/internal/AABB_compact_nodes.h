@@ -0,0 +1,727 @@
+// Copyright (c) 2026  agent <agent@local>.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s) : agent <agent@local>
+
+#ifndef CGAL_AABB_TREE_INTERNAL_AABB_COMPACT_NODES_H
+#define CGAL_AABB_TREE_INTERNAL_AABB_COMPACT_NODES_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <CGAL/Bbox_3.h>
+#include <CGAL/assertions.h>
+#include <CGAL/tags.h>
+#include <CGAL/AABB_tree/internal/Primitive_helper.h>
+
+#include <boost/heap/priority_queue.hpp>
+#include <boost/mpl/has_xxx.hpp>
+#include <boost/optional.hpp>
+#include <boost/variant/apply_visitor.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_invoke.h>
+#endif
+
+namespace CGAL {
+namespace internal {
+namespace AABB_tree {
+
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(Has_nested_type_Compact_box_coordinate, Compact_box_coordinate, false)
+
+/*
+ * Conservative encoding of the bounding box of a child node, relative
+ * to the (already decoded) bounding box of its parent.
+ * The decoded box always contains the box that was encoded.
+ */
+template <typename Coordinate>
+struct Compact_box_codec;
+
+// Boxes stored in single precision, rounded outwards.
+template <>
+struct Compact_box_codec<float>
+{
+  typedef std::array<float, 6> Stored_box;
+
+  static float round_down(const double d)
+  {
+    float f = static_cast<float>(d);
+    if(static_cast<double>(f) > d)
+      f = std::nextafter(f, -std::numeric_limits<float>::infinity());
+    return f;
+  }
+
+  static float round_up(const double d)
+  {
+    float f = static_cast<float>(d);
+    if(static_cast<double>(f) < d)
+      f = std::nextafter(f, std::numeric_limits<float>::infinity());
+    return f;
+  }
+
+  static Stored_box encode(const Bbox_3& box, const Bbox_3& /* parent */)
+  {
+    return {{ round_down(box.xmin()), round_down(box.ymin()), round_down(box.zmin()),
+              round_up(box.xmax()), round_up(box.ymax()), round_up(box.zmax()) }};
+  }
+
+  static Bbox_3 decode(const Stored_box& b, const Bbox_3& /* parent */)
+  {
+    return Bbox_3(b[0], b[1], b[2], b[3], b[4], b[5]);
+  }
+};
+
+// Boxes stored as 16-bit fixed-point coordinates in the parent box.
+template <>
+struct Compact_box_codec<std::uint16_t>
+{
+  typedef std::array<std::uint16_t, 6> Stored_box;
+  static constexpr int max_q = (std::numeric_limits<std::uint16_t>::max)();
+
+  // The extreme values are decoded to the bounds of the parent box, so that
+  // the decoded box never leaks out of the parent box because of rounding.
+  static double decode(const int q, const double pmin, const double pmax)
+  {
+    if(q == 0)
+      return pmin;
+    if(q == max_q)
+      return pmax;
+    return pmin + q * ((pmax - pmin) / max_q);
+  }
+
+  static std::uint16_t encode_min(const double c, const double pmin, const double pmax)
+  {
+    const double extent = pmax - pmin;
+    if(!(extent > 0) || !(c > pmin))
+      return 0;
+    int q = static_cast<int>((std::min)(std::floor((c - pmin) / extent * max_q), double(max_q)));
+    while(q > 0 && decode(q, pmin, pmax) > c)
+      --q;
+    return static_cast<std::uint16_t>(q);
+  }
+
+  static std::uint16_t encode_max(const double c, const double pmin, const double pmax)
+  {
+    const double extent = pmax - pmin;
+    if(!(extent > 0) || !(c < pmax))
+      return max_q;
+    int q = static_cast<int>((std::max)(std::ceil((c - pmin) / extent * max_q), 0.));
+    while(q < max_q && decode(q, pmin, pmax) < c)
+      ++q;
+    return static_cast<std::uint16_t>(q);
+  }
+
+  static Stored_box encode(const Bbox_3& box, const Bbox_3& parent)
+  {
+    Stored_box res;
+    for(int i=0; i<3; ++i)
+    {
+      res[i] = encode_min((box.min)(i), (parent.min)(i), (parent.max)(i));
+      res[i+3] = encode_max((box.max)(i), (parent.min)(i), (parent.max)(i));
+    }
+    return res;
+  }
+
+  static Bbox_3 decode(const Stored_box& b, const Bbox_3& parent)
+  {
+    return Bbox_3(decode(b[0], parent.xmin(), parent.xmax()),
+                  decode(b[1], parent.ymin(), parent.ymax()),
+                  decode(b[2], parent.zmin(), parent.zmax()),
+                  decode(b[3], parent.xmin(), parent.xmax()),
+                  decode(b[4], parent.ymin(), parent.ymax()),
+                  decode(b[5], parent.zmin(), parent.zmax()));
+  }
+};
+
+/*
+ * What traversal traits see of a node of a compact tree: only its
+ * (decoded, hence slightly enlarged) bounding box.
+ */
+class AABB_compact_node_view
+{
+public:
+  AABB_compact_node_view(const Bbox_3& bbox) : m_bbox(bbox) { }
+  const Bbox_3& bbox() const { return m_bbox; }
+
+private:
+  Bbox_3 m_bbox;
+};
+
+/*
+ * Flat storage of the internal nodes of an AABB tree.
+ *
+ * Each node stores the encoded boxes of its two children and two 32-bit
+ * indices, which are either indices of nodes or, for leaves, of primitives.
+ * As in `AABB_node`, whether a child is a leaf is deduced from the number of
+ * primitives below the node, and nodes are stored in depth-first order,
+ * the left child of a node being the node right after it.
+ */
+template <typename AABBTraits, typename Coordinate>
+class AABB_compact_nodes
+{
+  typedef Compact_box_codec<Coordinate> Codec;
+  typedef typename Codec::Stored_box Stored_box;
+  typedef typename AABBTraits::Primitive Primitive;
+  typedef std::vector<Primitive> Primitives;
+  typedef std::uint32_t Index;
+
+  struct Node
+  {
+    Stored_box boxes[2];
+    Index children[2];
+  };
+
+public:
+  typedef AABB_compact_node_view Node_view;
+
+  void clear()
+  {
+    std::vector<Node>().swap(m_nodes);
+  }
+
+  const Bbox_3& root_bbox() const { return m_root_bbox; }
+
+  std::size_t number_of_nodes() const { return m_nodes.size(); }
+
+  std::size_t bytes() const { return m_nodes.capacity() * sizeof(Node); }
+
+  template <typename ConcurrencyTag, typename ComputeBbox, typename SplitPrimitives>
+  void build(Primitives& primitives,
+             const ComputeBbox& compute_bbox,
+             const SplitPrimitives& split_primitives)
+  {
+    clear();
+    CGAL_precondition(primitives.size() > 1);
+    CGAL_precondition(primitives.size() - 1 <= (std::numeric_limits<Index>::max)());
+
+    m_nodes.resize(primitives.size() - 1);
+    m_root_bbox = compute_bbox(primitives.begin(), primitives.end());
+    expand<ConcurrencyTag>(0, primitives, 0, primitives.size(), m_root_bbox, m_root_bbox,
+                           compute_bbox, split_primitives);
+  }
+
+  // The boxes of the children are first recomputed bottom-up, and then encoded
+  // top-down as the encoding of a box depends on the decoded box of its parent.
+  template <typename ConcurrencyTag, typename ComputeBbox>
+  void refit(const Primitives& primitives,
+             const ComputeBbox& compute_bbox)
+  {
+    CGAL_precondition(primitives.size() == m_nodes.size() + 1);
+
+    std::vector<std::array<Bbox_3, 2> > boxes(m_nodes.size());
+    m_root_bbox = compute_children_boxes<ConcurrencyTag>(0, primitives, primitives.size(),
+                                                         boxes, compute_bbox);
+    encode_children_boxes(0, primitives.size(), m_root_bbox, boxes);
+  }
+
+  template <class Query, class Traversal_traits>
+  void traversal(const Primitives& primitives,
+                 const Query& query,
+                 Traversal_traits& traits) const
+  {
+    traversal(0, m_root_bbox, primitives, query, traits, primitives.size());
+  }
+
+  template <class Query, class Traversal_traits>
+  void traversal_with_priority(const Primitives& primitives,
+                               const Query& query,
+                               Traversal_traits& traits) const
+  {
+    traversal_with_priority(0, m_root_bbox, primitives, query, traits, primitives.size());
+  }
+
+  template <class Query, class Traversal_traits>
+  void traversal_with_priority_and_group_traversal(const Primitives& primitives,
+                                                   const Query& query,
+                                                   Traversal_traits& traits,
+                                                   const std::size_t group_traversal_bound) const
+  {
+    traversal_with_priority_and_group_traversal(0, m_root_bbox, primitives, query, traits,
+                                                primitives.size(), 0, group_traversal_bound);
+  }
+
+  // Same algorithm as in `AABB_ray_intersection`
+  template <typename Ray, typename Result, typename SkipFunctor, typename ParamVisitor>
+  boost::optional<Result> ray_intersection(const Primitives& primitives,
+                                           const AABBTraits& aabb_traits,
+                                           const Ray& query,
+                                           const SkipFunctor& skip,
+                                           ParamVisitor param_visitor) const
+  {
+    typedef typename AABBTraits::FT FT;
+
+    struct Node_with_ft
+    {
+      Node_with_ft(Index id, const Bbox_3& bbox, const FT& value, std::size_t nb_primitives)
+        : id(id), bbox(bbox), nb_primitives(nb_primitives), value(value) {}
+      Index id;
+      Bbox_3 bbox;
+      std::size_t nb_primitives;
+      FT value;
+      bool operator>(const Node_with_ft& other) const { return value > other.value; }
+    };
+
+    typedef boost::heap::priority_queue<Node_with_ft,
+                                        boost::heap::compare<std::greater<Node_with_ft> > > Heap_type;
+
+    typename AABBTraits::Intersection intersection_obj = aabb_traits.intersection_object();
+    typename AABBTraits::Intersection_distance intersection_distance_obj = aabb_traits.intersection_distance_object();
+
+    boost::optional<Result> intersection, p;
+    FT t = (std::numeric_limits<double>::max)();
+
+    auto test_primitive = [&](const Primitive& pr)
+    {
+      if(skip(pr.id()))
+        return;
+      intersection = intersection_obj(query, pr);
+      if(intersection)
+      {
+        FT ray_distance = boost::apply_visitor(param_visitor, intersection->first);
+        if(ray_distance < t)
+        {
+          t = ray_distance;
+          p = intersection;
+        }
+      }
+    };
+
+    auto push_child = [&](Heap_type& pq, const Node& node, int i, std::size_t nb, const Bbox_3& parent)
+    {
+      const Bbox_3 child_bbox = Codec::decode(node.boxes[i], parent);
+      boost::optional<FT> dist = intersection_distance_obj(query, child_bbox);
+      if(dist)
+        pq.push(Node_with_ft(node.children[i], child_bbox, *dist, nb));
+    };
+
+    Heap_type pq;
+    pq.push(Node_with_ft(0, m_root_bbox, 0, primitives.size()));
+
+    while(!pq.empty() && pq.top().value < t)
+    {
+      Node_with_ft current = pq.top();
+      pq.pop();
+      const Node& node = m_nodes[current.id];
+
+      switch(current.nb_primitives)
+      {
+      case 2:
+        test_primitive(primitives[node.children[0]]);
+        test_primitive(primitives[node.children[1]]);
+        break;
+      case 3:
+        test_primitive(primitives[node.children[0]]);
+        push_child(pq, node, 1, 2, current.bbox);
+        break;
+      default:
+        push_child(pq, node, 0, current.nb_primitives/2, current.bbox);
+        push_child(pq, node, 1, current.nb_primitives - current.nb_primitives/2, current.bbox);
+      }
+    }
+
+    return p;
+  }
+
+private:
+  template <typename ConcurrencyTag, typename ComputeBbox, typename SplitPrimitives>
+  void expand(const Index node_id,
+              Primitives& primitives,
+              const std::size_t first,
+              const std::size_t range,
+              const Bbox_3& bbox,
+              const Bbox_3& decoded_bbox,
+              const ComputeBbox& compute_bbox,
+              const SplitPrimitives& split_primitives)
+  {
+    typedef typename Primitives::iterator Iterator;
+    const Iterator begin = primitives.begin() + first;
+    const Iterator end = begin + range;
+    const std::size_t new_range = range/2;
+
+    split_primitives(begin, end, bbox);
+
+    Node& node = m_nodes[node_id];
+    const Bbox_3 left_bbox = compute_bbox(begin, begin + new_range);
+    const Bbox_3 right_bbox = compute_bbox(begin + new_range, end);
+    node.boxes[0] = Codec::encode(left_bbox, decoded_bbox);
+    node.boxes[1] = Codec::encode(right_bbox, decoded_bbox);
+
+    switch(range)
+    {
+    case 2:
+      node.children[0] = static_cast<Index>(first);
+      node.children[1] = static_cast<Index>(first + 1);
+      break;
+    case 3:
+      node.children[0] = static_cast<Index>(first);
+      node.children[1] = node_id + 1;
+      expand<Sequential_tag>(node_id + 1, primitives, first + 1, 2, right_bbox,
+                             Codec::decode(node.boxes[1], decoded_bbox),
+                             compute_bbox, split_primitives);
+      break;
+    default:
+      node.children[0] = node_id + 1;
+      node.children[1] = node_id + static_cast<Index>(new_range);
+      expand_children(node, primitives, first, range, left_bbox, right_bbox, decoded_bbox,
+                      compute_bbox, split_primitives, ConcurrencyTag());
+    }
+  }
+
+  template <typename ComputeBbox, typename SplitPrimitives>
+  void expand_children(const Node& node,
+                       Primitives& primitives,
+                       const std::size_t first,
+                       const std::size_t range,
+                       const Bbox_3& left_bbox,
+                       const Bbox_3& right_bbox,
+                       const Bbox_3& decoded_bbox,
+                       const ComputeBbox& compute_bbox,
+                       const SplitPrimitives& split_primitives,
+                       const Sequential_tag&)
+  {
+    const std::size_t new_range = range/2;
+    expand<Sequential_tag>(node.children[0], primitives, first, new_range, left_bbox,
+                           Codec::decode(node.boxes[0], decoded_bbox), compute_bbox, split_primitives);
+    expand<Sequential_tag>(node.children[1], primitives, first + new_range, range - new_range, right_bbox,
+                           Codec::decode(node.boxes[1], decoded_bbox), compute_bbox, split_primitives);
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  template <typename ComputeBbox, typename SplitPrimitives>
+  void expand_children(const Node& node,
+                       Primitives& primitives,
+                       const std::size_t first,
+                       const std::size_t range,
+                       const Bbox_3& left_bbox,
+                       const Bbox_3& right_bbox,
+                       const Bbox_3& decoded_bbox,
+                       const ComputeBbox& compute_bbox,
+                       const SplitPrimitives& split_primitives,
+                       const Parallel_tag&)
+  {
+    // Same threshold as in `AABB_tree::expand_children()`
+    const std::size_t parallel_threshold = 4096;
+    if(range < parallel_threshold)
+      return expand_children(node, primitives, first, range, left_bbox, right_bbox, decoded_bbox,
+                             compute_bbox, split_primitives, Sequential_tag());
+
+    const std::size_t new_range = range/2;
+    const Bbox_3 left_decoded = Codec::decode(node.boxes[0], decoded_bbox);
+    const Bbox_3 right_decoded = Codec::decode(node.boxes[1], decoded_bbox);
+    tbb::parallel_invoke(
+      [&]{ expand<Parallel_tag>(node.children[0], primitives, first, new_range, left_bbox,
+                                left_decoded, compute_bbox, split_primitives); },
+      [&]{ expand<Parallel_tag>(node.children[1], primitives, first + new_range, range - new_range,
+                                right_bbox, right_decoded, compute_bbox, split_primitives); });
+  }
+#endif
+
+  // returns the exact box of the subtree of `node_id`, and puts
+  // the exact boxes of the children of its nodes in `boxes`
+  template <typename ConcurrencyTag, typename ComputeBbox>
+  Bbox_3 compute_children_boxes(const Index node_id,
+                                const Primitives& primitives,
+                                const std::size_t range,
+                                std::vector<std::array<Bbox_3, 2> >& boxes,
+                                const ComputeBbox& compute_bbox) const
+  {
+    const Node& node = m_nodes[node_id];
+    auto primitive_bbox = [&](const Index i)
+    {
+      return compute_bbox(primitives.begin() + i, primitives.begin() + i + 1);
+    };
+
+    switch(range)
+    {
+    case 2:
+      boxes[node_id][0] = primitive_bbox(node.children[0]);
+      boxes[node_id][1] = primitive_bbox(node.children[1]);
+      break;
+    case 3:
+      boxes[node_id][0] = primitive_bbox(node.children[0]);
+      boxes[node_id][1] = compute_children_boxes<Sequential_tag>(node.children[1], primitives, 2,
+                                                                 boxes, compute_bbox);
+      break;
+    default:
+      compute_children_boxes(node, primitives, range, boxes[node_id], boxes,
+                             compute_bbox, ConcurrencyTag());
+    }
+    return boxes[node_id][0] + boxes[node_id][1];
+  }
+
+  template <typename ComputeBbox>
+  void compute_children_boxes(const Node& node,
+                              const Primitives& primitives,
+                              const std::size_t range,
+                              std::array<Bbox_3, 2>& children_boxes,
+                              std::vector<std::array<Bbox_3, 2> >& boxes,
+                              const ComputeBbox& compute_bbox,
+                              const Sequential_tag&) const
+  {
+    const std::size_t new_range = range/2;
+    children_boxes[0] = compute_children_boxes<Sequential_tag>(node.children[0], primitives, new_range,
+                                                               boxes, compute_bbox);
+    children_boxes[1] = compute_children_boxes<Sequential_tag>(node.children[1], primitives, range - new_range,
+                                                               boxes, compute_bbox);
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  template <typename ComputeBbox>
+  void compute_children_boxes(const Node& node,
+                              const Primitives& primitives,
+                              const std::size_t range,
+                              std::array<Bbox_3, 2>& children_boxes,
+                              std::vector<std::array<Bbox_3, 2> >& boxes,
+                              const ComputeBbox& compute_bbox,
+                              const Parallel_tag&) const
+  {
+    // Same threshold as in `AABB_tree::expand_children()`
+    const std::size_t parallel_threshold = 4096;
+    if(range < parallel_threshold)
+      return compute_children_boxes(node, primitives, range, children_boxes, boxes,
+                                    compute_bbox, Sequential_tag());
+
+    const std::size_t new_range = range/2;
+    tbb::parallel_invoke(
+      [&]{ children_boxes[0] = compute_children_boxes<Parallel_tag>(node.children[0], primitives, new_range,
+                                                                    boxes, compute_bbox); },
+      [&]{ children_boxes[1] = compute_children_boxes<Parallel_tag>(node.children[1], primitives, range - new_range,
+                                                                    boxes, compute_bbox); });
+  }
+#endif
+
+  void encode_children_boxes(const Index node_id,
+                             const std::size_t range,
+                             const Bbox_3& decoded_bbox,
+                             const std::vector<std::array<Bbox_3, 2> >& boxes)
+  {
+    Node& node = m_nodes[node_id];
+    node.boxes[0] = Codec::encode(boxes[node_id][0], decoded_bbox);
+    node.boxes[1] = Codec::encode(boxes[node_id][1], decoded_bbox);
+
+    const std::size_t new_range = range/2;
+    if(new_range > 1)
+      encode_children_boxes(node.children[0], new_range, Codec::decode(node.boxes[0], decoded_bbox), boxes);
+    if(range - new_range > 1)
+      encode_children_boxes(node.children[1], range - new_range, Codec::decode(node.boxes[1], decoded_bbox), boxes);
+  }
+
+  template <class Query, class Traversal_traits>
+  void traversal(const Index node_id,
+                 const Bbox_3& bbox,
+                 const Primitives& primitives,
+                 const Query& query,
+                 Traversal_traits& traits,
+                 const std::size_t nb_primitives) const
+  {
+    const Node& node = m_nodes[node_id];
+    switch(nb_primitives)
+    {
+    case 2:
+      traits.intersection(query, primitives[node.children[0]]);
+      if( traits.go_further() )
+        traits.intersection(query, primitives[node.children[1]]);
+      break;
+    case 3:
+    {
+      traits.intersection(query, primitives[node.children[0]]);
+      if( !traits.go_further() )
+        break;
+      const Node_view right(Codec::decode(node.boxes[1], bbox));
+      if( traits.do_intersect(query, right) )
+        traversal(node.children[1], right.bbox(), primitives, query, traits, 2);
+      break;
+    }
+    default:
+    {
+      const Node_view left(Codec::decode(node.boxes[0], bbox));
+      const Node_view right(Codec::decode(node.boxes[1], bbox));
+      if( traits.do_intersect(query, left) )
+      {
+        traversal(node.children[0], left.bbox(), primitives, query, traits, nb_primitives/2);
+        if( traits.go_further() && traits.do_intersect(query, right) )
+          traversal(node.children[1], right.bbox(), primitives, query, traits, nb_primitives-nb_primitives/2);
+      }
+      else if( traits.do_intersect(query, right) )
+      {
+        traversal(node.children[1], right.bbox(), primitives, query, traits, nb_primitives-nb_primitives/2);
+      }
+    }
+    }
+  }
+
+  template <class Query, class Traversal_traits>
+  void traversal_with_priority(const Index node_id,
+                               const Bbox_3& bbox,
+                               const Primitives& primitives,
+                               const Query& query,
+                               Traversal_traits& traits,
+                               const std::size_t nb_primitives) const
+  {
+    const Node& node = m_nodes[node_id];
+    switch(nb_primitives)
+    {
+    case 2:
+      traits.intersection(query, primitives[node.children[0]]);
+      if( traits.go_further() )
+        traits.intersection(query, primitives[node.children[1]]);
+      break;
+    case 3:
+    {
+      traits.intersection(query, primitives[node.children[0]]);
+      if( !traits.go_further() )
+        break;
+      const Node_view right(Codec::decode(node.boxes[1], bbox));
+      if( traits.do_intersect(query, right) )
+        traversal_with_priority(node.children[1], right.bbox(), primitives, query, traits, 2);
+      break;
+    }
+    default:
+    {
+      const Node_view left(Codec::decode(node.boxes[0], bbox));
+      const Node_view right(Codec::decode(node.boxes[1], bbox));
+      bool ileft, iright;
+      typename Traversal_traits::Priority pleft, pright;
+      std::tie(ileft, pleft) = traits.do_intersect_with_priority(query, left);
+      std::tie(iright, pright) = traits.do_intersect_with_priority(query, right);
+
+      const std::size_t nb_left = nb_primitives/2, nb_right = nb_primitives - nb_left;
+      if(ileft && iright)
+      {
+        if(pleft >= pright)
+        {
+          traversal_with_priority(node.children[0], left.bbox(), primitives, query, traits, nb_left);
+          if( traits.go_further() )
+            traversal_with_priority(node.children[1], right.bbox(), primitives, query, traits, nb_right);
+        }
+        else
+        {
+          traversal_with_priority(node.children[1], right.bbox(), primitives, query, traits, nb_right);
+          if( traits.go_further() )
+            traversal_with_priority(node.children[0], left.bbox(), primitives, query, traits, nb_left);
+        }
+      }
+      else if(ileft)
+        traversal_with_priority(node.children[0], left.bbox(), primitives, query, traits, nb_left);
+      else if(iright)
+        traversal_with_priority(node.children[1], right.bbox(), primitives, query, traits, nb_right);
+    }
+    }
+  }
+
+  template <class Query, class Traversal_traits>
+  void traversal_with_priority_and_group_traversal(const Index node_id,
+                                                   const Bbox_3& bbox,
+                                                   const Primitives& primitives,
+                                                   const Query& query,
+                                                   Traversal_traits& traits,
+                                                   const std::size_t nb_primitives,
+                                                   const std::size_t first_primitive_index,
+                                                   const std::size_t group_traversal_bound) const
+  {
+    CGAL_assertion(group_traversal_bound >= 2);
+    if( nb_primitives <= group_traversal_bound )
+    {
+      if( !traits.do_intersect(query, Node_view(bbox)) )
+        return;
+      traits.traverse_group(query, primitives.begin() + first_primitive_index,
+                            primitives.begin() + first_primitive_index + nb_primitives);
+      return;
+    }
+
+    const Node& node = m_nodes[node_id];
+    switch(nb_primitives)
+    {
+    case 2:
+      traits.intersection(query, primitives[node.children[0]]);
+      if( traits.go_further() )
+        traits.intersection(query, primitives[node.children[1]]);
+      break;
+    case 3:
+    {
+      traits.intersection(query, primitives[node.children[0]]);
+      if( !traits.go_further() )
+        break;
+      const Node_view right(Codec::decode(node.boxes[1], bbox));
+      if( traits.do_intersect(query, right) )
+        traversal_with_priority_and_group_traversal(node.children[1], right.bbox(), primitives, query, traits,
+                                                    2, first_primitive_index + 1, group_traversal_bound);
+      break;
+    }
+    default:
+    {
+      const Node_view left(Codec::decode(node.boxes[0], bbox));
+      const Node_view right(Codec::decode(node.boxes[1], bbox));
+      bool ileft, iright;
+      typename Traversal_traits::Priority pleft, pright;
+      std::tie(ileft, pleft) = traits.do_intersect_with_priority(query, left);
+      std::tie(iright, pright) = traits.do_intersect_with_priority(query, right);
+
+      const std::size_t nb_left = nb_primitives/2, nb_right = nb_primitives - nb_left;
+      const std::size_t first_right = first_primitive_index + nb_left;
+      if(ileft && iright)
+      {
+        if(pleft >= pright)
+        {
+          traversal_with_priority_and_group_traversal(node.children[0], left.bbox(), primitives, query, traits,
+                                                      nb_left, first_primitive_index, group_traversal_bound);
+          if( traits.go_further() )
+            traversal_with_priority_and_group_traversal(node.children[1], right.bbox(), primitives, query, traits,
+                                                        nb_right, first_right, group_traversal_bound);
+        }
+        else
+        {
+          traversal_with_priority_and_group_traversal(node.children[1], right.bbox(), primitives, query, traits,
+                                                      nb_right, first_right, group_traversal_bound);
+          if( traits.go_further() )
+            traversal_with_priority_and_group_traversal(node.children[0], left.bbox(), primitives, query, traits,
+                                                        nb_left, first_primitive_index, group_traversal_bound);
+        }
+      }
+      else if(ileft)
+        traversal_with_priority_and_group_traversal(node.children[0], left.bbox(), primitives, query, traits,
+                                                    nb_left, first_primitive_index, group_traversal_bound);
+      else if(iright)
+        traversal_with_priority_and_group_traversal(node.children[1], right.bbox(), primitives, query, traits,
+                                                    nb_right, first_right, group_traversal_bound);
+    }
+    }
+  }
+
+  std::vector<Node> m_nodes;
+  Bbox_3 m_root_bbox;
+};
+
+// Selects the storage of the nodes of `AABB_tree` from its traits:
+// compact nodes if the traits define the nested type `Compact_box_coordinate`.
+template <typename AABBTraits,
+          bool is_compact = Has_nested_type_Compact_box_coordinate<AABBTraits>::value>
+struct Compact_nodes_selector
+{
+  struct type { void clear() { } };
+};
+
+template <typename AABBTraits>
+struct Compact_nodes_selector<AABBTraits, true>
+{
+  typedef AABB_compact_nodes<AABBTraits, typename AABBTraits::Compact_box_coordinate> type;
+};
+
+} // namespace AABB_tree
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_AABB_TREE_INTERNAL_AABB_COMPACT_NODES_H
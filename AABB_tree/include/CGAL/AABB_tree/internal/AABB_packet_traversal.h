@@ -0,0 +1,477 @@
+// Copyright (c) 2026  agent <agent@local>.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s) : agent <agent@local>
+
+#ifndef CGAL_AABB_TREE_INTERNAL_AABB_PACKET_TRAVERSAL_H
+#define CGAL_AABB_TREE_INTERNAL_AABB_PACKET_TRAVERSAL_H
+
+#include <CGAL/license/AABB_tree.h>
+
+#include <CGAL/Bbox_3.h>
+#include <CGAL/number_utils.h>
+#include <CGAL/tags.h>
+
+#include <boost/optional.hpp>
+#include <boost/variant/apply_visitor.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif
+
+namespace CGAL {
+namespace internal {
+namespace AABB_tree {
+
+/*
+ * Batched queries traverse the tree with packets of `packet_size` queries:
+ * a node is fetched once for the whole packet and its box is tested against
+ * all the queries of the packet at once. The box tests are done in double
+ * precision on fixed-size arrays, so that the compiler can vectorize them,
+ * and are made conservative by enlarging the boxes with a small tolerance:
+ * the exact predicates and constructions of the traits are only used on
+ * the primitives.
+ */
+static constexpr int packet_size = 8;
+typedef unsigned int Packet_mask;
+
+inline int longest_axis(const Bbox_3& b)
+{
+  const double dx = b.xmax() - b.xmin(), dy = b.ymax() - b.ymin(), dz = b.zmax() - b.zmin();
+  return (dx >= dy) ? ((dx >= dz) ? 0 : 2) : ((dy >= dz) ? 1 : 2);
+}
+
+inline double conservative_tolerance(const double d)
+{
+  return 1e-12 * (1. + std::abs(d));
+}
+
+// the largest absolute value of the coordinates of `b` along the axis `i`
+inline double magnitude(const Bbox_3& b, const int i)
+{
+  return (std::max)(std::abs((b.min)(i)), std::abs((b.max)(i)));
+}
+
+template <int N>
+inline Packet_mask full_packet_mask(const int size)
+{
+  return (size == N) ? ~Packet_mask(0) : ((Packet_mask(1) << size) - 1);
+}
+
+// Rays `o + t*d` with `t` in [0, t_max[
+//
+// The rounding errors of the slab test are proportional to the magnitude of the
+// coordinates involved, that is of the source, of the box, and of the points `o + t*d`
+// of the ray within the box: the slabs are enlarged accordingly, so that a box
+// that is hit by a ray is never rejected.
+template <int N>
+struct Ray_packet
+{
+  std::array<double, N> o[3], d[3], o_magnitude, t_max;
+
+  template <typename Ray>
+  void set(const int lane, const Ray& ray)
+  {
+    const auto s = ray.source();
+    const auto v = ray.to_vector();
+    double m = 0;
+    for(int i=0; i<3; ++i)
+    {
+      o[i][lane] = CGAL::to_double(s[i]);
+      d[i][lane] = CGAL::to_double(v[i]);
+      m = (std::max)(m, std::abs(o[i][lane]));
+    }
+    o_magnitude[lane] = m;
+    t_max[lane] = std::numeric_limits<double>::infinity();
+  }
+
+  template <typename FT>
+  void update_bound(const int lane, const FT& t)
+  {
+    const double td = CGAL::to_double(t);
+    t_max[lane] = td + conservative_tolerance(td);
+  }
+
+  Packet_mask box_test(const Bbox_3& b, const Packet_mask mask) const
+  {
+    std::array<double, N> tmin, tmax;
+    for(int l=0; l<N; ++l)
+    {
+      tmin[l] = 0;
+      tmax[l] = t_max[l];
+    }
+
+    for(int i=0; i<3; ++i)
+    {
+      const double b_magnitude = magnitude(b, i);
+      for(int l=0; l<N; ++l)
+      {
+        const double reach = (t_max[l] < std::numeric_limits<double>::infinity()) ? t_max[l] * std::abs(d[i][l]) : 0.;
+        const double slack = conservative_tolerance((std::max)((std::max)(o_magnitude[l], b_magnitude), reach));
+        const double lo = (b.min)(i) - slack, hi = (b.max)(i) + slack;
+        double t1, t2;
+        if(d[i][l] == 0)
+        {
+          const bool inside = (o[i][l] >= lo) && (o[i][l] <= hi);
+          t1 = inside ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+          t2 = -t1;
+        }
+        else
+        {
+          t1 = (lo - o[i][l]) / d[i][l];
+          t2 = (hi - o[i][l]) / d[i][l];
+        }
+        tmin[l] = (std::max)(tmin[l], (std::min)(t1, t2));
+        tmax[l] = (std::min)(tmax[l], (std::max)(t1, t2));
+      }
+    }
+
+    Packet_mask res = 0;
+    for(int l=0; l<N; ++l)
+      if(tmin[l] <= tmax[l])
+        res |= (Packet_mask(1) << l);
+    return res & mask;
+  }
+
+  // the children of a node are sorted along the longest axis of its box
+  bool left_first(const Bbox_3& b, const Bbox_3&, const Bbox_3&, const int lane) const
+  {
+    return d[longest_axis(b)][lane] >= 0;
+  }
+};
+
+// Points whose closest point found so far is at distance at most `d_max`
+template <int N>
+struct Point_packet
+{
+  std::array<double, N> p[3], p_magnitude, d_max;
+
+  template <typename Point>
+  void set(const int lane, const Point& q)
+  {
+    double m = 0;
+    for(int i=0; i<3; ++i)
+    {
+      p[i][lane] = CGAL::to_double(q[i]);
+      m = (std::max)(m, std::abs(p[i][lane]));
+    }
+    p_magnitude[lane] = m;
+    d_max[lane] = std::numeric_limits<double>::infinity();
+  }
+
+  template <typename FT>
+  void update_bound(const int lane, const FT& sq_distance)
+  {
+    const double d = std::sqrt(CGAL::to_double(sq_distance));
+    d_max[lane] = d + conservative_tolerance(d);
+  }
+
+  Packet_mask box_test(const Bbox_3& b, const Packet_mask mask) const
+  {
+    std::array<double, N> sq;
+    for(int l=0; l<N; ++l)
+      sq[l] = 0;
+
+    const double b_magnitude = (std::max)((std::max)(magnitude(b, 0), magnitude(b, 1)), magnitude(b, 2));
+    for(int i=0; i<3; ++i)
+    {
+      for(int l=0; l<N; ++l)
+      {
+        const double e = (std::max)((std::max)((b.min)(i) - p[i][l], p[i][l] - (b.max)(i)), 0.);
+        sq[l] += e * e;
+      }
+    }
+
+    Packet_mask res = 0;
+    for(int l=0; l<N; ++l)
+      if(std::sqrt(sq[l]) <= d_max[l] + conservative_tolerance((std::max)(p_magnitude[l], b_magnitude)))
+        res |= (Packet_mask(1) << l);
+    return res & mask;
+  }
+
+  double squared_distance(const Bbox_3& b, const int lane) const
+  {
+    double sq = 0;
+    for(int i=0; i<3; ++i)
+    {
+      const double e = (std::max)((std::max)((b.min)(i) - p[i][lane], p[i][lane] - (b.max)(i)), 0.);
+      sq += e * e;
+    }
+    return sq;
+  }
+
+  bool left_first(const Bbox_3&, const Bbox_3& left, const Bbox_3& right, const int lane) const
+  {
+    return squared_distance(left, lane) <= squared_distance(right, lane);
+  }
+};
+
+inline int first_lane(const Packet_mask mask)
+{
+  int l = 0;
+  while(!(mask & (Packet_mask(1) << l)))
+    ++l;
+  return l;
+}
+
+/*
+ * Depth-first traversal of the default nodes of `AABB_tree` by a packet.
+ * `leaf(primitive, mask)` is called for the primitives whose parent box
+ * is hit by the queries of `mask`, and must update the bounds of the packet.
+ */
+template <typename Node, typename Packet, typename LeafFunctor>
+void packet_traversal(const Node* root,
+                      const std::size_t nb_primitives,
+                      const Packet_mask mask,
+                      Packet& packet,
+                      LeafFunctor& leaf)
+{
+  struct Entry
+  {
+    const Node* node;
+    std::size_t nb_primitives;
+    Packet_mask mask;
+  };
+
+  std::vector<Entry> stack;
+  stack.reserve(64);
+  stack.push_back(Entry{root, nb_primitives, mask});
+
+  while(!stack.empty())
+  {
+    const Entry e = stack.back();
+    stack.pop_back();
+
+    // the bounds of the queries may have shrunk since the entry was pushed
+    const Packet_mask m = packet.box_test(e.node->bbox(), e.mask);
+    if(m == 0)
+      continue;
+
+    switch(e.nb_primitives)
+    {
+    case 2:
+      leaf(e.node->left_data(), m);
+      leaf(e.node->right_data(), m);
+      break;
+    case 3:
+      leaf(e.node->left_data(), m);
+      stack.push_back(Entry{&(e.node->right_child()), 2, m});
+      break;
+    default:
+    {
+      const std::size_t nb_left = e.nb_primitives/2;
+      const Entry left{&(e.node->left_child()), nb_left, m};
+      const Entry right{&(e.node->right_child()), e.nb_primitives - nb_left, m};
+      // push the far child first, so that the near child is visited first
+      if(packet.left_first(e.node->bbox(), left.node->bbox(), right.node->bbox(), first_lane(m)))
+      {
+        stack.push_back(right);
+        stack.push_back(left);
+      }
+      else
+      {
+        stack.push_back(left);
+        stack.push_back(right);
+      }
+    }
+    }
+  }
+}
+
+// Calls `f(first, size)` on the packets of [0, n[, in parallel if requested
+template <typename F>
+void for_each_packet(const std::size_t n, const F& f, const Sequential_tag&)
+{
+  for(std::size_t first=0; first<n; first+=packet_size)
+    f(first, static_cast<int>((std::min)(n - first, std::size_t(packet_size))));
+}
+
+#ifdef CGAL_LINKED_WITH_TBB
+template <typename F>
+void for_each_packet(const std::size_t n, const F& f, const Parallel_tag&)
+{
+  const std::size_t nb_packets = (n + packet_size - 1) / packet_size;
+  tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_packets),
+                    [&](const tbb::blocked_range<std::size_t>& r)
+                    {
+                      for(std::size_t i = r.begin(); i != r.end(); ++i)
+                      {
+                        const std::size_t first = i * packet_size;
+                        f(first, static_cast<int>((std::min)(n - first, std::size_t(packet_size))));
+                      }
+                    });
+}
+#endif
+
+} // namespace AABB_tree
+} // namespace internal
+
+template <typename Tr>
+template <typename ConcurrencyTag, typename RayRange, typename OutputIterator>
+OutputIterator
+AABB_tree<Tr>::first_intersections(const RayRange& rays, OutputIterator out) const
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  CGAL_static_assertion_msg (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                             "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+  namespace AT = internal::AABB_tree;
+  typedef typename std::iterator_traits<typename RayRange::const_iterator>::value_type Ray;
+  CGAL_static_assertion_msg((boost::is_same<Ray, typename Tr::Ray_3>::value),
+                            "Ray and Ray_3 must be the same type");
+  typedef typename Intersection_and_primitive_id<Ray>::Type Result;
+  typedef AABB_ray_intersection<Self, decltype(boost::lambda::constant(false))> Ray_intersection;
+  typedef typename Ray_intersection::as_ray_param_visitor Param_visitor;
+
+  const std::vector<Ray> queries(rays.begin(), rays.end());
+  std::vector<boost::optional<Result> > results(queries.size());
+  if(queries.empty())
+    return out;
+
+  const bool use_packets = (size() > 1) && !Use_compact_nodes::value;
+  if(size() > 1)
+    build_if_needed();
+
+  AT::for_each_packet(queries.size(),
+    [&](const std::size_t first, const int n)
+    {
+      if(!use_packets)
+      {
+        for(int l=0; l<n; ++l)
+          results[first + l] = first_intersection(queries[first + l]);
+        return;
+      }
+
+      AT::Ray_packet<AT::packet_size> packet;
+      std::array<FT, AT::packet_size> best_t;
+      for(int l=0; l<AT::packet_size; ++l)
+        packet.set(l, queries[first + (std::min)(l, n - 1)]);
+
+      const typename Tr::Intersection intersection = traits().intersection_object();
+      auto leaf = [&](const Primitive& pr, const AT::Packet_mask mask)
+      {
+        for(int l=0; l<n; ++l)
+        {
+          if(!(mask & (AT::Packet_mask(1) << l)))
+            continue;
+          const Ray& ray = queries[first + l];
+          boost::optional<Result> inter = intersection(ray, pr);
+          if(!inter)
+            continue;
+          Param_visitor param_visitor(&ray);
+          const FT t = boost::apply_visitor(param_visitor, inter->first);
+          if(!results[first + l] || t < best_t[l])
+          {
+            best_t[l] = t;
+            results[first + l] = inter;
+            packet.update_bound(l, t);
+          }
+        }
+      };
+
+      AT::packet_traversal(m_nodes.data(), size(), AT::full_packet_mask<AT::packet_size>(n), packet, leaf);
+    },
+    ConcurrencyTag());
+
+  return std::copy(results.begin(), results.end(), out);
+}
+
+template <typename Tr>
+template <typename ConcurrencyTag, typename PointRange, typename OutputIterator>
+OutputIterator
+AABB_tree<Tr>::closest_points_and_primitives(const PointRange& points, OutputIterator out) const
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  CGAL_static_assertion_msg (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                             "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+  CGAL_precondition(!empty());
+  namespace AT = internal::AABB_tree;
+
+  const std::vector<Point> queries(points.begin(), points.end());
+  std::vector<Point_and_primitive_id> results(queries.size());
+  if(queries.empty())
+    return out;
+
+  const bool use_packets = (size() > 1) && !Use_compact_nodes::value;
+  if(size() > 1)
+    build_if_needed();
+
+  AT::for_each_packet(queries.size(),
+    [&](const std::size_t first, const int n)
+    {
+      // the lazy construction of the search tree by `best_hint()` is thread-safe
+      for(int l=0; l<n; ++l)
+        results[first + l] = best_hint(queries[first + l]);
+
+      if(!use_packets)
+      {
+        for(int l=0; l<n; ++l)
+          results[first + l] = closest_point_and_primitive(queries[first + l], results[first + l]);
+        return;
+      }
+
+      const typename Tr::Closest_point closest_point = traits().closest_point_object();
+      const typename Tr::Squared_distance squared_distance = traits().squared_distance_object();
+      const typename Tr::Equal_3 equal = traits().equal_3_object();
+
+      AT::Point_packet<AT::packet_size> packet;
+      for(int l=0; l<AT::packet_size; ++l)
+        packet.set(l, queries[first + (std::min)(l, n - 1)]);
+      for(int l=0; l<n; ++l)
+        packet.update_bound(l, squared_distance(queries[first + l], results[first + l].first));
+
+      auto leaf = [&](const Primitive& pr, const AT::Packet_mask mask)
+      {
+        for(int l=0; l<n; ++l)
+        {
+          if(!(mask & (AT::Packet_mask(1) << l)))
+            continue;
+          Point_and_primitive_id& res = results[first + l];
+          const Point new_closest_point = closest_point(queries[first + l], pr, res.first);
+          if(!equal(new_closest_point, res.first))
+          {
+            res = Point_and_primitive_id(new_closest_point, pr.id());
+            packet.update_bound(l, squared_distance(queries[first + l], new_closest_point));
+          }
+        }
+      };
+
+      AT::packet_traversal(m_nodes.data(), size(), AT::full_packet_mask<AT::packet_size>(n), packet, leaf);
+    },
+    ConcurrencyTag());
+
+  return std::copy(results.begin(), results.end(), out);
+}
+
+template <typename Tr>
+template <typename ConcurrencyTag, typename PointRange, typename OutputIterator>
+OutputIterator
+AABB_tree<Tr>::closest_points(const PointRange& points, OutputIterator out) const
+{
+  std::vector<Point_and_primitive_id> results;
+  results.reserve(std::distance(points.begin(), points.end()));
+  closest_points_and_primitives<ConcurrencyTag>(points, std::back_inserter(results));
+  for(const Point_and_primitive_id& r : results)
+    *out++ = r.first;
+  return out;
+}
+
+} // namespace CGAL
+
+#endif // CGAL_AABB_TREE_INTERNAL_AABB_PACKET_TRAVERSAL_H
@@ -45,6 +45,18 @@ public:
 
   boost::optional< Ray_intersection_and_primitive_id >
   ray_intersection(const Ray& query, SkipFunctor skip) const {
+    return ray_intersection(query, skip, typename AABBTree::Use_compact_nodes());
+  }
+
+private:
+  boost::optional< Ray_intersection_and_primitive_id >
+  ray_intersection(const Ray& query, SkipFunctor skip, Tag_true) const {
+    return tree_.compact_nodes().template ray_intersection<Ray, Ray_intersection_and_primitive_id>(
+      tree_.m_primitives, tree_.traits(), query, skip, as_ray_param_visitor(&query));
+  }
+
+  boost::optional< Ray_intersection_and_primitive_id >
+  ray_intersection(const Ray& query, SkipFunctor skip, Tag_false) const {
     // We hit the root, now continue on the children. Keep track of
     // nb_primitives through a variable in each Node on the stack. In
     // BVH_node::traversal this is done through the function parameter
@@ -163,6 +175,8 @@ private:
     bool operator>(const Node_ptr_with_ft& other) const { return value > other.value; }
   };
 
+public:
+  // computes the parameter along the ray of an intersection
   struct as_ray_param_visitor {
     typedef FT result_type;
     as_ray_param_visitor(const Ray* ray)
@@ -211,7 +225,7 @@ AABB_tree<AABBTraits>::first_intersection(const Ray& query,
   case 1: // Tree has 1 node, intersect directly
     return traits().intersection_object()(query, singleton_data());
   default: // Tree has >= 2 nodes
-    if(traits().do_intersect_object()(query, root_node()->bbox())) {
+    if(traits().do_intersect_object()(query, bbox())) {
       AABB_ray_intersection< AABB_tree<AABBTraits>, SkipFunctor > ri(*this);
       return ri.ray_intersection(query, skip);
     } else {
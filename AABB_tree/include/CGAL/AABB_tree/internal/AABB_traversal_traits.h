@@ -85,7 +85,9 @@ public:
     m_result = m_traits.intersection_object()(query, primitive);
   }
 
-  bool do_intersect(const Query& query, const Node& node) const
+  // `NodeType` is `Node`, or the view of a node of a tree with compact nodes
+  template <class NodeType>
+  bool do_intersect(const Query& query, const NodeType& node) const
   {
     return m_traits.do_intersect_object()(query, node.bbox());
   }
@@ -133,7 +135,8 @@ public:
     }
   }
 
-  bool do_intersect(const Query& query, const Node& node) const
+  template <class NodeType>
+  bool do_intersect(const Query& query, const NodeType& node) const
   {
     return m_traits.do_intersect_object()(query, node.bbox());
   }
@@ -173,7 +176,8 @@ public:
     }
   }
 
-  bool do_intersect(const Query& query, const Node& node) const
+  template <class NodeType>
+  bool do_intersect(const Query& query, const NodeType& node) const
   {
     return m_traits.do_intersect_object()(query, node.bbox());
   }
@@ -216,7 +220,8 @@ public:
     }
   }
 
-  bool do_intersect(const Query& query, const Node& node) const
+  template <class NodeType>
+  bool do_intersect(const Query& query, const NodeType& node) const
   {
     return m_traits.do_intersect_object()(query, node.bbox());
   }
@@ -258,7 +263,8 @@ public:
       m_is_found = true;
   }
 
-  bool do_intersect(const Query& query, const Node& node) const
+  template <class NodeType>
+  bool do_intersect(const Query& query, const NodeType& node) const
   {
     return m_traits.do_intersect_object()(query, node.bbox());
   }
@@ -308,7 +314,8 @@ public:
     }
   }
 
-  bool do_intersect(const Point& query, const Node& node) const
+  template <class NodeType>
+  bool do_intersect(const Point& query, const NodeType& node) const
   {
     return m_traits.compare_distance_object()
       (query, node.bbox(), m_closest_point) == CGAL::SMALLER;
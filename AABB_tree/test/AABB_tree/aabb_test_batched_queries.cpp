@@ -0,0 +1,146 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits.h>
+#include <CGAL/AABB_traits_with_compact_nodes.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Random.h>
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cassert>
+
+template <typename K, typename Traits>
+void test(const char* filename)
+{
+  typedef typename K::Point_3 Point;
+  typedef typename K::Vector_3 Vector;
+  typedef typename K::Ray_3 Ray;
+  typedef CGAL::Surface_mesh<Point> Mesh;
+  typedef CGAL::AABB_tree<Traits> Tree;
+  typedef typename Tree::template Intersection_and_primitive_id<Ray>::Type Ray_intersection;
+  typedef typename Tree::Point_and_primitive_id Point_and_primitive_id;
+
+  Mesh mesh;
+  std::ifstream in(filename);
+  assert(in);
+  in >> mesh;
+
+  Tree tree(faces(mesh).first, faces(mesh).second, mesh);
+
+  // coherent rays: a pinhole camera looking at the mesh, and points on a grid
+  CGAL::Random rnd(0);
+  const CGAL::Bbox_3 bb = tree.bbox();
+  const Point eye(bb.xmin() - (bb.xmax() - bb.xmin()), (bb.ymin() + bb.ymax()) / 2, (bb.zmin() + bb.zmax()) / 2);
+  std::vector<Ray> rays;
+  std::vector<Point> points;
+  for(int i=0; i<40; ++i)
+  {
+    for(int j=0; j<40; ++j)
+    {
+      const Point target(bb.xmax(),
+                         bb.ymin() + (i + 0.5) * (bb.ymax() - bb.ymin()) / 40,
+                         bb.zmin() + (j + 0.5) * (bb.zmax() - bb.zmin()) / 40);
+      rays.push_back(Ray(eye, target));
+      points.push_back(target + Vector(rnd.get_double(-0.1, 0.1), 0, 0));
+    }
+  }
+
+  std::vector<boost::optional<Ray_intersection> > intersections;
+  tree.first_intersections(rays, std::back_inserter(intersections));
+  assert(intersections.size() == rays.size());
+
+  std::vector<Point_and_primitive_id> closest;
+  tree.closest_points_and_primitives(points, std::back_inserter(closest));
+  assert(closest.size() == points.size());
+
+  std::size_t nb_hits = 0;
+  for(std::size_t i=0; i<rays.size(); ++i)
+  {
+    const boost::optional<Ray_intersection> reference = tree.first_intersection(rays[i]);
+    assert(bool(reference) == bool(intersections[i]));
+    if(reference)
+    {
+      ++nb_hits;
+      const Point* p = boost::get<Point>(&(intersections[i]->first));
+      const Point* q = boost::get<Point>(&(reference->first));
+      assert(p != nullptr && q != nullptr);
+      assert(CGAL::squared_distance(*p, *q) < 1e-20);
+    }
+
+    const double d = CGAL::to_double(CGAL::squared_distance(points[i], closest[i].first));
+    const double reference_d = CGAL::to_double(tree.squared_distance(points[i]));
+    assert(CGAL::abs(d - reference_d) <= 1e-12 * (1 + reference_d));
+  }
+  assert(nb_hits > 0);
+
+  std::vector<Point> closest_points;
+  tree.template closest_points<CGAL::Parallel_if_available_tag>(points, std::back_inserter(closest_points));
+  assert(closest_points.size() == points.size());
+  for(std::size_t i=0; i<points.size(); ++i)
+    assert(closest_points[i] == closest[i].first);
+
+  std::vector<boost::optional<Ray_intersection> > parallel_intersections;
+  tree.template first_intersections<CGAL::Parallel_if_available_tag>(rays, std::back_inserter(parallel_intersections));
+  for(std::size_t i=0; i<rays.size(); ++i)
+    assert(bool(parallel_intersections[i]) == bool(intersections[i]));
+}
+
+// Rays from near the origin that touch, far from the origin, a corner of the bounding
+// box of two triangles. The direction of the rays is rounded when the packets
+// are filled, and the box test must still be as permissive as the exact predicates
+template <typename K, typename Traits>
+void test_large_coordinates()
+{
+  typedef typename K::Point_3 Point;
+  typedef typename K::Vector_3 Vector;
+  typedef typename K::Ray_3 Ray;
+  typedef CGAL::Surface_mesh<Point> Mesh;
+  typedef CGAL::AABB_tree<Traits> Tree;
+  typedef typename Tree::template Intersection_and_primitive_id<Ray>::Type Ray_intersection;
+
+  CGAL::Random rnd(0);
+  for(int i=0; i<500; ++i)
+  {
+    const double scale = std::pow(10., rnd.get_int(3, 10));
+    const Point c(scale * rnd.get_double(0.5, 1), scale * rnd.get_double(0.5, 1), scale * rnd.get_double(0.5, 1));
+    const double w = 1e-3 * scale;
+
+    // the triangles are in the half-spaces x >= c.x and y <= c.y, which the ray only reaches at `c`
+    Mesh mesh;
+    const typename Mesh::Vertex_index v0 = mesh.add_vertex(c);
+    mesh.add_face(v0, mesh.add_vertex(c + Vector(w, 0, 0)), mesh.add_vertex(c + Vector(0, -w, w)));
+    mesh.add_face(v0, mesh.add_vertex(c + Vector(w, -w, 0)), mesh.add_vertex(c + Vector(0, -w, -w)));
+    Tree tree(faces(mesh).first, faces(mesh).second, mesh);
+
+    const std::vector<Ray> rays(1, Ray(Point(rnd.get_double(-1, 1), rnd.get_double(-1, 1), rnd.get_double(-1, 1)), c));
+    std::vector<boost::optional<Ray_intersection> > intersections;
+    tree.first_intersections(rays, std::back_inserter(intersections));
+    assert(tree.first_intersection(rays[0]));
+    assert(intersections[0]);
+  }
+}
+
+int main()
+{
+  typedef CGAL::Epick K;
+  typedef CGAL::Surface_mesh<K::Point_3> Mesh;
+  typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+  typedef CGAL::AABB_traits<K, Primitive> Traits;
+
+  typedef CGAL::Epeck EK;
+  typedef CGAL::Surface_mesh<EK::Point_3> EMesh;
+  typedef CGAL::AABB_face_graph_triangle_primitive<EMesh> EPrimitive;
+  typedef CGAL::AABB_traits<EK, EPrimitive> ETraits;
+
+  const std::string filename = CGAL::data_file_path("meshes/elephant.off");
+  test<K, Traits>(filename.c_str());
+  test<K, CGAL::AABB_traits_with_compact_nodes<Traits> >(filename.c_str());
+  test<EK, ETraits>(CGAL::data_file_path("meshes/tetrahedron.off").c_str());
+  test_large_coordinates<EK, ETraits>();
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
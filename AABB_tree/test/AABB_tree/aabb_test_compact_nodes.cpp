@@ -0,0 +1,89 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits.h>
+#include <CGAL/AABB_traits_with_compact_nodes.h>
+#include <CGAL/AABB_traits_with_SAH_split.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Random.h>
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Simple_cartesian<double> K;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Segment_3 Segment;
+typedef K::Ray_3 Ray;
+typedef CGAL::Surface_mesh<Point> Mesh;
+
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+
+template <typename Compact_traits>
+void test(const Mesh& mesh, const Tree& reference)
+{
+  typedef CGAL::AABB_tree<Compact_traits> Compact_tree;
+  Compact_tree tree(faces(mesh).first, faces(mesh).second, mesh);
+  tree.template build<CGAL::Parallel_if_available_tag>();
+
+  assert(tree.bbox() == reference.bbox());
+  assert(tree.compact_nodes().number_of_nodes() == tree.size() - 1);
+
+  CGAL::Random rnd(0);
+  const CGAL::Bbox_3 bb = reference.bbox();
+  auto random_point = [&]()
+  {
+    return Point(rnd.get_double(bb.xmin() - 0.1, bb.xmax() + 0.1),
+                 rnd.get_double(bb.ymin() - 0.1, bb.ymax() + 0.1),
+                 rnd.get_double(bb.zmin() - 0.1, bb.zmax() + 0.1));
+  };
+
+  for(int i=0; i<500; ++i)
+  {
+    const Point p = random_point(), q = random_point();
+    const Segment s(p, q);
+    const Ray r(p, q);
+
+    assert(tree.do_intersect(s) == reference.do_intersect(s));
+    assert(tree.number_of_intersected_primitives(s) == reference.number_of_intersected_primitives(s));
+
+    std::vector<typename Compact_tree::Primitive_id> ids, reference_ids;
+    tree.all_intersected_primitives(r, std::back_inserter(ids));
+    reference.all_intersected_primitives(r, std::back_inserter(reference_ids));
+    std::sort(ids.begin(), ids.end());
+    std::sort(reference_ids.begin(), reference_ids.end());
+    assert(ids == reference_ids);
+
+    auto first = tree.first_intersected_primitive(r);
+    auto reference_first = reference.first_intersected_primitive(r);
+    assert(bool(first) == bool(reference_first));
+
+    // the traversal order differs, so points on shared edges may be computed from different faces
+    const double d = CGAL::squared_distance(p, tree.closest_point_and_primitive(p).first);
+    const double reference_d = reference.squared_distance(p);
+    assert(CGAL::abs(d - reference_d) <= 1e-12 * (1 + reference_d));
+  }
+}
+
+int main()
+{
+  Mesh mesh;
+  std::ifstream in(CGAL::data_file_path("meshes/elephant.off"));
+  assert(in);
+  in >> mesh;
+  assert(num_faces(mesh) > 0);
+
+  Tree reference(faces(mesh).first, faces(mesh).second, mesh);
+  reference.build();
+
+  test<CGAL::AABB_traits_with_compact_nodes<Traits> >(mesh, reference);
+  test<CGAL::AABB_traits_with_compact_nodes<Traits, std::uint16_t> >(mesh, reference);
+  test<CGAL::AABB_traits_with_SAH_split<CGAL::AABB_traits_with_compact_nodes<Traits, std::uint16_t> > >(mesh, reference);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,92 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits.h>
+#include <CGAL/AABB_traits_with_SAH_split.h>
+#include <CGAL/AABB_triangle_primitive.h>
+#include <CGAL/Random.h>
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Simple_cartesian<double> K;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Segment_3 Segment;
+typedef K::Triangle_3 Triangle;
+
+typedef std::vector<Triangle>::const_iterator Iterator;
+typedef CGAL::AABB_triangle_primitive<K, Iterator> Primitive;
+typedef CGAL::AABB_traits<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+typedef CGAL::AABB_traits_with_SAH_split<Traits> SAH_traits;
+typedef CGAL::AABB_tree<SAH_traits> SAH_tree;
+
+// Elongated triangles on a thin slab, the kind of input where
+// the longest axis of a box is a poor split axis.
+void generate_triangles(std::vector<Triangle>& triangles, std::size_t n, CGAL::Random& rnd)
+{
+  for(std::size_t i=0; i<n; ++i)
+  {
+    Point p(rnd.get_double(0, 10), rnd.get_double(0, 1), rnd.get_double(0, 0.1));
+    Vector u(rnd.get_double(-0.5, 0.5), rnd.get_double(-0.01, 0.01), 0);
+    Vector v(rnd.get_double(-0.01, 0.01), rnd.get_double(-0.05, 0.05), rnd.get_double(0, 0.01));
+    triangles.push_back(Triangle(p, p + u, p + v));
+  }
+}
+
+template <typename Tree_1, typename Tree_2>
+void compare_queries(const Tree_1& tree_1, const Tree_2& tree_2, CGAL::Random& rnd)
+{
+  assert(tree_1.bbox() == tree_2.bbox());
+  for(int i=0; i<200; ++i)
+  {
+    Point p(rnd.get_double(-1, 11), rnd.get_double(-1, 2), rnd.get_double(-1, 1));
+    Point q(rnd.get_double(-1, 11), rnd.get_double(-1, 2), rnd.get_double(-1, 1));
+    Segment s(p, q);
+    assert(tree_1.number_of_intersected_primitives(s) == tree_2.number_of_intersected_primitives(s));
+    assert(tree_1.squared_distance(p) == tree_2.squared_distance(p));
+  }
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  std::vector<Triangle> triangles;
+  generate_triangles(triangles, 20000, rnd);
+
+  Tree sequential_tree(triangles.begin(), triangles.end());
+  sequential_tree.build<CGAL::Sequential_tag>();
+
+  Tree default_tree(triangles.begin(), triangles.end());
+  default_tree.build();
+  compare_queries(sequential_tree, default_tree, rnd);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  Tree parallel_tree(triangles.begin(), triangles.end());
+  parallel_tree.build<CGAL::Parallel_tag>();
+  compare_queries(sequential_tree, parallel_tree, rnd);
+
+  // the parallel construction must produce exactly the same boxes
+  assert(parallel_tree.root_node()->left_child().bbox() ==
+         sequential_tree.root_node()->left_child().bbox());
+  assert(parallel_tree.root_node()->right_child().bbox() ==
+         sequential_tree.root_node()->right_child().bbox());
+#endif
+
+  SAH_tree sah_tree(triangles.begin(), triangles.end());
+  sah_tree.build<CGAL::Parallel_if_available_tag>();
+  compare_queries(sequential_tree, sah_tree, rnd);
+
+  // small and degenerate inputs
+  for(std::size_t n=2; n<8; ++n)
+  {
+    std::vector<Triangle> few(n, triangles.front());
+    SAH_tree tree(few.begin(), few.end());
+    tree.build<CGAL::Parallel_if_available_tag>();
+    assert(tree.number_of_intersected_primitives(tree.bbox()) == n);
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
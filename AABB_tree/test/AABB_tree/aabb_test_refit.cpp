@@ -0,0 +1,173 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/AABB_traits.h>
+#include <CGAL/AABB_traits_with_compact_nodes.h>
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Random.h>
+
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <cmath>
+#include <cassert>
+
+typedef CGAL::Simple_cartesian<double> K;
+typedef K::Point_3 Point;
+typedef K::Vector_3 Vector;
+typedef K::Segment_3 Segment;
+typedef K::Ray_3 Ray;
+typedef CGAL::Surface_mesh<Point> Mesh;
+
+typedef CGAL::AABB_face_graph_triangle_primitive<Mesh> Primitive;
+typedef CGAL::AABB_traits<K, Primitive> Traits;
+typedef CGAL::AABB_tree<Traits> Tree;
+
+// twists the mesh around the z-axis
+void twist(Mesh& mesh, const double angle)
+{
+  for(Mesh::Vertex_index v : vertices(mesh))
+  {
+    const Point& p = mesh.point(v);
+    const double a = angle * p.z();
+    mesh.point(v) = Point(std::cos(a) * p.x() - std::sin(a) * p.y(),
+                          std::sin(a) * p.x() + std::cos(a) * p.y(),
+                          p.z());
+  }
+}
+
+// moves randomly a part of the vertices across the mesh
+void scramble(Mesh& mesh, CGAL::Random& rnd)
+{
+  std::vector<Mesh::Vertex_index> vs(vertices(mesh).begin(), vertices(mesh).end());
+  for(std::size_t i=0; i<vs.size()/10; ++i)
+    std::swap(mesh.point(vs[rnd.get_int(0, int(vs.size()))]),
+              mesh.point(vs[rnd.get_int(0, int(vs.size()))]));
+}
+
+template <typename Tree_1>
+void compare_queries(const Tree_1& tree, const Mesh& mesh, CGAL::Random& rnd)
+{
+  Tree reference(faces(mesh).first, faces(mesh).second, mesh);
+  reference.build();
+  assert(tree.size() == reference.size());
+
+  const CGAL::Bbox_3 bb = reference.bbox();
+  const CGAL::Bbox_3 tree_bb = tree.bbox();
+  for(int i=0; i<3; ++i)
+  {
+    assert((tree_bb.min)(i) <= (bb.min)(i));
+    assert((tree_bb.max)(i) >= (bb.max)(i));
+  }
+
+  auto random_point = [&]()
+  {
+    return Point(rnd.get_double(bb.xmin() - 0.1, bb.xmax() + 0.1),
+                 rnd.get_double(bb.ymin() - 0.1, bb.ymax() + 0.1),
+                 rnd.get_double(bb.zmin() - 0.1, bb.zmax() + 0.1));
+  };
+
+  for(int i=0; i<200; ++i)
+  {
+    const Point p = random_point(), q = random_point();
+    const Segment s(p, q);
+    const Ray r(p, q);
+
+    assert(tree.number_of_intersected_primitives(s) == reference.number_of_intersected_primitives(s));
+    assert(bool(tree.first_intersected_primitive(r)) == bool(reference.first_intersected_primitive(r)));
+
+    const double d = CGAL::squared_distance(p, tree.closest_point_and_primitive(p).first);
+    const double reference_d = reference.squared_distance(p);
+    assert(CGAL::abs(d - reference_d) <= 1e-12 * (1 + reference_d));
+  }
+}
+
+template <typename Test_traits>
+void test(const Mesh& input)
+{
+  typedef CGAL::AABB_tree<Test_traits> Test_tree;
+  CGAL::Random rnd(0);
+  Mesh mesh = input;
+
+  Test_tree tree(faces(mesh).first, faces(mesh).second, mesh);
+  tree.build();
+  tree.accelerate_distance_queries();
+
+  // smooth deformations
+  for(int i=1; i<=3; ++i)
+  {
+    twist(mesh, 0.5);
+    tree.template refit<CGAL::Parallel_if_available_tag>();
+    compare_queries(tree, mesh, rnd);
+  }
+
+  // large deformations: degraded subtrees are rebuilt
+  scramble(mesh, rnd);
+  const std::size_t nb_rebuilt = tree.template refit<CGAL::Parallel_if_available_tag>(1.2);
+  std::cout << nb_rebuilt << " subtrees rebuilt" << std::endl;
+  compare_queries(tree, mesh, rnd);
+
+  twist(mesh, -1.);
+  assert(tree.refit() == 0);
+  compare_queries(tree, mesh, rnd);
+
+  // refit() builds the tree if needed
+  Test_tree new_tree(faces(mesh).first, faces(mesh).second, mesh);
+  assert(new_tree.refit() == 0);
+  compare_queries(new_tree, mesh, rnd);
+}
+
+int main()
+{
+  Mesh mesh;
+  std::ifstream in(CGAL::data_file_path("meshes/elephant.off"));
+  assert(in);
+  in >> mesh;
+  assert(num_faces(mesh) > 0);
+
+  test<Traits>(mesh);
+  test<CGAL::AABB_traits_with_compact_nodes<Traits> >(mesh);
+  test<CGAL::AABB_traits_with_compact_nodes<Traits, std::uint16_t> >(mesh);
+
+  // the scrambled subtrees must be rebuilt
+  {
+    Mesh scrambled = mesh;
+    Tree tree(faces(scrambled).first, faces(scrambled).second, scrambled);
+    tree.build();
+    CGAL::Random rnd(1);
+    scramble(scrambled, rnd);
+    assert(tree.refit<CGAL::Parallel_if_available_tag>(1.2) > 0);
+    compare_queries(tree, scrambled, rnd);
+  }
+
+  // the children of the root are flat: a tiny deformation must not trigger a rebuild
+  {
+    Mesh lines;
+    for(int l=0; l<2; ++l)
+    {
+      for(int i=0; i<16; ++i)
+      {
+        // degenerate triangles along two lines parallel to the x-axis
+        const double y = 100 * l;
+        lines.add_face(lines.add_vertex(Point(i, y, 0)),
+                       lines.add_vertex(Point(i + 0.5, y, 0)),
+                       lines.add_vertex(Point(i + 1, y, 0)));
+      }
+    }
+    Tree tree(faces(lines).first, faces(lines).second, lines);
+    tree.build();
+    assert(tree.refit(1.2) == 0);
+
+    lines.point(*(vertices(lines).begin())) = Point(0, 0, 1e-9);
+    assert(tree.refit(1.2) == 0);
+    CGAL::Random rnd(2);
+    compare_queries(tree, lines, rnd);
+
+    // the cost of the root is compared to the mean cost of the tree, which it does not exceed
+    lines.point(*(vertices(lines).begin())) = Point(0, 50, 0);
+    assert(tree.refit(1.2) == 0);
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,89 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/alpha_wrap_3.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+#include <CGAL/Real_timer.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace AW3 = CGAL::Alpha_wraps_3;
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+using K = CGAL::Exact_predicates_inexact_constructions_kernel;
+using Point_3 = K::Point_3;
+
+using Mesh = CGAL::Surface_mesh<Point_3>;
+
+int main(int argc, char** argv)
+{
+  std::cout.precision(17);
+
+  // Read the input
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/armadillo.off");
+  std::cout << "Reading " << filename << "..." << std::endl;
+
+  Mesh input;
+  if(!PMP::IO::read_polygon_mesh(filename, input) ||
+     is_empty(input) || !is_triangle_mesh(input))
+  {
+    std::cerr << "Invalid input." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Input: " << num_vertices(input) << " vertices, " << num_faces(input) << " faces" << std::endl;
+
+  // Compute the alpha and offset values
+  CGAL::Bbox_3 bbox = CGAL::Polygon_mesh_processing::bbox(input);
+  const double diag_length = std::sqrt(CGAL::square(bbox.xmax() - bbox.xmin()) +
+                                       CGAL::square(bbox.ymax() - bbox.ymin()) +
+                                       CGAL::square(bbox.zmax() - bbox.zmin()));
+
+  // The offset is the one of the finest level and is kept for all levels,
+  // such that the Steiner points inserted for coarse levels are close to the input
+  const double relative_offset = 1200.;
+  const double offset = diag_length / relative_offset;
+
+  // From the coarsest to the finest level of detail
+  const std::vector<double> relative_alphas = { 5., 10., 20., 40., 80. };
+
+  // The oracle (and its AABB tree) is built once, and shared by all the levels
+  using Oracle = AW3::internal::Triangle_mesh_oracle<K>;
+  Oracle oracle;
+  oracle.add_triangle_mesh(input);
+
+  AW3::internal::Alpha_wrap_3<Oracle> aw3(oracle);
+
+  std::string input_name = std::string(filename);
+  input_name = input_name.substr(input_name.find_last_of("/") + 1, input_name.length() - 1);
+  input_name = input_name.substr(0, input_name.find_last_of("."));
+
+  CGAL::Real_timer t;
+  t.start();
+
+  for(const double relative_alpha : relative_alphas)
+  {
+    const double alpha = diag_length / relative_alpha;
+
+    // Each level refines the triangulation of the previous level instead of starting from scratch
+    Mesh wrap;
+    aw3(alpha, offset, wrap, CGAL::parameters::refine_triangulation(true));
+
+    std::cout << "Level " << relative_alpha << ": " << num_vertices(wrap) << " vertices, "
+              << num_faces(wrap) << " faces (" << t.time() << " s.)" << std::endl;
+
+    // Save the result
+    std::string output_name = input_name + "_" + std::to_string(static_cast<int>(relative_alpha))
+                              + "_" + std::to_string(static_cast<int>(relative_offset)) + ".off";
+    std::cout << "Writing to " << output_name << std::endl;
+    CGAL::IO::write_polygon_mesh(output_name, wrap, CGAL::parameters::stream_precision(17));
+  }
+
+  t.stop();
+  std::cout << "Took " << t.time() << " s." << std::endl;
+
+  return EXIT_SUCCESS;
+}
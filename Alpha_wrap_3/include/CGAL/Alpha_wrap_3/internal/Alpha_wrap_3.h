@@ -57,6 +57,18 @@
 #include <CGAL/Delaunay_triangulation_cell_base_with_circumcenter_3.h>
 #include <CGAL/Triangulation_vertex_base_with_info_3.h>
 #include <CGAL/Robust_weighted_circumcenter_filtered_traits_3.h>
+#include <CGAL/tags.h>
+#include <CGAL/use.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <CGAL/Spatial_lock_grid_3.h>
+# include <tbb/blocked_range.h>
+# include <tbb/enumerable_thread_specific.h>
+# include <tbb/parallel_for.h>
+# include <tbb/spin_mutex.h>
+# include <tbb/task_arena.h>
+# include <atomic>
+#endif
 
 #include <array>
 #include <algorithm>
@@ -99,6 +111,34 @@ public:
   };
 };
 
+#ifdef CGAL_LINKED_WITH_TBB
+// Erase counter (cf. Concurrent_compact_container), used in the parallel mode
+// to detect that a cell has been destroyed by another thread
+template <typename Cb>
+class Cell_base_with_erase_counter
+  : public Cb
+{
+  std::atomic<unsigned int> erase_counter_;
+
+public:
+  template <typename... Args>
+  Cell_base_with_erase_counter(const Args&... args) : Cb(args...), erase_counter_(0) { }
+
+  Cell_base_with_erase_counter(const Cell_base_with_erase_counter& other) : Cb(other), erase_counter_(other.erase_counter()) { }
+
+  unsigned int erase_counter() const { return erase_counter_.load(); }
+  void set_erase_counter(unsigned int c) { erase_counter_.store(c); }
+  void increment_erase_counter() { ++erase_counter_; }
+
+  template <class TDS>
+  struct Rebind_TDS
+  {
+    typedef typename Cb::template Rebind_TDS<TDS>::Other Cb2;
+    typedef Cell_base_with_erase_counter<Cb2> Other;
+  };
+};
+#endif
+
 struct Wrapping_default_visitor
 {
   Wrapping_default_visitor() { }
@@ -125,7 +165,9 @@ struct Wrapping_default_visitor
   void on_alpha_wrapping_end(const AlphaWrapper&) { };
 };
 
-template <typename Oracle>
+// With `ConcurrencyTag` being `Parallel_tag`, the gates are treated concurrently
+// (see `treat_gates_in_parallel()`).
+template <typename Oracle, typename ConcurrencyTag = Sequential_tag>
 class Alpha_wrap_3
 {
   using Base_GT = typename Oracle::Geom_traits;
@@ -146,6 +188,9 @@ class Alpha_wrap_3
   struct Cell_info
   {
     bool is_outside = false;
+
+    // outside cells that were tagged inside to enforce manifoldness (see make_manifold())
+    bool is_manifold_filler = false;
   };
 
   enum Vertex_info
@@ -161,8 +206,26 @@ class Alpha_wrap_3
   using Cb = Delaunay_triangulation_cell_base_with_circumcenter_3<Geom_traits, Cbb>;
   using Cbi = Triangulation_cell_base_with_info_3<Cell_info, Geom_traits, Cb>;
   using Cbt = Cell_base_with_timestamp<Cbi>;
-  using Tds = Triangulation_data_structure_3<Vbi, Cbt>;
-  using Dt = Delaunay_triangulation_3<Geom_traits, Tds, Fast_location>;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  using Cbc = typename std::conditional<std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                                        Cell_base_with_erase_counter<Cbt>, Cbt>::type;
+  using Lock_data_structure = typename std::conditional<std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                                                        Spatial_lock_grid_3<Tag_priority_blocking>,
+                                                        Default>::type;
+#else
+  CGAL_static_assertion_msg(!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                            "Parallel_tag is enabled but TBB is unavailable.");
+  using Cbc = Cbt;
+  using Lock_data_structure = Default;
+#endif
+
+  // The hierarchy cannot be modified concurrently
+  using Location_policy = typename std::conditional<std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                                                    Default, Fast_location>::type;
+
+  using Tds = Triangulation_data_structure_3<Vbi, Cbc, ConcurrencyTag>;
+  using Dt = Delaunay_triangulation_3<Geom_traits, Tds, Location_policy, Lock_data_structure>;
 
   using Cell_handle = typename Dt::Cell_handle;
   using Facet = typename Dt::Facet;
@@ -261,6 +324,12 @@ public:
 
     const bool do_enforce_manifoldness = choose_parameter(get_parameter(np, internal_np::do_enforce_manifoldness), true);
 
+    // Resume from the triangulation of the previous call, see initialize().
+    // The refinement does not dig cavities, so it cannot be combined with seeds.
+    const bool refining = choose_parameter(get_parameter(np, internal_np::refine_triangulation), false);
+    CGAL_precondition_msg(!refining || seeds.empty(),
+                          "seed_points and refine_triangulation(true) are mutually exclusive");
+
 #ifdef CGAL_AW3_TIMER
     CGAL::Real_timer t;
     t.start();
@@ -268,7 +337,7 @@ public:
 
     visitor.on_alpha_wrapping_begin(*this);
 
-    if(!initialize(alpha, offset, seeds))
+    if(!initialize(alpha, offset, seeds, refining))
       return;
 
 #ifdef CGAL_AW3_DEBUG_DUMP_EVERY_STEP
@@ -649,6 +718,37 @@ private:
     return true;
   }
 
+  // Resume from the state of the triangulation at the end of the previous flood fill:
+  // undo the manifoldness post-processing, and init queue with all the facets
+  // between outside and inside cells, which might have become traversable with a smaller alpha
+  bool initialize_from_existing_triangulation()
+  {
+    for(Cell_handle ch : m_dt.all_cell_handles())
+    {
+      if(ch->info().is_manifold_filler)
+      {
+        ch->info().is_outside = true;
+        ch->info().is_manifold_filler = false;
+      }
+    }
+
+    for(Cell_handle ch : m_dt.all_cell_handles())
+    {
+      if(!ch->info().is_outside)
+        continue;
+
+      for(int i=0; i<4; ++i)
+      {
+        if(m_dt.is_infinite(ch, i) || ch->neighbor(i)->info().is_outside)
+          continue;
+
+        push_facet(std::make_pair(ch, i));
+      }
+    }
+
+    return true;
+  }
+
 public:
   // Manifoldness is tolerated while debugging and extracting at intermediate states
   // Not the preferred way because it uses 3*nv storage
@@ -831,19 +931,34 @@ private:
   {
     CGAL_precondition(!m_dt.is_infinite(neighbor));
 
+    const Point_3& ch_cc = circumcenter(ch);
+    const Point_3& neighbor_cc = circumcenter(neighbor);
+    return compute_steiner_point(ch, ch_cc, neighbor, neighbor_cc, steiner_point);
+  }
+
+  // Since `circumcenter()` caches its result in the cell, the circumcenters are passed
+  // to be able to call this function concurrently.
+  bool compute_steiner_point(const Cell_handle ch,
+                             const Point_3& ch_cc,
+                             const Cell_handle neighbor,
+                             const Point_3& neighbor_cc,
+                             Point_3& steiner_point) const
+  {
+    CGAL_USE(ch);
+    CGAL_precondition(!m_dt.is_infinite(neighbor));
+
     typename Geom_traits::Construct_ball_3 ball = geom_traits().construct_ball_3_object();
     typename Geom_traits::Construct_vector_3 vector = geom_traits().construct_vector_3_object();
     typename Geom_traits::Construct_translated_point_3 translate = geom_traits().construct_translated_point_3_object();
     typename Geom_traits::Construct_scaled_vector_3 scale = geom_traits().construct_scaled_vector_3_object();
 
-    const Point_3& neighbor_cc = circumcenter(neighbor);
     const Ball_3 neighbor_cc_offset_ball = ball(neighbor_cc, m_sq_offset);
     const bool is_neighbor_cc_in_offset = m_oracle.do_intersect(neighbor_cc_offset_ball);
 
 #ifdef CGAL_AW3_DEBUG_STEINER_COMPUTATION
     std::cout << "Compute_steiner_point(" << &*ch << ", " << &*neighbor << ")" << std::endl;
 
-    const Point_3& chc = circumcenter(ch);
+    const Point_3& chc = ch_cc;
     std::cout << "CH" << std::endl;
     std::cout << "\t" << ch->vertex(0)->point() << std::endl;
     std::cout << "\t" << ch->vertex(1)->point() << std::endl;
@@ -865,14 +980,11 @@ private:
 #endif
 
     // ch's circumcenter should not be within the offset volume
-    CGAL_assertion_code(const Point_3& ch_cc = circumcenter(ch);)
     CGAL_assertion_code(const Ball_3 ch_cc_offset_ball = ball(ch_cc, m_sq_offset);)
     CGAL_assertion(!m_oracle.do_intersect(ch_cc_offset_ball));
 
     if(is_neighbor_cc_in_offset)
     {
-      const Point_3& ch_cc = circumcenter(ch);
-
       // If the voronoi edge intersects the offset, the steiner point is the first intersection
       if(m_oracle.first_intersection(ch_cc, neighbor_cc, steiner_point, m_offset))
       {
@@ -1002,11 +1114,75 @@ private:
     return true;
   }
 
+  // Purge the queue of facets that will be deleted/modified by the Steiner point insertion,
+  // and which might have been gates
+  void purge_gates(const std::vector<Cell_handle>& conflict_zone,
+                   const std::vector<Facet>& boundary_facets)
+  {
+    for(const Cell_handle& cch : conflict_zone)
+    {
+      for(int i=0; i<4; ++i)
+      {
+        const Facet cf = std::make_pair(cch, i);
+        if(m_queue.contains_with_bounds_check(Gate(cf)))
+          m_queue.erase(Gate(cf));
+      }
+    }
+
+    for(const Facet& f : boundary_facets)
+    {
+      const Facet mf = m_dt.mirror_facet(f); // boundary facets have incident cells in the CZ
+      if(m_queue.contains_with_bounds_check(Gate(mf)))
+        m_queue.erase(Gate(mf));
+    }
+  }
+
+  void tag_new_cells_and_push_gates(const Vertex_handle vh)
+  {
+    std::vector<Cell_handle> new_cells;
+    new_cells.reserve(32);
+    m_dt.incident_cells(vh, std::back_inserter(new_cells));
+    for(const Cell_handle& ch : new_cells)
+    {
+      // std::cout << "new cell has time stamp " << ch->time_stamp() << std::endl;
+      ch->info().is_outside = m_dt.is_infinite(ch);
+    }
+
+    // Push all new boundary facets to the queue.
+    // It is not performed by looking at the facets on the boundary of the conflict zones
+    // because we need to handle internal facets, infinite facets, and also more subtle changes
+    // such as a new cell being marked inside which now creates a boundary
+    // with its incident "outside" flagged cell.
+    for(Cell_handle ch : new_cells)
+    {
+      for(int i=0; i<4; ++i)
+      {
+        if(m_dt.is_infinite(ch, i))
+          continue;
+
+        const Cell_handle nh = ch->neighbor(i);
+        if(nh->info().is_outside == ch->info().is_outside) // not on the boundary
+          continue;
+
+        const Facet boundary_f = std::make_pair(ch, i);
+        if(ch->info().is_outside)
+          push_facet(boundary_f);
+        else
+          push_facet(m_dt.mirror_facet(boundary_f));
+      }
+    }
+  }
+
 private:
+  // When `refining` is `true` and the previous call used larger (or equal) alpha and offset values,
+  // the outside cells of the previous wrap are also outside for the new values: the triangulation
+  // is kept and the flood fill resumes from the current outside cells. Seeds cannot be given
+  // together with `refining` (see operator()), since the cavities would not be dug.
   template <typename SeedRange>
   bool initialize(const double alpha,
                   const double offset,
-                  const SeedRange& seeds)
+                  const SeedRange& seeds,
+                  const bool refining = false)
   {
 #ifdef CGAL_AW3_DEBUG
     std::cout << "> Initialize..." << std::endl;
@@ -1022,14 +1198,26 @@ private:
       return false;
     }
 
+    const bool can_refine = refining && m_dt.dimension() == 3 &&
+                            FT(alpha) <= m_alpha && FT(offset) <= m_offset;
+
+#ifdef CGAL_AW3_DEBUG
+    if(refining && !can_refine && m_dt.dimension() == 3)
+      std::cout << "Warning: cannot refine the previous wrap, starting from scratch" << std::endl;
+#endif
+
     m_alpha = FT(alpha);
     m_sq_alpha = square(m_alpha);
     m_offset = FT(offset);
     m_sq_offset = square(m_offset);
 
-    m_dt.clear();
     m_queue.clear();
 
+    if(can_refine)
+      return initialize_from_existing_triangulation();
+
+    m_dt.clear();
+
     insert_bbox_corners();
 
     if(seeds.empty())
@@ -1047,6 +1235,9 @@ private:
 
     visitor.on_flood_fill_begin(*this);
 
+    // In parallel, this empties the queue
+    treat_gates_in_parallel(visitor, ConcurrencyTag());
+
     // Explore all finite cells that are reachable from one of the initial outside cells.
     while(!m_queue.empty())
     {
@@ -1116,24 +1307,7 @@ private:
                             std::back_inserter(boundary_facets),
                             std::back_inserter(conflict_zone));
 
-        // Purge the queue of facets that will be deleted/modified by the Steiner point insertion,
-        // and which might have been gates
-        for(const Cell_handle& cch : conflict_zone)
-        {
-          for(int i=0; i<4; ++i)
-          {
-            const Facet cf = std::make_pair(cch, i);
-            if(m_queue.contains_with_bounds_check(Gate(cf)))
-              m_queue.erase(Gate(cf));
-          }
-        }
-
-        for(const Facet& f : boundary_facets)
-        {
-          const Facet mf = m_dt.mirror_facet(f); // boundary facets have incident cells in the CZ
-          if(m_queue.contains_with_bounds_check(Gate(mf)))
-            m_queue.erase(Gate(mf));
-        }
+        purge_gates(conflict_zone, boundary_facets);
 
         visitor.before_Steiner_point_insertion(*this, steiner_point);
 
@@ -1143,38 +1317,7 @@ private:
 
         visitor.after_Steiner_point_insertion(*this, vh);
 
-        std::vector<Cell_handle> new_cells;
-        new_cells.reserve(32);
-        m_dt.incident_cells(vh, std::back_inserter(new_cells));
-        for(const Cell_handle& ch : new_cells)
-        {
-          // std::cout << "new cell has time stamp " << ch->time_stamp() << std::endl;
-          ch->info().is_outside = m_dt.is_infinite(ch);
-        }
-
-        // Push all new boundary facets to the queue.
-        // It is not performed by looking at the facets on the boundary of the conflict zones
-        // because we need to handle internal facets, infinite facets, and also more subtle changes
-        // such as a new cell being marked inside which now creates a boundary
-        // with its incident "outside" flagged cell.
-        for(Cell_handle ch : new_cells)
-        {
-          for(int i=0; i<4; ++i)
-          {
-            if(m_dt.is_infinite(ch, i))
-              continue;
-
-            const Cell_handle nh = ch->neighbor(i);
-            if(nh->info().is_outside == ch->info().is_outside) // not on the boundary
-              continue;
-
-            const Facet boundary_f = std::make_pair(ch, i);
-            if(ch->info().is_outside)
-              push_facet(boundary_f);
-            else
-              push_facet(m_dt.mirror_facet(boundary_f));
-          }
-        }
+        tag_new_cells_and_push_gates(vh);
       }
       else
       {
@@ -1201,6 +1344,255 @@ private:
     CGAL_postcondition_code(})
   }
 
+private:
+  template <typename Visitor>
+  void treat_gates_in_parallel(Visitor&, Sequential_tag) { }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // A gate of a batch, with the erase counters of its cells to detect that they have been
+  // destroyed by the treatment of another gate of the batch, and its Steiner point
+  struct Batch_gate
+  {
+    Gate gate;
+    Cell_handle neighbor;
+    unsigned int ch_erase_counter;
+    unsigned int neighbor_erase_counter;
+    Point_3 ch_cc;
+    Point_3 neighbor_cc;
+    int outside_neighbors; // the Steiner point depends on the outside neighbors of `neighbor`
+    bool has_steiner_point;
+    Point_3 steiner_point;
+  };
+
+  // Sets the point of the infinite vertex and the lock data structure of the triangulation
+  // for the parallel flood fill, and restores them when it goes out of scope,
+  // including when an exception is thrown
+  struct Concurrent_flood_fill_guard
+  {
+    Dt& dt;
+    const Point_3 infinite_point;
+
+    Concurrent_flood_fill_guard(Dt& dt, const Point_3& position, Lock_data_structure& lock_ds)
+      : dt(dt), infinite_point(dt.infinite_vertex()->point())
+    {
+      dt.infinite_vertex()->set_point(position);
+      dt.set_lock_data_structure(&lock_ds);
+    }
+
+    ~Concurrent_flood_fill_guard()
+    {
+      dt.set_lock_data_structure(nullptr);
+      dt.infinite_vertex()->set_point(infinite_point);
+    }
+  };
+
+  static int outside_neighbors(const Cell_handle c)
+  {
+    int mask = 0;
+    for(int i=0; i<4; ++i)
+      if(c->neighbor(i)->info().is_outside)
+        mask |= (1 << i);
+    return mask;
+  }
+
+  // Treats a gate in a triangulation that is concurrently modified by other threads,
+  // as in the sequential loop of `alpha_flood_fill()`.
+  //
+  // The cells are locked with the lock data structure of the triangulation: a cell is only
+  // created, destroyed, or tagged once its four vertices are locked, and the neighbor across
+  // a facet is only modified once the three vertices of the facet are locked. Since any two facets
+  // of a cell share two vertices, a cell is thus stable once one of its facets is locked.
+  //
+  // Returns `false` if a cell could not be locked, in which case nothing has been modified.
+  // The gate is dropped if one of its two cells has been destroyed, as it would have been
+  // purged from the queue by the sequential loop.
+  template <typename Visitor>
+  bool treat_gate_concurrently(Batch_gate& bg,
+                               Visitor& visitor,
+                               tbb::spin_mutex& queue_mutex)
+  {
+    const Cell_handle ch = bg.gate.facet().first;
+    const int id = bg.gate.facet().second;
+
+    if(ch->erase_counter() != bg.ch_erase_counter)
+      return true;
+    if(!m_dt.try_lock_cell(ch))
+      return false;
+    if(ch->erase_counter() != bg.ch_erase_counter)
+      return true;
+
+    const Cell_handle neighbor = ch->neighbor(id);
+    if(neighbor != bg.neighbor || neighbor->erase_counter() != bg.neighbor_erase_counter)
+      return true;
+    if(!m_dt.try_lock_cell(neighbor))
+      return false;
+
+    if(m_dt.is_infinite(neighbor))
+    {
+      neighbor->info().is_outside = true;
+      return true;
+    }
+
+    const int current_outside_neighbors = outside_neighbors(neighbor);
+    if(current_outside_neighbors != bg.outside_neighbors)
+    {
+      bg.outside_neighbors = current_outside_neighbors;
+      bg.has_steiner_point = compute_steiner_point(ch, bg.ch_cc, neighbor, bg.neighbor_cc,
+                                                   bg.steiner_point);
+    }
+
+    if(!bg.has_steiner_point)
+    {
+      // tag neighbor as OUTSIDE
+      neighbor->info().is_outside = true;
+
+      tbb::spin_mutex::scoped_lock lock(queue_mutex);
+      for(int i=0; i<4; ++i)
+        push_facet(std::make_pair(neighbor, i));
+
+      return true;
+    }
+
+    const Point_3& steiner_point = bg.steiner_point;
+
+    // The new vertex must be locked as well as the conflict zone
+    if(!m_dt.try_lock_point(steiner_point))
+      return false;
+
+    bool could_lock_zone = false;
+    int li, lj = 0;
+    Locate_type lt;
+    const Cell_handle conflict_cell = m_dt.locate(steiner_point, lt, li, lj, neighbor, &could_lock_zone);
+    if(!could_lock_zone)
+      return false;
+    CGAL_assertion(lt != Dt::VERTEX);
+
+    std::vector<Facet> boundary_facets;
+    std::vector<Cell_handle> conflict_zone;
+    boundary_facets.reserve(32);
+    conflict_zone.reserve(32);
+    m_dt.find_conflicts(steiner_point, conflict_cell,
+                        std::back_inserter(boundary_facets),
+                        std::back_inserter(conflict_zone),
+                        &could_lock_zone);
+    if(!could_lock_zone)
+      return false;
+
+    {
+      tbb::spin_mutex::scoped_lock lock(queue_mutex);
+      purge_gates(conflict_zone, boundary_facets);
+      visitor.before_Steiner_point_insertion(*this, steiner_point);
+    }
+
+    // The conflict zone is already locked
+    Vertex_handle vh = m_dt.insert(steiner_point, lt, conflict_cell, li, lj, &could_lock_zone);
+    CGAL_assertion(could_lock_zone && vh != Vertex_handle());
+    vh->info() = DEFAULT;
+
+    tbb::spin_mutex::scoped_lock lock(queue_mutex);
+    visitor.after_Steiner_point_insertion(*this, vh);
+    tag_new_cells_and_push_gates(vh);
+
+    return true;
+  }
+
+  // Treats the gates in batches of the gates with the highest priorities, until the queue is empty.
+  // The Steiner points of a batch are first computed concurrently, since the queries to the oracle
+  // are where most of the time is spent. The gates are then concurrently treated on the triangulation.
+  // Gates are thus not treated in the exact order of their priorities, and the wrap differs from
+  // the one of the sequential version, with the same guarantees.
+  template <typename Visitor>
+  void treat_gates_in_parallel(Visitor& visitor, Parallel_tag)
+  {
+    // The infinite vertex has no point; place it at a corner of the bounding box
+    // so that the infinite cells can be locked. Its point is restored at the end.
+    Lock_data_structure lock_ds(m_bbox.bbox(), 50 /*number of grid cells per axis*/);
+    const Concurrent_flood_fill_guard guard(m_dt, SC2GT()(m_bbox.vertex(0)), lock_ds);
+
+    const std::size_t batch_size = 64 * std::size_t(tbb::this_task_arena::max_concurrency());
+
+    std::vector<Batch_gate> batch;
+    batch.reserve(batch_size);
+    tbb::spin_mutex queue_mutex;
+    tbb::enumerable_thread_specific<std::vector<std::size_t> > deferred_gates;
+
+    while(!m_queue.empty())
+    {
+      // The circumcenters are cached sequentially
+      batch.clear();
+      while(!m_queue.empty() && batch.size() < batch_size)
+      {
+        const Gate gate = m_queue.top();
+        visitor.before_facet_treatment(*this, gate);
+        m_queue.pop();
+
+        const Cell_handle ch = gate.facet().first;
+        const Cell_handle neighbor = ch->neighbor(gate.facet().second);
+        const bool is_neighbor_finite = !m_dt.is_infinite(neighbor);
+        batch.push_back(Batch_gate{ gate, neighbor,
+                                    ch->erase_counter(), neighbor->erase_counter(),
+                                    is_neighbor_finite ? circumcenter(ch) : Point_3(),
+                                    is_neighbor_finite ? circumcenter(neighbor) : Point_3(),
+                                    0, false, Point_3() });
+      }
+
+      // Queries to the oracle
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, batch.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        for(std::size_t i=r.begin(); i!=r.end(); ++i)
+        {
+          Batch_gate& bg = batch[i];
+          if(m_dt.is_infinite(bg.neighbor))
+            continue;
+
+          bg.outside_neighbors = outside_neighbors(bg.neighbor);
+          bg.has_steiner_point = compute_steiner_point(bg.gate.facet().first, bg.ch_cc,
+                                                       bg.neighbor, bg.neighbor_cc,
+                                                       bg.steiner_point);
+          CGAL_assertion(!bg.has_steiner_point ||
+                         CGAL::abs(CGAL::approximate_sqrt(m_oracle.squared_distance(bg.steiner_point)) - m_offset) <= 1e-2 * m_offset);
+        }
+      });
+
+      // Modifications of the triangulation. A gate is deferred after a few failed attempts
+      // at locking its cells, since the contention is then high.
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, batch.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        for(std::size_t i=r.begin(); i!=r.end(); ++i)
+        {
+          for(int attempt=0; ; ++attempt)
+          {
+            const bool could_lock = treat_gate_concurrently(batch[i], visitor, queue_mutex);
+            m_dt.unlock_all_elements();
+            if(could_lock)
+              break;
+
+            if(attempt == 8)
+            {
+              deferred_gates.local().push_back(i);
+              break;
+            }
+          }
+        }
+      });
+
+      for(std::vector<std::size_t>& gates : deferred_gates)
+      {
+        for(std::size_t i : gates)
+        {
+          CGAL_assertion_code(const bool could_lock =)
+          treat_gate_concurrently(batch[i], visitor, queue_mutex);
+          CGAL_assertion(could_lock);
+          m_dt.unlock_all_elements();
+        }
+        gates.clear();
+      }
+    }
+  }
+#endif // CGAL_LINKED_WITH_TBB
+
 private:
   bool is_non_manifold(Vertex_handle v) const
   {
@@ -1471,7 +1863,11 @@ private:
         CGAL_assertion(!m_dt.is_infinite(ic));
 
         // This is where new material is added
-        ic->info().is_outside = false;
+        if(ic->info().is_outside)
+        {
+          ic->info().is_outside = false;
+          ic->info().is_manifold_filler = true;
+        }
 
 #ifdef CGAL_AW3_DEBUG_DUMP_EVERY_STEP
         static int i = 0;
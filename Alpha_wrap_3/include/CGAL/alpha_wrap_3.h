@@ -71,6 +71,14 @@ namespace CGAL {
 *     \cgalParamExtra{<ul><li>The geometric traits class must be compatible with the point type.</li>
 *                         <li>The geometric traits should use a floating point number type (see \ref aw3_interface).</li></ul>}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the wrapping should be run sequentially or in parallel}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag()`}
+*     \cgalParamExtra{See Section \ref aw3_parallel.}
+*     \cgalParamExtra{Parallel mode requires the \ref thirdpartyTBB library.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * \param out_np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
@@ -105,7 +113,9 @@ void alpha_wrap_3(const PointRange& points,
   using NP_helper = Point_set_processing_3_np_helper<PointRange, InputNamedParameters>;
   using Geom_traits = typename NP_helper::Geom_traits;
   using Oracle = Alpha_wraps_3::internal::Triangle_soup_oracle<Geom_traits>;
-  using AW3 = Alpha_wraps_3::internal::Alpha_wrap_3<Oracle>;
+  using Concurrency_tag = typename internal_np::Lookup_named_param_def<
+                            internal_np::concurrency_tag_t, InputNamedParameters, Sequential_tag>::type;
+  using AW3 = Alpha_wraps_3::internal::Alpha_wrap_3<Oracle, Concurrency_tag>;
 
   Geom_traits gt = choose_parameter<Geom_traits>(get_parameter(in_np, internal_np::geom_traits));
 
@@ -218,6 +228,14 @@ void alpha_wrap_3(const PointRange& points,
 *     \cgalParamExtra{<ul><li>The geometric traits class must be compatible with the point type.</li>
 *                         <li>The geometric traits should use a floating point number type (see \ref aw3_interface).</li></ul>}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the wrapping should be run sequentially or in parallel}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag()`}
+*     \cgalParamExtra{See Section \ref aw3_parallel.}
+*     \cgalParamExtra{Parallel mode requires the \ref thirdpartyTBB library.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * \param out_np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
@@ -254,7 +272,9 @@ void alpha_wrap_3(const TriangleMesh& tmesh,
 
   using Geom_traits = typename GetGeomTraits<TriangleMesh, InputNamedParameters>::type;
   using Oracle = Alpha_wraps_3::internal::Triangle_mesh_oracle<Geom_traits>;
-  using AW3 = Alpha_wraps_3::internal::Alpha_wrap_3<Oracle>;
+  using Concurrency_tag = typename internal_np::Lookup_named_param_def<
+                            internal_np::concurrency_tag_t, InputNamedParameters, Sequential_tag>::type;
+  using AW3 = Alpha_wraps_3::internal::Alpha_wrap_3<Oracle, Concurrency_tag>;
 
   Geom_traits gt = choose_parameter<Geom_traits>(get_parameter(in_np, internal_np::geom_traits));
 
@@ -304,6 +324,14 @@ void alpha_wrap_3(const TriangleMesh& tmesh,
 *     \cgalParamExtra{<ul><li>The geometric traits class must be compatible with the point type.</li>
 *                         <li>The geometric traits should use a floating point number type (see \ref aw3_interface).</li></ul>}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the wrapping should be run sequentially or in parallel}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag()`}
+*     \cgalParamExtra{See Section \ref aw3_parallel.}
+*     \cgalParamExtra{Parallel mode requires the \ref thirdpartyTBB library.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * \param out_np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
@@ -350,7 +378,9 @@ void alpha_wrap_3(const PointRange& points,
   using NP_helper = Point_set_processing_3_np_helper<PointRange, InputNamedParameters>;
   using Geom_traits = typename NP_helper::Geom_traits;
   using Oracle = Alpha_wraps_3::internal::Point_set_oracle<Geom_traits>;
-  using AW3 = Alpha_wraps_3::internal::Alpha_wrap_3<Oracle>;
+  using Concurrency_tag = typename internal_np::Lookup_named_param_def<
+                            internal_np::concurrency_tag_t, InputNamedParameters, Sequential_tag>::type;
+  using AW3 = Alpha_wraps_3::internal::Alpha_wrap_3<Oracle, Concurrency_tag>;
 
   Geom_traits gt = choose_parameter<Geom_traits>(get_parameter(in_np, internal_np::geom_traits));
 
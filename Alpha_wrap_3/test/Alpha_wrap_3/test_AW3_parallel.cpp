@@ -0,0 +1,243 @@
+#define CGAL_AW3_TIMER
+//#define CGAL_AW3_DEBUG
+
+#include <CGAL/alpha_wrap_3.h>
+#include "alpha_wrap_validation.h"
+
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/IO/polygon_soup_io.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+#include <CGAL/Polygon_mesh_processing/repair_degeneracies.h>
+#include <CGAL/Polygon_mesh_processing/repair_polygon_soup.h>
+
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+using Kernel = CGAL::Exact_predicates_inexact_constructions_kernel;
+using Point_3 = Kernel::Point_3;
+using Vector_3 = Kernel::Vector_3;
+
+using Mesh = CGAL::Surface_mesh<Point_3>;
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+namespace AW3 = CGAL::Alpha_wraps_3;
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+double diagonal_length(const CGAL::Bbox_3& bbox)
+{
+  const Vector_3 longest_diag = Point_3(bbox.xmax(), bbox.ymax(), bbox.zmax()) -
+                                Point_3(bbox.xmin(), bbox.ymin(), bbox.zmin());
+  return CGAL::to_double(CGAL::approximate_sqrt(longest_diag.squared_length()));
+}
+
+void alpha_wrap_triangle_mesh(const std::string& filename,
+                              const double alpha_rel,
+                              const double offset_rel)
+{
+  Mesh input_mesh;
+  bool res = PMP::IO::read_polygon_mesh(filename, input_mesh);
+  assert(res);
+  assert(!is_empty(input_mesh) && is_triangle_mesh(input_mesh));
+  const bool has_degeneracies = !PMP::remove_degenerate_faces(input_mesh);
+
+  const double diag_length = diagonal_length(PMP::bbox(input_mesh));
+  const double alpha = diag_length / alpha_rel;
+  const double offset = diag_length / offset_rel;
+
+  std::cout << "===================================================" << std::endl;
+  std::cout << filename << " " << alpha << " " << offset << std::endl;
+
+  // Sequential, for comparison
+  Mesh sequential_wrap;
+  CGAL::alpha_wrap_3(input_mesh, alpha, offset, sequential_wrap);
+  std::cout << "Sequential: " << num_vertices(sequential_wrap) << " vertices" << std::endl;
+
+  Mesh wrap;
+  CGAL::alpha_wrap_3(input_mesh, alpha, offset, wrap,
+                     CGAL::parameters::concurrency_tag(CGAL::Parallel_tag()),
+                     CGAL::parameters::default_values());
+  std::cout << "Parallel: " << num_vertices(wrap) << " vertices" << std::endl;
+
+  if(!has_degeneracies)
+  {
+    assert(AW3::internal::is_valid_wrap(wrap, true /*manifoldness*/));
+    assert(AW3::internal::is_outer_wrap_of_triangle_mesh(wrap, input_mesh));
+  }
+
+  // Without the manifoldness post-processing, the edges are shorter than alpha
+  Mesh nm_wrap;
+  CGAL::alpha_wrap_3(input_mesh, alpha, offset, nm_wrap,
+                     CGAL::parameters::concurrency_tag(CGAL::Parallel_tag()),
+                     CGAL::parameters::do_enforce_manifoldness(false));
+  assert(AW3::internal::is_valid_wrap(nm_wrap, false /*manifoldness*/));
+  assert(AW3::internal::check_edge_length(nm_wrap, alpha));
+  if(!has_degeneracies)
+    assert(AW3::internal::has_expected_Hausdorff_distance(nm_wrap, input_mesh, alpha, offset));
+}
+
+void alpha_wrap_triangle_soup(const std::string& filename)
+{
+  std::vector<Point_3> points;
+  std::vector<std::vector<std::size_t> > faces;
+  bool res = CGAL::IO::read_polygon_soup(filename, points, faces);
+  assert(res);
+  PMP::repair_polygon_soup(points, faces);
+
+  CGAL::Bbox_3 bbox;
+  for(const Point_3& p : points)
+    bbox += p.bbox();
+  const double alpha = diagonal_length(bbox) / 30.;
+
+  std::cout << "===================================================" << std::endl;
+  std::cout << filename << " (soup) " << alpha << std::endl;
+
+  Mesh wrap;
+  CGAL::alpha_wrap_3(points, faces, alpha, wrap,
+                     CGAL::parameters::concurrency_tag(CGAL::Parallel_if_available_tag()));
+  std::cout << "Parallel: " << num_vertices(wrap) << " vertices" << std::endl;
+
+  assert(AW3::internal::is_valid_wrap(wrap, true /*manifoldness*/));
+  assert(AW3::internal::is_outer_wrap_of_triangle_soup(wrap, points, faces));
+}
+
+void alpha_wrap_point_set(const std::string& filename)
+{
+  Mesh input_mesh;
+  bool res = PMP::IO::read_polygon_mesh(filename, input_mesh);
+  assert(res);
+  const std::vector<Point_3> points(input_mesh.points().begin(), input_mesh.points().end());
+  const double alpha = diagonal_length(PMP::bbox(input_mesh)) / 20.;
+
+  std::cout << "===================================================" << std::endl;
+  std::cout << filename << " (points) " << alpha << std::endl;
+
+  Mesh wrap;
+  CGAL::alpha_wrap_3(points, alpha, alpha / 30., wrap,
+                     CGAL::parameters::concurrency_tag(CGAL::Parallel_tag()));
+  std::cout << "Parallel: " << num_vertices(wrap) << " vertices" << std::endl;
+
+  assert(AW3::internal::is_valid_wrap(wrap, true /*manifoldness*/));
+  assert(AW3::internal::is_outer_wrap_of_point_set(wrap, points));
+}
+
+// Moves the infinite vertex when the flood fill begins, and checks that it is back there when the flood fill ends.
+// Throws after a given number of treated facets.
+struct Infinite_point_visitor
+  : public AW3::internal::Wrapping_default_visitor
+{
+  const Point_3 infinite_point = Point_3(1e10, 2e10, 3e10);
+  std::size_t nb_facets_before_exception = (std::numeric_limits<std::size_t>::max)();
+  bool has_ended = false;
+
+  template <typename AlphaWrapper>
+  void on_flood_fill_begin(const AlphaWrapper& wrapper)
+  {
+    wrapper.triangulation().infinite_vertex()->set_point(infinite_point);
+  }
+
+  template <typename AlphaWrapper, typename Gate>
+  void before_facet_treatment(const AlphaWrapper&, const Gate&)
+  {
+    if(nb_facets_before_exception-- == 0)
+      throw std::runtime_error("interrupted flood fill");
+  }
+
+  template <typename AlphaWrapper>
+  void on_flood_fill_end(const AlphaWrapper& wrapper)
+  {
+    assert(wrapper.triangulation().infinite_vertex()->point() == infinite_point);
+    has_ended = true;
+  }
+};
+
+// The wrapper used directly, starting from cavities dug around seeds
+void alpha_wrap_from_cavity(const std::string& filename)
+{
+  using Oracle = AW3::internal::Triangle_mesh_oracle<Kernel>;
+
+  Mesh input_mesh;
+  bool res = PMP::IO::read_polygon_mesh(filename, input_mesh);
+  assert(res);
+
+  const CGAL::Bbox_3 bbox = PMP::bbox(input_mesh);
+  const double alpha = diagonal_length(bbox) / 50.;
+  const double offset = alpha / 30.;
+
+  Oracle oracle;
+  oracle.add_triangle_mesh(input_mesh);
+
+  // the center of the sphere
+  std::vector<Point_3> seeds = { Point_3(0.5 * (bbox.xmin() + bbox.xmax()),
+                                         0.5 * (bbox.ymin() + bbox.ymax()),
+                                         0.5 * (bbox.zmin() + bbox.zmax())) };
+
+  AW3::internal::Alpha_wrap_3<Oracle, CGAL::Parallel_tag> aw3(oracle);
+
+  // Calling twice the same wrapper
+  for(int i=0; i<2; ++i)
+  {
+    Mesh wrap;
+    aw3(alpha, offset, wrap, CGAL::parameters::seed_points(std::ref(seeds)));
+    std::cout << "Cavity: " << num_vertices(wrap) << " vertices" << std::endl;
+
+    assert(!is_empty(wrap));
+    assert(AW3::internal::is_valid_wrap(wrap, true /*manifoldness*/));
+    assert(aw3.triangulation().is_valid());
+  }
+
+  // The point of the infinite vertex, which is moved during the parallel flood fill, is restored,
+  // also when the flood fill is interrupted by an exception
+  Infinite_point_visitor visitor;
+  Mesh wrap;
+  aw3(alpha, offset, wrap, CGAL::parameters::visitor(std::ref(visitor)));
+  assert(visitor.has_ended);
+  assert(AW3::internal::is_valid_wrap(wrap, true /*manifoldness*/));
+
+  visitor.has_ended = false;
+  visitor.nb_facets_before_exception = 100;
+  bool has_thrown = false;
+  try
+  {
+    aw3(alpha, offset, wrap, CGAL::parameters::visitor(std::ref(visitor)));
+  }
+  catch(const std::runtime_error&)
+  {
+    has_thrown = true;
+  }
+  assert(has_thrown && !visitor.has_ended);
+  assert(aw3.triangulation().infinite_vertex()->point() == visitor.infinite_point);
+}
+
+int main(int, char**)
+{
+  std::cout.precision(17);
+  std::cerr.precision(17);
+
+  alpha_wrap_triangle_mesh("data/bunny_random_perturbation.off", 10, 300);
+  alpha_wrap_triangle_mesh("data/bunny_random_perturbation.off", 60, 1200);
+  alpha_wrap_triangle_mesh("data/three_knives.off", 40, 600);
+  alpha_wrap_triangle_mesh("data/tetrahedron.off", 2, 20);
+  alpha_wrap_triangle_soup("data/non_manifold.off");
+  alpha_wrap_triangle_soup("data/combinatorial_manifold_multiple_components.off");
+  alpha_wrap_point_set("data/bunny_random_perturbation.off");
+  alpha_wrap_from_cavity("data/sphere_one_hole.off");
+
+  std::cout << "Done!" << std::endl;
+  return EXIT_SUCCESS;
+}
+
+#else
+
+int main(int, char**)
+{
+  std::cout << "TBB not found, the parallel wrapping is not tested" << std::endl;
+  return EXIT_SUCCESS;
+}
+
+#endif // CGAL_LINKED_WITH_TBB
@@ -0,0 +1,159 @@
+#define CGAL_AW3_TIMER
+#define CGAL_AW3_DEBUG
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/alpha_wrap_3.h>
+#include "alpha_wrap_validation.h"
+
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/IO/polygon_soup_io.h>
+#include <CGAL/Polygon_mesh_processing/orient_polygon_soup.h>
+#include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
+#include <CGAL/Polygon_mesh_processing/repair_polygon_soup.h>
+
+#include <iostream>
+#include <vector>
+
+using namespace CGAL::Alpha_wraps_3::internal;
+
+using Kernel = CGAL::Exact_predicates_inexact_constructions_kernel;
+using FT = Kernel::FT;
+using Point_3 = Kernel::Point_3;
+using Vector_3 = Kernel::Vector_3;
+
+using Points = std::vector<Point_3>;
+using Face = std::vector<std::size_t>;
+using Faces = std::vector<Face>;
+
+using Mesh = CGAL::Surface_mesh<Point_3>;
+
+// Wraps the input with decreasing values of alpha, each call refining the triangulation of the previous call
+template <typename ConcurrencyTag = CGAL::Sequential_tag>
+void alpha_wrap_triangle_soup(Points& pr,
+                              Faces& fr,
+                              const double alpha,
+                              const double offset,
+                              const bool constant_offset,
+                              const bool do_enforce_manifoldness)
+{
+  namespace AW3 = CGAL::Alpha_wraps_3;
+  namespace PMP = CGAL::Polygon_mesh_processing;
+
+  using Oracle = AW3::internal::Triangle_soup_oracle<Kernel, int, false /*subdivide*/>;
+
+  std::cout << "Input: " << pr.size() << " points, " << fr.size() << " faces" << std::endl;
+
+  PMP::repair_polygon_soup(pr, fr);
+  std::cout << "Processed input: " << pr.size() << " points, " << fr.size() << " faces" << std::endl;
+
+  Mesh input_mesh; // only required for Hausdorff
+  PMP::orient_polygon_soup(pr, fr);
+  assert(PMP::is_polygon_soup_a_polygon_mesh(fr));
+  PMP::polygon_soup_to_polygon_mesh(pr, fr, input_mesh);
+
+  // AW3
+  Oracle oracle;
+  oracle.add_triangle_soup(pr, fr);
+  AW3::internal::Alpha_wrap_3<Oracle, ConcurrencyTag> aw3(oracle);
+
+  for(int level=0; level<3; ++level)
+  {
+    const double level_alpha = alpha / (1 << level);
+    const double level_offset = constant_offset ? offset : offset / (1 << level);
+
+    Mesh wrap;
+    aw3(level_alpha, level_offset, wrap,
+        CGAL::parameters::do_enforce_manifoldness(do_enforce_manifoldness)
+                         .refine_triangulation(true));
+
+    std::cout << "Level " << level << " result: " << vertices(wrap).size() << " vertices, "
+              << faces(wrap).size() << " faces" << std::endl;
+
+    assert(AW3::internal::is_valid_wrap(wrap, do_enforce_manifoldness));
+    assert(AW3::internal::is_outer_wrap_of_triangle_soup(wrap, pr, fr));
+    assert(aw3.queue().empty());
+
+    if(!do_enforce_manifoldness)
+    {
+      // The Steiner points of the coarser levels lie on the offset surface of the first level
+      assert(AW3::internal::has_expected_Hausdorff_distance(wrap, input_mesh, level_alpha, offset));
+      assert(AW3::internal::check_edge_length(wrap, level_alpha));
+    }
+  }
+
+  // A larger alpha cannot be obtained by refinement, and the wrapper starts from scratch
+  Mesh coarse_wrap;
+  aw3(2 * alpha, offset, coarse_wrap, CGAL::parameters::do_enforce_manifoldness(false)
+                                                       .refine_triangulation(true));
+  std::cout << "Coarse result: " << vertices(coarse_wrap).size() << " vertices, "
+            << faces(coarse_wrap).size() << " faces" << std::endl;
+
+  assert(AW3::internal::is_valid_wrap(coarse_wrap, false /*manifoldness*/));
+  assert(AW3::internal::is_outer_wrap_of_triangle_soup(coarse_wrap, pr, fr));
+  assert(AW3::internal::has_expected_Hausdorff_distance(coarse_wrap, input_mesh, 2 * alpha, offset));
+  assert(AW3::internal::check_edge_length(coarse_wrap, 2 * alpha));
+}
+
+void alpha_wrap_triangle_soup(const std::string& filename)
+{
+  Points points;
+  Faces faces;
+  bool res = CGAL::IO::read_polygon_soup(filename, points, faces);
+  assert(res);
+  assert(!faces.empty());
+
+  CGAL::Bbox_3 bbox;
+  for(const auto& f : faces)
+    for(int i=0; i<3; ++i)
+      bbox += points[f[i]].bbox();
+
+  const Vector_3 longest_diag = Point_3(bbox.xmax(), bbox.ymax(), bbox.zmax()) -
+                                Point_3(bbox.xmin(), bbox.ymin(), bbox.zmin());
+  double longest_diag_length = CGAL::to_double(CGAL::approximate_sqrt(longest_diag.squared_length()));
+
+  CGAL::Random r;
+
+  const double alpha_expo = r.get_double(0., 3); // to have alpha_rel between 1 and 8
+  const double offset_expo = r.get_double(4., 6); // to have offset_rel between 16 and 64
+  const double alpha_rel = std::pow(2, alpha_expo);
+  const double offset_rel = std::pow(2, offset_expo);
+  const double alpha = longest_diag_length / alpha_rel;
+  const double offset = longest_diag_length / offset_rel;
+
+  std::cout << "===================================================" << std::endl;
+  std::cout << filename << " " << alpha << " (rel " << alpha_rel << ")"
+                        << " " << offset << " (rel " << offset_rel << ")" << std::endl;
+  std::cout << "Random seed = " << r.get_seed() << std::endl;
+
+  alpha_wrap_triangle_soup(points, faces, alpha, offset, true /*constant offset*/, true /*manifold*/);
+  alpha_wrap_triangle_soup(points, faces, alpha, offset, false /*constant offset*/, false /*manifold*/);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  alpha_wrap_triangle_soup<CGAL::Parallel_tag>(points, faces, alpha, offset, true /*constant offset*/, true /*manifold*/);
+#endif
+}
+
+int main(int argc, char** argv)
+{
+  std::cout.precision(17);
+  std::cerr.precision(17);
+
+  if(argc > 1)
+  {
+    alpha_wrap_triangle_soup(argv[1]);
+    return EXIT_SUCCESS;
+  }
+
+  alpha_wrap_triangle_soup("data/tetrahedron.off");
+  alpha_wrap_triangle_soup("data/open_tetrahedron.off");
+  alpha_wrap_triangle_soup("data/sphere_one_hole.off");
+  alpha_wrap_triangle_soup("data/non_manifold.off");
+  alpha_wrap_triangle_soup("data/combinatorial_manifold_multiple_components.off");
+  alpha_wrap_triangle_soup("data/tetrahedron_random_perturbation.off");
+  alpha_wrap_triangle_soup("data/two_knives.off");
+  alpha_wrap_triangle_soup("data/bunny_random_perturbation.off");
+
+  std::cout << "Done!" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -121,6 +121,11 @@ public:
     if(has_face_colors && face_colors.size() != m_faces.size())
       return false;
 
+    // allocate the storage of the graph at once rather than growing it with each element
+    reserve(g, num_vertices(g) + static_cast<typename boost::graph_traits<Graph>::vertices_size_type>(m_points.size()),
+               num_edges(g) + static_cast<typename boost::graph_traits<Graph>::edges_size_type>(m_points.size() + m_faces.size()),
+               num_faces(g) + static_cast<typename boost::graph_traits<Graph>::faces_size_type>(m_faces.size()));
+
     std::vector<vertex_descriptor> vertices(m_points.size());
 
     for(std::size_t id=0, ps=m_points.size(); id<ps; ++id)
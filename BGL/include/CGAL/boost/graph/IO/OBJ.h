@@ -49,8 +49,11 @@ class OBJ_builder
   typedef typename Base::Face                                               Face;
   typedef typename Base::Face_container                                     Face_container;
 
+  // if not empty, the file is read from a memory mapping when possible
+  std::string m_fname;
+
 public:
-  OBJ_builder(std::istream& is) : Base(is) { }
+  OBJ_builder(std::istream& is, const std::string& fname = std::string()) : Base(is), m_fname(fname) { }
 
   template <typename NamedParameters>
   bool read(std::istream& is,
@@ -58,6 +61,13 @@ public:
             Face_container& faces,
             const NamedParameters& np)
   {
+    if(!m_fname.empty())
+    {
+      const bool verbose = parameters::choose_parameter(parameters::get_parameter(np, internal_np::verbose), false);
+      if(read_mapped_OBJ(m_fname, points, faces, verbose) == MAPPED_READING_SUCCESS)
+        return true;
+    }
+
     return read_OBJ(is, points, faces, np);
   }
 };
@@ -169,9 +179,13 @@ bool read_OBJ(const std::string& fname,
 #endif
               )
 {
+  typedef typename CGAL::GetVertexPointMap<Graph, CGAL_NP_CLASS>::type  VPM;
+  typedef typename boost::property_traits<VPM>::value_type                  Point;
+
   std::ifstream is(fname);
   CGAL::IO::set_mode(is, CGAL::IO::ASCII);
-  return read_OBJ(is, g, np);
+  internal::OBJ_builder<Graph, Point> builder(is, fname);
+  return builder(g, np);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
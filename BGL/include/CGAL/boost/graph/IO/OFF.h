@@ -49,8 +49,11 @@ class OFF_builder
   typedef typename Base::Face                                               Face;
   typedef typename Base::Face_container                                     Face_container;
 
+  // if not empty, the file is read from a memory mapping when possible
+  std::string m_fname;
+
 public:
-  OFF_builder(std::istream& is) : Base(is) { }
+  OFF_builder(std::istream& is, const std::string& fname = std::string()) : Base(is), m_fname(fname) { }
 
   template <typename NamedParameters>
   bool read(std::istream& is,
@@ -58,6 +61,13 @@ public:
             Face_container& faces,
             const NamedParameters& np)
   {
+    if(!m_fname.empty())
+    {
+      const bool verbose = parameters::choose_parameter(parameters::get_parameter(np, internal_np::verbose), false);
+      if(read_mapped_ASCII_OFF(m_fname, points, faces, verbose) == MAPPED_READING_SUCCESS)
+        return true;
+    }
+
     return read_OFF(is, points, faces, np);
   }
 };
@@ -67,12 +77,13 @@ public:
 template <typename Graph, typename CGAL_NP_TEMPLATE_PARAMETERS>
 bool read_OFF_BGL(std::istream& is,
                   Graph& g,
-                  const CGAL_NP_CLASS& np)
+                  const CGAL_NP_CLASS& np,
+                  const std::string& fname = std::string())
 {
   typedef typename CGAL::GetVertexPointMap<Graph, CGAL_NP_CLASS>::type  VPM;
   typedef typename boost::property_traits<VPM>::value_type                  Point;
 
-  internal::OFF_builder<Graph, Point> builder(is);
+  internal::OFF_builder<Graph, Point> builder(is, fname);
   return builder(g, np);
 }
 
@@ -244,7 +255,7 @@ bool read_OFF(const std::string& fname,
               )
 {
   std::ifstream is(fname);
-  return read_OFF(is, g, np);
+  return internal::read_OFF_BGL(is, g, np, fname);
 }
 
 } // namespace IO
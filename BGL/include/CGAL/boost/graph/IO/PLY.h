@@ -45,8 +45,11 @@ class PLY_builder
   typedef typename Base::Face                                               Face;
   typedef typename Base::Face_container                                     Face_container;
 
+  // if not empty, the binary file is read from a memory mapping when possible
+  std::string m_fname;
+
 public:
-  PLY_builder(std::istream& is) : Base(is) { }
+  PLY_builder(std::istream& is, const std::string& fname = std::string()) : Base(is), m_fname(fname) { }
 
   template <typename NamedParameters>
   bool read(std::istream& is,
@@ -54,6 +57,13 @@ public:
             Face_container& faces,
             const NamedParameters& np)
   {
+    if(!m_fname.empty())
+    {
+      const Mapped_reading_status status = read_mapped_PLY(m_fname, points, faces, np);
+      if(status != MAPPED_READING_UNSUPPORTED)
+        return (status == MAPPED_READING_SUCCESS);
+    }
+
     return read_PLY(is, points, faces, np);
   }
 };
@@ -61,12 +71,13 @@ public:
 template <typename Graph, typename CGAL_NP_TEMPLATE_PARAMETERS>
 bool read_PLY_BGL(std::istream& is,
                   Graph& g,
-                  const CGAL_NP_CLASS& np = parameters::default_values())
+                  const CGAL_NP_CLASS& np = parameters::default_values(),
+                  const std::string& fname = std::string())
 {
   typedef typename CGAL::GetVertexPointMap<Graph, CGAL_NP_CLASS>::type      VPM;
   typedef typename boost::property_traits<VPM>::value_type                      Point;
 
-  internal::PLY_builder<Graph, Point> builder(is);
+  internal::PLY_builder<Graph, Point> builder(is, fname);
   return builder(g, np);
 }
 
@@ -220,7 +231,7 @@ bool read_PLY(const std::string& fname,
   {
     std::ifstream is(fname, std::ios::binary);
     CGAL::IO::set_mode(is, CGAL::IO::BINARY);
-    return internal::read_PLY_BGL(is, g, np);
+    return internal::read_PLY_BGL(is, g, np, fname);
   }
   else
   {
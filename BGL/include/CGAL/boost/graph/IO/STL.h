@@ -44,8 +44,11 @@ class STL_builder
   typedef typename Base::Face                                                   Face;
   typedef typename Base::Face_container                                         Face_container;
 
+  // if not empty, the binary file is read from a memory mapping when possible
+  std::string m_fname;
+
 public:
-  STL_builder(std::istream& is) : Base(is) { }
+  STL_builder(std::istream& is, const std::string& fname = std::string()) : Base(is), m_fname(fname) { }
 
   template <typename NamedParameters>
   bool read(std::istream& is,
@@ -53,6 +56,13 @@ public:
             Face_container& faces,
             const NamedParameters& np)
   {
+    if(!m_fname.empty())
+    {
+      const bool verbose = parameters::choose_parameter(parameters::get_parameter(np, internal_np::verbose), false);
+      if(read_mapped_binary_STL(m_fname, points, faces, verbose) == MAPPED_READING_SUCCESS)
+        return true;
+    }
+
     return read_STL(is, points, faces, np);
   }
 };
@@ -168,7 +178,10 @@ bool read_STL(const std::string& fname,
   {
     std::ifstream is(fname, std::ios::binary);
     CGAL::IO::set_mode(is, CGAL::IO::BINARY);
-    if(read_STL(is, g, np))
+    typedef typename CGAL::GetVertexPointMap<Graph, CGAL_NP_CLASS>::type      VPM;
+    typedef typename boost::property_traits<VPM>::value_type                      Point;
+    internal::STL_builder<Graph, Point> builder(is, fname);
+    if(is.good() && builder(g, np))
     {
       return true;
     }
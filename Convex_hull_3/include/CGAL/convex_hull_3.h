@@ -30,6 +30,7 @@
 #include <CGAL/Cartesian_converter.h>
 #include <CGAL/Simple_cartesian.h>
 #include <CGAL/Convex_hull_3/internal/Indexed_triangle_set.h>
+#include <CGAL/Filtered_kernel/internal/Static_filters/Plane_orientation_3.h>
 
 #include <CGAL/Number_types/internal/Exact_type_selector.h>
 #include <CGAL/boost/graph/copy_face_graph.h>
@@ -227,8 +228,8 @@ public:
   }
 };
 
-//This predicate uses copy of the code from the statically filtered version of
-//Orientation_3. The rational is that the plane is a member of the functor
+//This predicate uses the semi-static filter of Orientation_3 for a fixed plane.
+//The rational is that the plane is a member of the functor
 //so optimization are done to avoid doing several time operations on the plane.
 //The main operator() first tries the static version of the predicate, then uses
 //interval arithmetic (the protector must be created before using this predicate)
@@ -239,6 +240,7 @@ class Is_on_positive_side_of_plane_3<Convex_hull_traits_3<Kernel, P, Tag_true>,
   typedef Simple_cartesian<Interval_nt_advanced >                               Approx_K;
   typedef Convex_hull_traits_3<Kernel, P, Tag_true>                             Traits;
   typedef typename Traits::Point_3                                              Point_3;
+  typedef CGAL::internal::Static_filters_predicates::Plane_orientation_filter_3 Static_filter;
 
   Cartesian_converter<Kernel,Approx_K>                  to_AK;
   Cartesian_converter<Kernel,Exact_K>                   to_EK;
@@ -253,95 +255,11 @@ class Is_on_positive_side_of_plane_3<Convex_hull_traits_3<Kernel, P, Tag_true>,
   mutable Vector_plus_point<Approx_K> ak_plane;
   mutable Vector_plus_point<Exact_K>* ek_plane_ptr;
 
-  double m10,m20,m21,Maxx,Maxy,Maxz;
+  Static_filter static_filtered;
 
-  static const int STATIC_FILTER_FAILURE = 555;
-
-  //this function is a made from the statically filtered version of Orientation_3
-  int static_filtered(double psx,double psy, double psz) const{
-
-    // Then semi-static filter.
-    double apsx = CGAL::abs(psx);
-    double apsy = CGAL::abs(psy);
-    double apsz = CGAL::abs(psz);
-
-    double maxx = (Maxx < apsx)? apsx : Maxx;
-    double maxy = (Maxy < apsy)? apsy : Maxy;
-    double maxz = (Maxz < apsz)? apsz : Maxz;
-
-    double det =  psx*m10 - m20*psy + m21*psz;
-
-    // Sort maxx < maxy < maxz.
-    if (maxx > maxz)
-        std::swap(maxx, maxz);
-    if (maxy > maxz)
-        std::swap(maxy, maxz);
-    else if (maxy < maxx)
-        std::swap(maxx, maxy);
-
-    // Protect against underflow in the computation of eps.
-    if (maxx < 1e-97) /* cbrt(min_double/eps) */ {
-      if (maxx == 0)
-        return 0;
-    }
-    // Protect against overflow in the computation of det.
-    else if (maxz < 1e102) /* cbrt(max_double [hadamard]/4) */ {
-      double eps = 5.1107127829973299e-15 * maxx * maxy * maxz;
-      if (det > eps)  return 1;
-      if (det < -eps) return -1;
-    }
-    return STATIC_FILTER_FAILURE;
-  }
-
-public:
-  typedef typename Interval_nt_advanced::Protector           Protector;
-
-  Is_on_positive_side_of_plane_3(const Traits&,const Point_3& p_,const Point_3& q_,const Point_3& r_)
-    : p(p_),q(q_),r(r_)
-    , ak_plane()
-    , ek_plane_ptr(nullptr)
+  // the interval and then the exact versions of the predicate
+  bool filtered_and_exact(const Point_3& s) const
   {
-    ak_plane.vector =
-      typename Approx_K::Vector_3(Interval_nt_advanced(0., std::numeric_limits<double>::infinity()),
-                                  0., 0.);
-    double pqx = q.x() - p.x();
-    double pqy = q.y() - p.y();
-    double pqz = q.z() - p.z();
-    double prx = r.x() - p.x();
-    double pry = r.y() - p.y();
-    double prz = r.z() - p.z();
-
-
-    m10 = pqy*prz - pry*pqz;
-    m20 = pqx*prz - prx*pqz;
-    m21 = pqx*pry - prx*pqy;
-
-    double aprx = CGAL::abs(prx);
-    double apry = CGAL::abs(pry);
-    double aprz = CGAL::abs(prz);
-
-    Maxx = CGAL::abs(pqx);
-    if (Maxx < aprx) Maxx = aprx;
-    Maxy = CGAL::abs(pqy);
-    if (Maxy < apry) Maxy = apry;
-    Maxz = CGAL::abs(pqz);
-    if (Maxz < aprz) Maxz = aprz;
-  }
-
-  ~Is_on_positive_side_of_plane_3(){
-    if (ek_plane_ptr!=nullptr) delete ek_plane_ptr;
-  }
-
-  bool operator() (const Point_3& s) const
-  {
-    double psx = s.x() - p.x();
-    double psy = s.y() - p.y();
-    double psz = s.z() - p.z();
-
-    int static_res = static_filtered(psx,psy,psz);
-    if (static_res != STATIC_FILTER_FAILURE)
-      return static_res == 1;
-
     try{
       // infinity() is the sentinel for uninitialized `ak_plane`
       if (ak_plane.vector.x().sup() == std::numeric_limits<double>::infinity())
@@ -369,6 +287,32 @@ public:
     return sign(scalar_product(to_EK(s) - ek_plane_ptr->point,
                                ek_plane_ptr->vector)) == POSITIVE;
   }
+
+public:
+  typedef typename Interval_nt_advanced::Protector           Protector;
+
+  Is_on_positive_side_of_plane_3(const Traits&,const Point_3& p_,const Point_3& q_,const Point_3& r_)
+    : p(p_),q(q_),r(r_)
+    , ak_plane()
+    , ek_plane_ptr(nullptr)
+    , static_filtered(p.x(), p.y(), p.z(), q.x(), q.y(), q.z(), r.x(), r.y(), r.z())
+  {
+    ak_plane.vector =
+      typename Approx_K::Vector_3(Interval_nt_advanced(0., std::numeric_limits<double>::infinity()),
+                                  0., 0.);
+  }
+
+  ~Is_on_positive_side_of_plane_3(){
+    if (ek_plane_ptr!=nullptr) delete ek_plane_ptr;
+  }
+
+  bool operator() (const Point_3& s) const
+  {
+    int static_res = static_filtered(s.x(), s.y(), s.z());
+    if (static_res != Static_filter::failure)
+      return static_res == 1;
+    return filtered_and_exact(s);
+  }
 };
 
 
@@ -0,0 +1,153 @@
+// Copyright (c) 2026  agent <agent@local>.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : agent <agent@local>
+
+#ifndef CGAL_FILTERED_KERNEL_INTERNAL_INTERVAL_BATCH_PREDICATES_H
+#define CGAL_FILTERED_KERNEL_INTERNAL_INTERVAL_BATCH_PREDICATES_H
+
+// This is an undocumented private helper for Filtered_kernel.
+
+#include <CGAL/Number_types/internal/Interval_pack.h>
+#include <CGAL/determinant.h>
+#include <CGAL/enum.h>
+#include <CGAL/Uncertain.h>
+
+#include <type_traits>
+
+namespace CGAL {
+namespace internal {
+
+template <class Point, int size>
+void batch_coordinates(const Point& p, double (&coords)[2][size], int k, std::integral_constant<int, 2>)
+{
+  coords[0][k] = p.x();
+  coords[1][k] = p.y();
+}
+
+template <class Point, int size>
+void batch_coordinates(const Point& p, double (&coords)[3][size], int k, std::integral_constant<int, 3>)
+{
+  coords[0][k] = p.x();
+  coords[1][k] = p.y();
+  coords[2][k] = p.z();
+}
+
+// A point of double coordinates, for tuples that do not store the points themselves.
+struct Batch_point_3
+{
+  double c[3];
+  double x() const { return c[0]; }
+  double y() const { return c[1]; }
+  double z() const { return c[2]; }
+};
+
+// Evaluates a predicate on the tuples of N points of the range [first, beyond),
+// `Interval_pack::size` tuples at a time. The value type of `TupleIterator` gives access
+// to the points of a tuple with `operator[]`, and the coordinates of the points are doubles.
+// `eval(c, s)` computes the signs `s` from the packs of coordinates `c[i][j]` of the points `i`.
+template <int N, int D, class TupleIterator, class OutputIterator, class Evaluate>
+OutputIterator
+interval_batch(TupleIterator first, TupleIterator beyond, OutputIterator out, const Evaluate& eval)
+{
+  constexpr int size = Interval_pack::size;
+
+  double coords[N][D][size];
+  Interval_pack c[N][D];
+  Uncertain<Sign> s[size];
+
+  while(first != beyond)
+  {
+    int n = 0;
+    for(; n<size && first != beyond; ++n, ++first)
+    {
+      const auto& t = *first;
+      for(int i=0; i<N; ++i)
+        batch_coordinates(t[i], coords[i], n, std::integral_constant<int, D>());
+    }
+    // the last pack is completed with copies of its first tuple
+    for(int k=n; k<size; ++k)
+      for(int i=0; i<N; ++i)
+        for(int j=0; j<D; ++j)
+          coords[i][j][k] = coords[i][j][0];
+
+    for(int i=0; i<N; ++i)
+      for(int j=0; j<D; ++j)
+        c[i][j] = Interval_pack(coords[i][j]);
+    eval(c, s);
+    for(int k=0; k<n; ++k)
+      *out++ = s[k];
+  }
+  return out;
+}
+
+// For each tuple t of [first, beyond), outputs `orientation(t[0], t[1], t[2], t[3])`,
+// or an indeterminate sign when interval arithmetic cannot decide.
+// Same formula as `orientationC3()`.
+template <class TupleIterator, class OutputIterator>
+OutputIterator
+orientation_3_interval_batch(TupleIterator first, TupleIterator beyond, OutputIterator out)
+{
+  return interval_batch<4, 3>(first, beyond, out,
+    [](const Interval_pack (&c)[4][3], Uncertain<Sign>* s)
+    {
+      const Interval_pack qpx = c[1][0] - c[0][0], qpy = c[1][1] - c[0][1], qpz = c[1][2] - c[0][2];
+      const Interval_pack rpx = c[2][0] - c[0][0], rpy = c[2][1] - c[0][1], rpz = c[2][2] - c[0][2];
+      const Interval_pack spx = c[3][0] - c[0][0], spy = c[3][1] - c[0][1], spz = c[3][2] - c[0][2];
+      CGAL::determinant(qpx, rpx, spx,
+                        qpy, rpy, spy,
+                        qpz, rpz, spz).signs(s);
+    });
+}
+
+// For each tuple t of [first, beyond), outputs `side_of_oriented_sphere(t[0], t[1], t[2], t[3], t[4])`,
+// or an indeterminate sign when interval arithmetic cannot decide.
+// Same formula as `side_of_oriented_sphereC3()`.
+template <class TupleIterator, class OutputIterator>
+OutputIterator
+side_of_oriented_sphere_3_interval_batch(TupleIterator first, TupleIterator beyond, OutputIterator out)
+{
+  return interval_batch<5, 3>(first, beyond, out,
+    [](const Interval_pack (&c)[5][3], Uncertain<Sign>* s)
+    {
+      Interval_pack d[4][4];
+      for(int i=0; i<4; ++i)
+      {
+        for(int j=0; j<3; ++j)
+          d[i][j] = c[i][j] - c[4][j];
+        d[i][3] = d[i][0]*d[i][0] + d[i][1]*d[i][1] + d[i][2]*d[i][2];
+      }
+      // det(P,R,Q,S), see side_of_oriented_sphereC3()
+      CGAL::determinant(d[0][0], d[0][1], d[0][2], d[0][3],
+                        d[2][0], d[2][1], d[2][2], d[2][3],
+                        d[1][0], d[1][1], d[1][2], d[1][3],
+                        d[3][0], d[3][1], d[3][2], d[3][3]).signs(s);
+    });
+}
+
+// For each tuple t of [first, beyond), outputs `orientation(t[0], t[1], t[2])`,
+// or an indeterminate sign when interval arithmetic cannot decide.
+// Same formula as `orientationC2()`.
+template <class TupleIterator, class OutputIterator>
+OutputIterator
+orientation_2_interval_batch(TupleIterator first, TupleIterator beyond, OutputIterator out)
+{
+  return interval_batch<3, 2>(first, beyond, out,
+    [](const Interval_pack (&c)[3][2], Uncertain<Sign>* s)
+    {
+      CGAL::determinant(c[1][0] - c[0][0], c[1][1] - c[0][1],
+                        c[2][0] - c[0][0], c[2][1] - c[0][1]).signs(s);
+    });
+}
+
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_FILTERED_KERNEL_INTERNAL_INTERVAL_BATCH_PREDICATES_H
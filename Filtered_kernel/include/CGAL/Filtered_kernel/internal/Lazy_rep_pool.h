@@ -0,0 +1,230 @@
+// Copyright (c) 2026  agent <agent@local>.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : agent <agent@local>
+
+#ifndef CGAL_FILTERED_KERNEL_INTERNAL_LAZY_REP_POOL_H
+#define CGAL_FILTERED_KERNEL_INTERNAL_LAZY_REP_POOL_H
+
+#include <CGAL/config.h>
+#include <CGAL/Profile_counter.h>
+#include <CGAL/tss.h>
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <vector>
+#ifdef CGAL_HAS_THREADS
+#  include <mutex>
+#endif
+
+namespace CGAL {
+namespace internal {
+
+// Memory pool for the nodes of the lazy DAGs, used when CGAL_LAZY_KERNEL_MEMORY_POOL is defined.
+//
+// The nodes are small, and are created and destroyed in huge numbers, mostly by the thread
+// that created them. Each thread carves its nodes out of its own chunks of memory, and keeps
+// one free list per size class, so that allocating and releasing a node needs neither a lock
+// nor a call to the global allocator. A node released by another thread than the one that
+// allocated it goes to the free list of the releasing thread.
+// When a thread exits, its free lists are handed over to a global pool, protected by a mutex,
+// where the other threads take nodes before carving new ones. The nodes released after
+// the exit of their thread, for instance during the destruction of static objects,
+// also go to the global pool. The chunks are never given back to the system.
+//
+// The nodes must not be over-aligned: they are aligned on `granularity` bytes.
+class Lazy_rep_pool
+{
+  struct Free_node { Free_node* next; };
+
+public:
+  static constexpr std::size_t granularity = 16;
+  static constexpr std::size_t number_of_size_classes = 16; // nodes of up to 256 bytes
+  static constexpr std::size_t chunk_size = 64 * 1024;
+
+  static void* allocate(std::size_t n)
+  {
+    const std::size_t c = size_class(n);
+    if(c >= number_of_size_classes)
+      return ::operator new(n);
+    Local* local = local_pool();
+    return (local != nullptr) ? local->allocate(c) : global().allocate(c);
+  }
+
+  static void deallocate(void* p, std::size_t n)
+  {
+    const std::size_t c = size_class(n);
+    if(c >= number_of_size_classes)
+      return ::operator delete(p);
+    Local* local = local_pool();
+    if(local != nullptr)
+      local->deallocate(p, c);
+    else
+      global().deallocate(p, c);
+  }
+
+private:
+  static std::size_t size_class(std::size_t n) { return (n == 0) ? 0 : (n - 1) / granularity; }
+  static std::size_t node_size(std::size_t c) { return (c + 1) * granularity; }
+
+  static void push(Free_node*& head, void* p)
+  {
+    Free_node* node = static_cast<Free_node*>(p);
+    node->next = head;
+    head = node;
+  }
+
+  static void* pop(Free_node*& head)
+  {
+    Free_node* node = head;
+    head = node->next;
+    return node;
+  }
+
+  struct Global
+  {
+#ifdef CGAL_HAS_THREADS
+    std::mutex mutex;
+    typedef std::lock_guard<std::mutex> Lock;
+#else
+    struct Lock { Lock(int) {} };
+    int mutex = 0;
+#endif
+    Free_node* free_lists[number_of_size_classes] = {};
+    std::atomic<std::size_t> free_size[number_of_size_classes] = {};
+    std::vector<void*> chunks; // all the chunks of all the threads
+
+    void* new_chunk()
+    {
+      void* ch = ::operator new(chunk_size);
+      Lock lock(mutex);
+      chunks.push_back(ch);
+      CGAL_PROFILER("[Lazy_kernel pool chunks]");
+      return ch;
+    }
+
+    void* allocate(std::size_t c)
+    {
+      Lock lock(mutex);
+      if(free_lists[c] != nullptr)
+      {
+        free_size[c].fetch_sub(1, std::memory_order_relaxed);
+        return pop(free_lists[c]);
+      }
+      // only after the exit of the current thread, which is rare enough
+      return ::operator new(node_size(c));
+    }
+
+    void deallocate(void* p, std::size_t c)
+    {
+      Lock lock(mutex);
+      push(free_lists[c], p);
+      free_size[c].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // returns all the free nodes of size class `c`, if any
+    Free_node* take(std::size_t c)
+    {
+      if(free_size[c].load(std::memory_order_relaxed) == 0)
+        return nullptr;
+      Lock lock(mutex);
+      Free_node* head = free_lists[c];
+      free_lists[c] = nullptr;
+      free_size[c].store(0, std::memory_order_relaxed);
+      return head;
+    }
+
+    // adds the `n` nodes of the list from `head` to `tail`
+    void give(std::size_t c, Free_node* head, Free_node* tail, std::size_t n)
+    {
+      Lock lock(mutex);
+      tail->next = free_lists[c];
+      free_lists[c] = head;
+      free_size[c].fetch_add(n, std::memory_order_relaxed);
+    }
+  };
+
+  // never destroyed, as nodes may be released during the destruction of static objects
+  static Global& global()
+  {
+    static Global* g = new Global();
+    return *g;
+  }
+
+  struct Local
+  {
+    Free_node* free_lists[number_of_size_classes] = {};
+    char* begin = nullptr;
+    char* end = nullptr;
+
+    void* allocate(std::size_t c)
+    {
+      Free_node*& head = free_lists[c];
+      if(head == nullptr)
+        head = global().take(c);
+      if(head != nullptr)
+        return pop(head);
+
+      const std::size_t s = node_size(c);
+      if(std::size_t(end - begin) < s)
+      {
+        // the end of the current chunk, too small for this node, is lost
+        begin = static_cast<char*>(global().new_chunk());
+        end = begin + chunk_size;
+      }
+      void* p = begin;
+      begin += s;
+      return p;
+    }
+
+    void deallocate(void* p, std::size_t c)
+    {
+      push(free_lists[c], p);
+    }
+
+    ~Local()
+    {
+      for(std::size_t c=0; c<number_of_size_classes; ++c)
+      {
+        Free_node* head = free_lists[c];
+        if(head == nullptr)
+          continue;
+        Free_node* tail = head;
+        std::size_t n = 1;
+        for(; tail->next != nullptr; tail = tail->next)
+          ++n;
+        global().give(c, head, tail, n);
+      }
+      exited() = true;
+    }
+  };
+
+  // `true` once the pool of the current thread has been destroyed
+  static bool& exited()
+  {
+    CGAL_STATIC_THREAD_LOCAL_VARIABLE(bool, b, false);
+    return b;
+  }
+
+  // `nullptr` once the current thread is exiting
+  static Local* local_pool()
+  {
+    if(exited())
+      return nullptr;
+    CGAL_STATIC_THREAD_LOCAL_VARIABLE_0(Local, local);
+    return &local;
+  }
+};
+
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_FILTERED_KERNEL_INTERNAL_LAZY_REP_POOL_H
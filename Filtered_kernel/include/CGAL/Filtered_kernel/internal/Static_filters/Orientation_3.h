@@ -15,7 +15,12 @@
 
 #include <CGAL/Profile_counter.h>
 #include <CGAL/Filtered_kernel/internal/Static_filters/Static_filter_error.h>
+#include <CGAL/Filtered_kernel/internal/Static_filters/Plane_orientation_3.h>
+#include <CGAL/Filtered_kernel/internal/Interval_batch_predicates.h>
+#include <array>
 #include <cmath>
+#include <iterator>
+#include <vector>
 
 namespace CGAL { namespace internal { namespace Static_filters_predicates {
 
@@ -35,6 +40,7 @@ class Orientation_3
 
 public:
  typedef typename Base::result_type  result_type;
+  typedef Tag_true                    Batched_orientations_tag;
 
   using Base::operator();
 
@@ -138,6 +144,91 @@ public:
       return Base::operator()(p, q, r, s);
   }
 
+  // Outputs `operator()(p, q, r, s)` for all the points `s` of [first, beyond).
+  // The points are processed by blocks: the semi-static filter, whose plane is computed once,
+  // is evaluated on several points at once, then the points for which it fails go through
+  // batched interval arithmetic, and only those that are still undecided through `Base`.
+  template <class PointIterator, class OutputIterator>
+  OutputIterator
+  operator()(const Point_3 &p, const Point_3 &q, const Point_3 &r,
+             PointIterator first, PointIterator beyond, OutputIterator out) const
+  {
+      double px, py, pz, qx, qy, qz, rx, ry, rz;
+
+      if (! (fit_in_double(p.x(), px) && fit_in_double(p.y(), py) &&
+             fit_in_double(p.z(), pz) &&
+             fit_in_double(q.x(), qx) && fit_in_double(q.y(), qy) &&
+             fit_in_double(q.z(), qz) &&
+             fit_in_double(r.x(), rx) && fit_in_double(r.y(), ry) &&
+             fit_in_double(r.z(), rz)))
+      {
+          for(; first != beyond; ++first)
+              *out++ = Base::operator()(p, q, r, *first);
+          return out;
+      }
+
+      typedef Static_filters_predicates::Plane_orientation_filter_3 Filter;
+      const Filter filter(px, py, pz, qx, qy, qz, rx, ry, rz);
+
+      const std::size_t block_size = 64;
+      double sx[block_size], sy[block_size], sz[block_size];
+      int res[block_size];
+      bool fit[block_size];
+      std::vector<Point_3> points;
+      std::vector<std::size_t> failures;
+      std::vector<std::array<Batch_point_3, 4> > tuples;
+      std::vector<Uncertain<Sign> > signs;
+
+      while(first != beyond)
+      {
+          points.clear();
+          failures.clear();
+          bool all_fit = true;
+          for(std::size_t i=0; i<block_size && first != beyond; ++i, ++first)
+          {
+              points.push_back(*first);
+              const Point_3& s = points.back();
+              fit[i] = fit_in_double(s.x(), sx[i]) && fit_in_double(s.y(), sy[i]) &&
+                       fit_in_double(s.z(), sz[i]);
+              if (! fit[i])
+              {
+                  sx[i] = sy[i] = sz[i] = 0;
+                  all_fit = false;
+              }
+          }
+          const std::size_t n = points.size();
+
+          if (filter(sx, sy, sz, n, res) != 0 || ! all_fit)
+          {
+              tuples.clear();
+              for(std::size_t i=0; i<n; ++i)
+                  if (! fit[i])
+                      res[i] = Base::operator()(p, q, r, points[i]);
+                  else if (res[i] == Filter::failure)
+                  {
+                      failures.push_back(i);
+                      tuples.push_back({{ {{px, py, pz}}, {{qx, qy, qz}}, {{rx, ry, rz}},
+                                          {{sx[i], sy[i], sz[i]}} }});
+                  }
+              // the interval packs are correct in round-to-nearest mode, and in the upward mode
+              // set by `Protect_FPU_rounding`, so the rounding mode is left unchanged
+              signs.clear();
+              orientation_3_interval_batch(tuples.begin(), tuples.end(), std::back_inserter(signs));
+              for(std::size_t j=0; j<failures.size(); ++j)
+              {
+                  const std::size_t i = failures[j];
+                  if (is_certain(signs[j]))
+                      res[i] = get_certain(signs[j]);
+                  else
+                      res[i] = Base::operator()(p, q, r, points[i]);
+              }
+          }
+          for(std::size_t i=0; i<n; ++i)
+              *out++ = result_type(res[i]);
+      }
+      return out;
+  }
+
   // Computes the epsilon for Orientation_3.
   static double compute_epsilon()
   {
@@ -0,0 +1,259 @@
+// Copyright (c) 2026  agent <agent@local>.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : agent <agent@local>
+
+#ifndef CGAL_INTERNAL_STATIC_FILTERS_PLANE_ORIENTATION_3_H
+#define CGAL_INTERNAL_STATIC_FILTERS_PLANE_ORIENTATION_3_H
+
+// This is an undocumented private helper for Filtered_kernel.
+
+#include <CGAL/config.h>
+#include <CGAL/FPU.h>
+#include <CGAL/number_utils.h>
+
+#include <boost/mpl/has_xxx.hpp>
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#if defined CGAL_HAS_SSE2 && defined __AVX__ && !defined CGAL_PLANE_ORIENTATION_3_NO_AVX
+#  define CGAL_PLANE_ORIENTATION_3_USE_AVX 1
+#  include <immintrin.h>
+#endif
+
+namespace CGAL { namespace internal { namespace Static_filters_predicates {
+
+// The semi-static filter of `Orientation_3`, for the orientations of many points `s`
+// with respect to one plane given by three points `p`, `q`, and `r`.
+// The minors of the plane are computed once, and with AVX, four points are filtered at once.
+// The result is the sign of the orientation of (p, q, r, s), or `failure` when
+// the filter cannot decide.
+class Plane_orientation_filter_3
+{
+public:
+  static const int failure = 555;
+
+  Plane_orientation_filter_3() {}
+
+  Plane_orientation_filter_3(double px, double py, double pz,
+                             double qx, double qy, double qz,
+                             double rx, double ry, double rz)
+    : px(px), py(py), pz(pz)
+  {
+    const double pqx = qx - px;
+    const double pqy = qy - py;
+    const double pqz = qz - pz;
+    const double prx = rx - px;
+    const double pry = ry - py;
+    const double prz = rz - pz;
+
+    m10 = pqy*prz - pry*pqz;
+    m20 = pqx*prz - prx*pqz;
+    m21 = pqx*pry - prx*pqy;
+
+    const double aprx = CGAL::abs(prx);
+    const double apry = CGAL::abs(pry);
+    const double aprz = CGAL::abs(prz);
+
+    Maxx = CGAL::abs(pqx);
+    if (Maxx < aprx) Maxx = aprx;
+    Maxy = CGAL::abs(pqy);
+    if (Maxy < apry) Maxy = apry;
+    Maxz = CGAL::abs(pqz);
+    if (Maxz < aprz) Maxz = aprz;
+  }
+
+  // the filter for the point (sx, sy, sz)
+  int operator()(double sx, double sy, double sz) const
+  {
+    const double psx = sx - px;
+    const double psy = sy - py;
+    const double psz = sz - pz;
+
+    const double apsx = CGAL::abs(psx);
+    const double apsy = CGAL::abs(psy);
+    const double apsz = CGAL::abs(psz);
+
+    double maxx = (Maxx < apsx)? apsx : Maxx;
+    double maxy = (Maxy < apsy)? apsy : Maxy;
+    double maxz = (Maxz < apsz)? apsz : Maxz;
+
+    const double det = psx*m10 - m20*psy + m21*psz;
+
+    // Sort maxx < maxy < maxz.
+    if (maxx > maxz)
+        std::swap(maxx, maxz);
+    if (maxy > maxz)
+        std::swap(maxy, maxz);
+    else if (maxy < maxx)
+        std::swap(maxx, maxy);
+
+    // Protect against underflow in the computation of eps.
+    if (maxx < 1e-97) /* cbrt(min_double/eps) */ {
+      if (maxx == 0)
+        return 0;
+    }
+    // Protect against overflow in the computation of det.
+    else if (maxz < 1e102) /* cbrt(max_double [hadamard]/4) */ {
+      const double eps = 5.1107127829973299e-15 * maxx * maxy * maxz;
+      if (det > eps)  return 1;
+      if (det < -eps) return -1;
+    }
+    return failure;
+  }
+
+  // The filter for the `n` points (sx[i], sy[i], sz[i]), whose results are written to `res`.
+  // Returns the number of failures.
+  std::size_t operator()(const double* sx, const double* sy, const double* sz,
+                         std::size_t n, int* res) const
+  {
+    std::size_t failures = 0;
+    std::size_t i = 0;
+#ifdef CGAL_PLANE_ORIENTATION_3_USE_AVX
+    // Same tests as above, where the smallest and the largest of maxx, maxy, and maxz
+    // are computed without sorting them.
+    const __m256d m = _mm256_set1_pd(-0.);
+    const __m256d vpx = _mm256_set1_pd(px), vpy = _mm256_set1_pd(py), vpz = _mm256_set1_pd(pz);
+    const __m256d vm10 = _mm256_set1_pd(m10), vm20 = _mm256_set1_pd(m20), vm21 = _mm256_set1_pd(m21);
+    const __m256d vMaxx = _mm256_set1_pd(Maxx), vMaxy = _mm256_set1_pd(Maxy), vMaxz = _mm256_set1_pd(Maxz);
+    const __m256d zero = _mm256_setzero_pd();
+    const __m256d underflow = _mm256_set1_pd(1e-97), overflow = _mm256_set1_pd(1e102);
+    const __m256d epsilon = _mm256_set1_pd(5.1107127829973299e-15);
+    for(; i+4 <= n; i+=4)
+    {
+      const __m256d psx = _mm256_sub_pd(_mm256_loadu_pd(sx+i), vpx);
+      const __m256d psy = _mm256_sub_pd(_mm256_loadu_pd(sy+i), vpy);
+      const __m256d psz = _mm256_sub_pd(_mm256_loadu_pd(sz+i), vpz);
+
+      // `_mm256_max_pd()` returns its second argument when one is NaN
+      const __m256d maxx = _mm256_max_pd(vMaxx, _mm256_andnot_pd(m, psx));
+      const __m256d maxy = _mm256_max_pd(vMaxy, _mm256_andnot_pd(m, psy));
+      const __m256d maxz = _mm256_max_pd(vMaxz, _mm256_andnot_pd(m, psz));
+
+      const __m256d det = _mm256_add_pd(_mm256_sub_pd(_mm256_mul_pd(psx, vm10), _mm256_mul_pd(vm20, psy)),
+                                        _mm256_mul_pd(vm21, psz));
+      const __m256d eps = _mm256_mul_pd(_mm256_mul_pd(_mm256_mul_pd(epsilon, maxx), maxy), maxz);
+      const __m256d lo = _mm256_min_pd(_mm256_min_pd(maxx, maxy), maxz);
+      const __m256d hi = _mm256_max_pd(_mm256_max_pd(maxx, maxy), maxz);
+
+      const __m256d in_range = _mm256_and_pd(_mm256_cmp_pd(lo, underflow, _CMP_GE_OQ),
+                                             _mm256_cmp_pd(hi, overflow, _CMP_LT_OQ));
+      const int pos = _mm256_movemask_pd(_mm256_and_pd(in_range, _mm256_cmp_pd(det, eps, _CMP_GT_OQ)));
+      const int neg = _mm256_movemask_pd(_mm256_and_pd(in_range,
+                                         _mm256_cmp_pd(det, _mm256_xor_pd(eps, m), _CMP_LT_OQ)));
+
+      // the lanes where lo == 0 are in neither `pos` nor `neg`, and their result is 0
+      for(int k=0; k<4; ++k)
+        res[i+k] = ((pos >> k) & 1) - ((neg >> k) & 1);
+      const int nul = _mm256_movemask_pd(_mm256_cmp_pd(lo, zero, _CMP_EQ_OQ));
+      const int fail = ~(pos | neg | nul) & 0xF;
+      if(fail != 0)
+      {
+        for(int k=0; k<4; ++k)
+          if((fail >> k) & 1)
+          {
+            res[i+k] = failure;
+            ++failures;
+          }
+      }
+    }
+#endif
+    for(; i<n; ++i)
+    {
+      res[i] = evaluate(sx[i], sy[i], sz[i]);
+      if(res[i] == failure)
+        ++failures;
+    }
+    return failures;
+  }
+
+private:
+  // Same as the filter for one point, where the smallest and the largest of maxx, maxy,
+  // and maxz are computed without sorting them, so that the result is obtained with
+  // fewer branches, which are hard to predict when the points are on both sides of the plane.
+  int evaluate(double sx, double sy, double sz) const
+  {
+    const double psx = sx - px;
+    const double psy = sy - py;
+    const double psz = sz - pz;
+
+    const double apsx = CGAL::abs(psx);
+    const double apsy = CGAL::abs(psy);
+    const double apsz = CGAL::abs(psz);
+
+    const double maxx = (Maxx < apsx)? apsx : Maxx;
+    const double maxy = (Maxy < apsy)? apsy : Maxy;
+    const double maxz = (Maxz < apsz)? apsz : Maxz;
+
+    const double det = psx*m10 - m20*psy + m21*psz;
+    const double eps = 5.1107127829973299e-15 * maxx * maxy * maxz;
+
+    double lo = (maxx < maxy)? maxx : maxy;
+    lo = (lo < maxz)? lo : maxz;
+    double hi = (maxx < maxy)? maxy : maxx;
+    hi = (hi < maxz)? maxz : hi;
+
+    const bool in_range = (lo >= 1e-97) & (hi < 1e102);
+    const int r = int(in_range & (det > eps)) - int(in_range & (det < -eps));
+    if (r == 0 && lo != 0)
+      return failure;
+    return r;
+  }
+
+  double px, py, pz;
+  double m10, m20, m21;
+  double Maxx, Maxy, Maxz;
+};
+
+} } // namespace internal::Static_filters_predicates
+
+namespace internal {
+
+// `Orientation_3` defines the type `Batched_orientations_tag` when its operator()
+// on a range of points is more efficient than the loop on the points.
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(Has_batched_orientations_3, Batched_orientations_tag, false)
+
+template <class Orientation_3, class Point_3, class PointIterator, class OutputIterator>
+OutputIterator orientations_3(const Orientation_3& orientation,
+                              const Point_3& p, const Point_3& q, const Point_3& r,
+                              PointIterator first, PointIterator beyond, OutputIterator out,
+                              std::true_type)
+{
+  return orientation(p, q, r, first, beyond, out);
+}
+
+template <class Orientation_3, class Point_3, class PointIterator, class OutputIterator>
+OutputIterator orientations_3(const Orientation_3& orientation,
+                              const Point_3& p, const Point_3& q, const Point_3& r,
+                              PointIterator first, PointIterator beyond, OutputIterator out,
+                              std::false_type)
+{
+  for(; first != beyond; ++first)
+    *out++ = orientation(p, q, r, *first);
+  return out;
+}
+
+// Outputs `orientation(p, q, r, s)` for all the points `s` of [first, beyond), with the
+// batched version of the predicate when it has one, as the predicate of `Epick`.
+// This is the entry point for generic code; no algorithm of CGAL calls it yet.
+template <class Orientation_3, class Point_3, class PointIterator, class OutputIterator>
+OutputIterator orientations_3(const Orientation_3& orientation,
+                              const Point_3& p, const Point_3& q, const Point_3& r,
+                              PointIterator first, PointIterator beyond, OutputIterator out)
+{
+  return orientations_3(orientation, p, q, r, first, beyond, out,
+                        std::integral_constant<bool, Has_batched_orientations_3<Orientation_3>::value>());
+}
+
+} } // namespace CGAL::internal
+
+#endif // CGAL_INTERNAL_STATIC_FILTERS_PLANE_ORIENTATION_3_H
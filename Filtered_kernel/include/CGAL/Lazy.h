@@ -29,6 +29,7 @@
 #include <CGAL/tss.h>
 #include <CGAL/is_iterator.h>
 #include <CGAL/transforming_iterator.h>
+#include <CGAL/Filtered_kernel/internal/Lazy_rep_pool.h>
 
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
@@ -47,6 +48,7 @@
 
 #include <iostream>
 #include <iterator>
+#include <new>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -94,6 +96,27 @@ depth(const Lazy<AT,ET,E2A>& l)
   return l.depth();
 }
 
+// Computes the exact value of `l` if it is not known yet, and releases the part of the DAG below it.
+// This is done anyway when the exact value is computed, except for the few constructions
+// listed in `Disable_lazy_pruning` when several threads are running, since other threads may
+// be reading the children of the node. The caller must make sure that no other thread accesses
+// the DAG of `l` during the call.
+template <typename AT, typename ET, typename E2A>
+inline
+void
+prune_dag(const Lazy<AT,ET,E2A>& l)
+{
+  l.prune_dag();
+}
+
+template <typename InputIterator>
+void
+prune_dags(InputIterator first, InputIterator beyond)
+{
+  for(; first != beyond; ++first)
+    prune_dag(*first);
+}
+
 
 #define CGAL_LAZY_FORWARD(T) \
   inline const T & approx(const T& d) { return d; } \
@@ -206,13 +229,31 @@ print_dag(const Return_base_tag&, std::ostream& os, int level)
 #endif
 
 
-struct Depth_base {
+// Common base of all the nodes of the lazy DAGs
+struct Lazy_rep_base {
+#ifdef CGAL_LAZY_KERNEL_MEMORY_POOL
+  static void* operator new(std::size_t n) { return internal::Lazy_rep_pool::allocate(n); }
+  static void operator delete(void* p, std::size_t n) { internal::Lazy_rep_pool::deallocate(p, n); }
+#  ifdef __cpp_aligned_new // C++17
+  // over-aligned nodes are not pooled
+  static void* operator new(std::size_t n, std::align_val_t al) { return ::operator new(n, al); }
+  static void operator delete(void* p, std::size_t, std::align_val_t al) { ::operator delete(p, al); }
+#  endif
+#endif
+
+  static void count_exact_evaluation()
+  {
+    CGAL_PROFILER("[Lazy_kernel exact evaluations]");
+  }
+
 #ifdef CGAL_PROFILE
   int depth_;
 
-  Depth_base()
+  Lazy_rep_base()
     : depth_(0)
-  {}
+  {
+    CGAL_PROFILER("[Lazy_kernel DAG nodes]");
+  }
 
   int depth() const { return depth_; }
   void set_depth(int i)
@@ -288,7 +329,7 @@ struct AT_ET_wrap : AT_wrap<AT> {
 
 // Abstract base class for lazy numbers and lazy objects
 template <typename AT_, typename ET, typename E2A, int=Lazy_rep_selector<AT_>::value /* 0 */>
-class Lazy_rep : public Rep, public Depth_base
+class Lazy_rep : public Rep, public Lazy_rep_base
 {
   Lazy_rep (const Lazy_rep&) = delete; // cannot be copied.
   Lazy_rep& operator= (const Lazy_rep&) = delete; // cannot be copied.
@@ -331,7 +372,7 @@ public:
   {
     // The test is unnecessary, only use it if benchmark says so, or in order to avoid calling Lazy_exact_Ex_Cst::update_exact() (which used to contain an assertion)
     //if (is_lazy())
-    std::call_once(once, [this](){this->update_exact();});
+    std::call_once(once, [this](){ count_exact_evaluation(); this->update_exact(); });
     return exact_unsafe(); // call_once already synchronized memory
   }
 
@@ -382,6 +423,8 @@ public:
 
   bool is_lazy() const { return ptr_.load(std::memory_order_relaxed) == &at_orig; }
   virtual void update_exact() const = 0;
+  // Releases the children of the node. Only called once the exact value is known.
+  virtual void prune_dag() const {}
   virtual ~Lazy_rep() {
 #if !defined __SANITIZE_THREAD__ && !__has_feature(thread_sanitizer)
     auto* p = ptr_.load(std::memory_order_relaxed);
@@ -401,7 +444,7 @@ public:
  * For aggregate-like types (Simple_cartesian::Point_3), it should be ok for the same reason.
  * This is definitely NOT safe for a std::vector like a Point_d with Dynamic_dimension_tag, so it should only be enabled on a case by case basis, if at all. Storing a Point_3 piecewise with 6 atomic_double would be doable, but painful, and I didn't benchmark to check the performance. */
 template <typename AT_, typename ET, typename E2A>
-class Lazy_rep<AT_, ET, E2A, 1> : public Rep, public Depth_base
+class Lazy_rep<AT_, ET, E2A, 1> : public Rep, public Lazy_rep_base
 {
   Lazy_rep (const Lazy_rep&) = delete; // cannot be copied.
   Lazy_rep& operator= (const Lazy_rep&) = delete; // cannot be copied.
@@ -456,10 +499,12 @@ public:
 #ifdef CGAL_HAS_THREADS
     // The test is unnecessary, only use it if benchmark says so, or in order to avoid calling Lazy_exact_Ex_Cst::update_exact() (which used to contain an assertion)
     //if (is_lazy())
-    std::call_once(once, [this](){this->update_exact();});
+    std::call_once(once, [this](){ count_exact_evaluation(); this->update_exact(); });
 #else
-    if (is_lazy())
+    if (is_lazy()) {
+      count_exact_evaluation();
       this->update_exact();
+    }
 #endif
     return exact_unsafe(); // call_once already synchronized memory
   }
@@ -498,6 +543,8 @@ public:
 
   bool is_lazy() const { return ptr_.load(std::memory_order_relaxed) == nullptr; }
   virtual void update_exact() const = 0;
+  // Releases the children of the node. Only called once the exact value is known.
+  virtual void prune_dag() const {}
   virtual ~Lazy_rep() {
 #if !defined __SANITIZE_THREAD__ && !__has_feature(thread_sanitizer)
     auto* p = ptr_.load(std::memory_order_relaxed);
@@ -514,7 +561,7 @@ public:
 
 // do we need to (forward) declare Interval_nt?
 template <bool b, typename ET, typename E2A>
-class Lazy_rep<Interval_nt<b>, ET, E2A, 2> : public Rep, public Depth_base
+class Lazy_rep<Interval_nt<b>, ET, E2A, 2> : public Rep, public Lazy_rep_base
 {
   Lazy_rep (const Lazy_rep&) = delete; // cannot be copied.
   Lazy_rep& operator= (const Lazy_rep&) = delete; // cannot be copied.
@@ -565,7 +612,7 @@ public:
   {
     // The test is unnecessary, only use it if benchmark says so, or in order to avoid calling Lazy_exact_Ex_Cst::update_exact() (which used to contain an assertion)
     //if (is_lazy())
-    std::call_once(once, [this](){this->update_exact();});
+    std::call_once(once, [this](){ count_exact_evaluation(); this->update_exact(); });
     return exact_unsafe(); // call_once already synchronized memory
   }
 
@@ -605,6 +652,8 @@ public:
 
   bool is_lazy() const { return ptr_.load(std::memory_order_relaxed) == nullptr; }
   virtual void update_exact() const = 0;
+  // Releases the children of the node. Only called once the exact value is known.
+  virtual void prune_dag() const {}
   virtual ~Lazy_rep() {
 #if !defined __SANITIZE_THREAD__ && !__has_feature(thread_sanitizer)
     auto* p = ptr_.load(std::memory_order_relaxed);
@@ -642,6 +691,9 @@ class Lazy_rep_n final :
   void update_exact() const {
     update_exact_helper(std::make_index_sequence<sizeof...(L)>{});
   }
+  void prune_dag() const {
+    lazy_reset_member(l);
+  }
   template<class...LL>
   Lazy_rep_n(const AC& ac, const EC& ec, LL&&...ll) :
     Lazy_rep<AT, ET, E2A>(ac(CGAL::approx(ll)...)), EC(ec), l(std::forward<LL>(ll)...)
@@ -1150,6 +1202,12 @@ public :
     return ptr()->depth();
   }
 
+  void prune_dag() const
+  {
+    ptr()->exact();
+    ptr()->prune_dag();
+  }
+
   void print_dag(std::ostream& os, int level) const
   {
     ptr()->print_dag(os, level);
@@ -0,0 +1,173 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Exact_rational.h>
+#include <CGAL/Filtered_kernel/internal/Interval_batch_predicates.h>
+#include <CGAL/Random.h>
+
+#include <array>
+#include <cmath>
+#include <cassert>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_2 Point_2;
+typedef K::Point_3 Point_3;
+typedef CGAL::internal::Interval_pack Pack;
+typedef CGAL::Exact_rational ET;
+
+CGAL::Random rnd(0);
+
+// the conversion of denormals is not supported by all exact number types
+ET to_exact(double d)
+{
+  if(std::abs(d) > 1e-250)
+    return ET(d);
+  const double s = std::ldexp(1., 300);
+  return ET(d * s * s) / (ET(s) * ET(s));
+}
+
+// checks that the intervals of `p` contain the values `e`
+void check_enclosure(const Pack& p, const ET* e)
+{
+  double b[2*Pack::size];
+  p.bounds(b);
+  for(int k=0; k<Pack::size; ++k)
+    assert(to_exact(-b[2*k]) <= e[k] && e[k] <= to_exact(b[2*k+1]));
+}
+
+void test_pack()
+{
+  for(int n=0; n<10000; ++n)
+  {
+    double a[Pack::size], b[Pack::size];
+    ET ea[Pack::size], eb[Pack::size], sum[Pack::size], diff[Pack::size], prod[Pack::size], expr[Pack::size];
+    for(int k=0; k<Pack::size; ++k)
+    {
+      a[k] = rnd.get_double(-1, 1) * std::ldexp(1., rnd.get_int(-1060, 60));
+      b[k] = rnd.get_double(-1, 1) * std::ldexp(1., rnd.get_int(-60, 60));
+      ea[k] = to_exact(a[k]);
+      eb[k] = to_exact(b[k]);
+      sum[k] = ea[k] + eb[k];
+      diff[k] = ea[k] - eb[k];
+      prod[k] = ea[k] * eb[k];
+      expr[k] = (ea[k] - eb[k]) * (ea[k] + eb[k]) - ea[k] * ea[k];
+    }
+    const Pack pa(a), pb(b);
+    check_enclosure(pa + pb, sum);
+    check_enclosure(pa - pb, diff);
+    check_enclosure(pa * pb, prod);
+    check_enclosure((pa - pb) * (pa + pb) - pa * pa, expr);
+
+    // also when the rounding mode is upward
+    Pack r;
+    {
+      CGAL::Protect_FPU_rounding<true> P;
+      r = (pa - pb) * (pa + pb) - pa * pa;
+    }
+    check_enclosure(r, expr);
+  }
+
+  // overflows and NaNs give indeterminate signs
+  double big[Pack::size], zero[Pack::size], inf[Pack::size];
+  for(int k=0; k<Pack::size; ++k)
+  {
+    big[k] = 1e300;
+    zero[k] = 0;
+    inf[k] = std::numeric_limits<double>::infinity();
+  }
+  CGAL::Uncertain<CGAL::Sign> s[Pack::size];
+  (Pack(big) * Pack(big) - Pack(big) * Pack(big)).signs(s);
+  assert(CGAL::is_indeterminate(s[0]));
+  (Pack(big) * Pack(big) * Pack(zero)).signs(s);
+  assert(CGAL::is_indeterminate(s[0]));
+  (Pack(inf) - Pack(inf)).signs(s);
+  assert(CGAL::is_indeterminate(s[0]));
+  Pack(zero).signs(s);
+  assert(CGAL::is_certain(s[0]) && s[0] == CGAL::ZERO);
+  (Pack(zero) * Pack(big)).signs(s);
+  assert(CGAL::possibly(s[0] == CGAL::ZERO));
+  (Pack(big) * Pack(big)).signs(s);
+  assert(CGAL::is_certain(s[0]) && s[0] == CGAL::POSITIVE);
+}
+
+Point_3 random_point(bool on_grid)
+{
+  if(on_grid)
+    return Point_3(rnd.get_int(0, 4), rnd.get_int(0, 4), rnd.get_int(0, 4));
+  return Point_3(rnd.get_double(), rnd.get_double(), rnd.get_double());
+}
+
+void test_predicates(bool on_grid)
+{
+  std::vector<std::array<Point_3, 4> > tetrahedra(1001);
+  std::vector<std::array<Point_3, 5> > spheres(1001);
+  std::vector<std::array<Point_2, 3> > triangles(1001);
+  for(auto& t : tetrahedra)
+    for(Point_3& p : t)
+      p = random_point(on_grid);
+  for(auto& t : spheres)
+    for(Point_3& p : t)
+      p = random_point(on_grid);
+  for(auto& t : triangles)
+    for(Point_2& p : t)
+    {
+      const Point_3 q = random_point(on_grid);
+      p = Point_2(q.x(), q.y());
+    }
+
+  std::vector<CGAL::Uncertain<CGAL::Sign> > signs;
+  std::size_t certain = 0;
+
+  CGAL::internal::orientation_3_interval_batch(tetrahedra.begin(), tetrahedra.end(), std::back_inserter(signs));
+  assert(signs.size() == tetrahedra.size());
+  for(std::size_t i=0; i<signs.size(); ++i)
+  {
+    const auto& t = tetrahedra[i];
+    if(CGAL::is_certain(signs[i]))
+    {
+      assert(signs[i] == CGAL::orientation(t[0], t[1], t[2], t[3]));
+      ++certain;
+    }
+  }
+
+  signs.clear();
+  CGAL::internal::side_of_oriented_sphere_3_interval_batch(spheres.begin(), spheres.end(), std::back_inserter(signs));
+  assert(signs.size() == spheres.size());
+  for(std::size_t i=0; i<signs.size(); ++i)
+  {
+    const auto& t = spheres[i];
+    if(CGAL::is_certain(signs[i]))
+    {
+      assert(signs[i] == CGAL::side_of_oriented_sphere(t[0], t[1], t[2], t[3], t[4]));
+      ++certain;
+    }
+  }
+
+  signs.clear();
+  CGAL::internal::orientation_2_interval_batch(triangles.begin(), triangles.end(), std::back_inserter(signs));
+  assert(signs.size() == triangles.size());
+  for(std::size_t i=0; i<signs.size(); ++i)
+  {
+    const auto& t = triangles[i];
+    if(CGAL::is_certain(signs[i]))
+    {
+      assert(signs[i] == CGAL::orientation(t[0], t[1], t[2]));
+      ++certain;
+    }
+  }
+
+  std::cout << (on_grid ? "grid" : "random") << " points: " << certain << " certain signs out of 3003" << std::endl;
+  if(!on_grid)
+    assert(certain > 2990);
+}
+
+int main()
+{
+  std::cout << "Interval_pack::size = " << Pack::size << std::endl;
+  test_pack();
+  test_predicates(false);
+  test_predicates(true);
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+#define CGAL_LAZY_KERNEL_MEMORY_POOL
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+
+#include <cassert>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef K::FT FT;
+typedef K::Point_3 Point_3;
+typedef K::Weighted_point_3 Weighted_point_3;
+
+// creates and destroys DAGs of various node sizes
+FT build(int seed, int n)
+{
+  std::vector<Point_3> points;
+  FT sum = 0;
+  for(int i=0; i<n; ++i)
+  {
+    FT x(seed + i), y(i), z = x * y + 1;
+    points.push_back(Point_3(x, y, z));
+    sum = sum + z / 3;
+  }
+  std::vector<Point_3> midpoints;
+  for(std::size_t i=1; i<points.size(); ++i)
+    midpoints.push_back(CGAL::midpoint(points[i-1], points[i]));
+  for(const Point_3& p : midpoints)
+    sum = sum + p.x() - p.y();
+  return sum;
+}
+
+void test_prune_dag()
+{
+  // Lazy_exact_nt
+  FT a(1), b(3);
+  FT c = a / b + a;
+  assert(a.refs() > 1);
+  CGAL::prune_dag(c);
+  assert(a.refs() == 1 && b.refs() == 1);
+  assert(c == FT(4) / FT(3));
+
+  // the weighted points are not pruned when their exact value is computed while several threads run
+  std::thread([](){}).join();
+  Point_3 p(a, b, c);
+  std::vector<Weighted_point_3> wps;
+  for(int i=0; i<3; ++i)
+    wps.push_back(K().construct_weighted_point_3_object()(p, FT(i) / 7));
+  for(const Weighted_point_3& wp : wps)
+    CGAL::exact(wp);
+  CGAL::prune_dags(wps.begin(), wps.end());
+  assert(p.refs() == 1);
+  assert(wps[2].point() == p && wps[2].weight() == FT(2) / 7);
+
+  // nothing happens when the DAG has already been pruned
+  CGAL::prune_dag(c);
+  assert(c == FT(4) / FT(3));
+}
+
+void test_pool()
+{
+  const FT expected = build(0, 1000);
+
+  // nodes created by one thread and destroyed by another
+  std::vector<FT> results(4);
+  std::vector<std::thread> threads;
+  for(int t=0; t<4; ++t)
+    threads.emplace_back([&results, t](){ results[t] = build(0, 1000); });
+  for(std::thread& t : threads)
+    t.join();
+  for(const FT& r : results)
+    assert(r == expected);
+  results.clear();
+
+  // the nodes released by the threads that exited are reused
+  threads.clear();
+  for(int t=0; t<4; ++t)
+    threads.emplace_back([&expected](){
+      for(int i=0; i<3; ++i)
+        assert(build(0, 1000) == expected);
+    });
+  for(std::thread& t : threads)
+    t.join();
+}
+
+int main()
+{
+  test_prune_dag();
+  test_pool();
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
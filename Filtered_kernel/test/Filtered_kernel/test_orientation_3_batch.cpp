@@ -0,0 +1,125 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Filtered_kernel/internal/Static_filters/Plane_orientation_3.h>
+#include <CGAL/Random.h>
+
+#include <cassert>
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <list>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Epick;
+typedef CGAL::Exact_predicates_exact_constructions_kernel   Epeck;
+
+CGAL::Random rnd(0);
+
+template <class K>
+void check(const typename K::Point_3& p, const typename K::Point_3& q, const typename K::Point_3& r,
+           const std::vector<typename K::Point_3>& points)
+{
+  const typename K::Orientation_3 orientation = K().orientation_3_object();
+
+  std::vector<CGAL::Orientation> res;
+  CGAL::internal::orientations_3(orientation, p, q, r, points.begin(), points.end(),
+                                 std::back_inserter(res));
+  assert(res.size() == points.size());
+  for(std::size_t i=0; i<points.size(); ++i)
+    assert(res[i] == orientation(p, q, r, points[i]));
+
+  // in the upward rounding mode, as in the code protected by Protect_FPU_rounding
+  std::vector<CGAL::Orientation> upward_res;
+  {
+    CGAL::Protect_FPU_rounding<true> protection;
+    CGAL::internal::orientations_3(orientation, p, q, r, points.begin(), points.end(),
+                                   std::back_inserter(upward_res));
+  }
+  assert(upward_res == res);
+
+  // with the iterators of a list
+  const std::list<typename K::Point_3> point_list(points.begin(), points.end());
+  res.clear();
+  CGAL::internal::orientations_3(orientation, p, q, r, point_list.begin(), point_list.end(),
+                                 std::back_inserter(res));
+  assert(res.size() == points.size());
+  for(std::size_t i=0; i<points.size(); ++i)
+    assert(res[i] == orientation(p, q, r, points[i]));
+}
+
+template <class K>
+void test()
+{
+  typedef typename K::Point_3 Point_3;
+
+  // random points
+  std::vector<Point_3> points;
+  for(int i=0; i<1000; ++i)
+    points.push_back(Point_3(rnd.get_double(), rnd.get_double(), rnd.get_double()));
+  check<K>(points[0], points[1], points[2], points);
+  check<K>(points[0], points[0], points[2], points);
+  check<K>(points[0], points[1], points[2], std::vector<Point_3>());
+  check<K>(points[0], points[1], points[2], std::vector<Point_3>(points.begin(), points.begin()+5));
+
+  // points on and near the plane z = x + y, and points whose coordinates need special care
+  const Point_3 p(0, 0, 0), q(1, 0, 1), r(0, 1, 1);
+  points.clear();
+  for(int i=0; i<500; ++i)
+  {
+    const double x = rnd.get_double(-1, 1), y = rnd.get_double(-1, 1);
+    const double z = x + y;
+    points.push_back(Point_3(x, y, z));
+    points.push_back(Point_3(x, y, std::nextafter(z, 2.)));
+    points.push_back(Point_3(x, y, std::nextafter(z, -2.)));
+  }
+  points.push_back(Point_3(0, 0, 0));
+  points.push_back(Point_3(1e-200, 1e-200, 3e-200));
+  points.push_back(Point_3(1e200, 1e200, 2e200));
+  points.push_back(Point_3(1e200, 1e200, 3e200));
+  check<K>(p, q, r, points);
+  check<K>(p, r, q, points);
+
+  // all the points on the line x = y = 0, for which the filter returns ZERO directly
+  points.clear();
+  for(int i=0; i<10; ++i)
+    points.push_back(Point_3(0, 0, rnd.get_double()));
+  check<K>(points[0], points[1], points[2], points);
+}
+
+void test_filter()
+{
+  typedef CGAL::internal::Static_filters_predicates::Plane_orientation_filter_3 Filter;
+  const Filter filter(0, 0, 0, 1, 0, 0, 0, 1, 0);
+
+  std::vector<double> sx, sy, sz;
+  for(int i=0; i<103; ++i)
+  {
+    sx.push_back(rnd.get_double(-1, 1));
+    sy.push_back(rnd.get_double(-1, 1));
+    sz.push_back((i % 3 == 0) ? 1e-300 : rnd.get_double(-1, 1));
+  }
+  std::vector<int> res(sx.size());
+  const std::size_t failures = filter(sx.data(), sy.data(), sz.data(), sx.size(), res.data());
+  std::size_t n = 0;
+  for(std::size_t i=0; i<sx.size(); ++i)
+  {
+    assert(res[i] == filter(sx[i], sy[i], sz[i]));
+    if(res[i] == Filter::failure)
+      ++n;
+    else
+      assert(res[i] == CGAL::sign(sz[i]));
+  }
+  assert(n == failures);
+}
+
+int main()
+{
+  static_assert(CGAL::internal::Has_batched_orientations_3<Epick::Orientation_3>::value, "");
+  static_assert(! CGAL::internal::Has_batched_orientations_3<Epeck::Orientation_3>::value, "");
+
+  test_filter();
+  test<Epick>();
+  test<Epeck>();
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -20,6 +20,17 @@ between the two calls, thus refining the double approximation. If you
 want to avoid this behavior, you need to first call `exact()`
 (loosing the benefit of the lazyness if done systematically).
 
+The operations a number results from are stored in a directed acyclic graph,
+which is released when its exact value is computed. The function
+`CGAL::prune_dag(n)` computes the exact value of `n` and releases this graph;
+no other thread may access the graph during the call.
+If the macro `CGAL_LAZY_KERNEL_MEMORY_POOL` is defined, the nodes of the graphs
+of `Lazy_exact_nt` and of the objects of `Exact_predicates_exact_constructions_kernel`
+are allocated from memory pools local to each thread, instead of the global allocator.
+This memory is never given back to the system.
+With `CGAL_PROFILE`, the numbers of nodes and of exact evaluations, and the depths
+of the nodes, are reported at the end of the program.
+
 \tparam NT must be a model of concept `RealEmbeddable`, and at
 least model of concept `IntegralDomainWithoutDivision`.
 
@@ -0,0 +1,244 @@
+// Copyright (c) 2026  agent <agent@local>.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : agent <agent@local>
+
+#ifndef CGAL_NUMBER_TYPES_INTERNAL_INTERVAL_PACK_H
+#define CGAL_NUMBER_TYPES_INTERNAL_INTERVAL_PACK_H
+
+// This is an undocumented private helper for Filtered_kernel.
+
+#include <CGAL/config.h>
+#include <CGAL/FPU.h>
+#include <CGAL/enum.h>
+#include <CGAL/Uncertain.h>
+
+#include <limits>
+
+#if defined CGAL_HAS_SSE2 && defined __AVX__ && !defined CGAL_INTERVAL_PACK_NO_AVX
+#  define CGAL_INTERVAL_PACK_USE_AVX 1
+#  include <immintrin.h>
+#elif defined CGAL_HAS_SSE2
+#  define CGAL_INTERVAL_PACK_USE_SSE2 1
+#  include <emmintrin.h>
+#endif
+
+namespace CGAL {
+namespace internal {
+
+// A pack of `Interval_pack::size` intervals, whose arithmetic does not depend on the
+// rounding mode, so that it can be used without `Protect_FPU_rounding`.
+//
+// As in `Interval_nt`, the interval [i,s] is stored as the pair {-i,s} in two lanes of a
+// SIMD register, so that both bounds are upper bounds, computed with the same instructions.
+// The operations are evaluated in the current rounding mode, and each resulting bound c
+// is moved up by c*phi+eta, where phi = u(1+2u), u = 2^-53, and eta = 2^-1074, which gives
+// at least the successor of c in round-to-nearest mode (Rump, Zimmermann, Boldo, Melquiond,
+// "Computing predecessor and successor in rounding to nearest", BIT 2009).
+// The bounds are thus correct in round-to-nearest and round-upward modes, but not
+// in the two other modes, or if denormals are flushed to zero.
+//
+// With AVX, a pack holds two intervals; otherwise, it holds one.
+// Bounds that overflow become infinite, and products of zero and infinity give NaN,
+// which `signs()` reports as an indeterminate sign.
+class Interval_pack
+{
+public:
+#ifdef CGAL_INTERVAL_PACK_USE_AVX
+  static constexpr int size = 2;
+  typedef __m256d Vector;
+#elif defined CGAL_INTERVAL_PACK_USE_SSE2
+  static constexpr int size = 1;
+  typedef __m128d Vector;
+#else
+  static constexpr int size = 1;
+  struct Vector { double v[2]; };
+#endif
+
+  Interval_pack() {}
+
+  explicit Interval_pack(Vector v) : val(v) {}
+
+  // the pack of the points `d[0]`, ..., `d[size-1]`
+  explicit Interval_pack(const double* d)
+  {
+#ifdef CGAL_INTERVAL_PACK_USE_AVX
+    val = _mm256_setr_pd(-d[0], d[0], -d[1], d[1]);
+#elif defined CGAL_INTERVAL_PACK_USE_SSE2
+    val = _mm_setr_pd(-d[0], d[0]);
+#else
+    val.v[0] = -d[0];
+    val.v[1] = d[0];
+#endif
+  }
+
+  // the bounds of the intervals, as {-inf_0, sup_0, -inf_1, sup_1, ...}
+  void bounds(double* b) const
+  {
+#ifdef CGAL_INTERVAL_PACK_USE_AVX
+    _mm256_storeu_pd(b, val);
+#elif defined CGAL_INTERVAL_PACK_USE_SSE2
+    _mm_storeu_pd(b, val);
+#else
+    b[0] = val.v[0];
+    b[1] = val.v[1];
+#endif
+  }
+
+  // the signs of the intervals
+  void signs(Uncertain<Sign>* s) const
+  {
+    double b[2*size];
+    bounds(b);
+    for(int k=0; k<size; ++k)
+    {
+      const double mi = b[2*k], su = b[2*k+1];
+      if(mi < 0)
+        s[k] = POSITIVE;
+      else if(su < 0)
+        s[k] = NEGATIVE;
+      else if(mi == 0 && su == 0)
+        s[k] = ZERO;
+      else
+        s[k] = Uncertain<Sign>::indeterminate();
+    }
+  }
+
+  friend Interval_pack operator+(const Interval_pack& a, const Interval_pack& b)
+  {
+#ifdef CGAL_INTERVAL_PACK_USE_AVX
+    return Interval_pack(up(_mm256_add_pd(a.val, b.val)));
+#elif defined CGAL_INTERVAL_PACK_USE_SSE2
+    return Interval_pack(up(_mm_add_pd(a.val, b.val)));
+#else
+    return Interval_pack(up({{ a.val.v[0] + b.val.v[0], a.val.v[1] + b.val.v[1] }}));
+#endif
+  }
+
+  // -[i,s] = [-s,-i] is stored as {s,-i}, that is, swapped
+  friend Interval_pack operator-(const Interval_pack& a, const Interval_pack& b)
+  {
+#ifdef CGAL_INTERVAL_PACK_USE_AVX
+    return Interval_pack(up(_mm256_add_pd(a.val, _mm256_permute_pd(b.val, 5))));
+#elif defined CGAL_INTERVAL_PACK_USE_SSE2
+    return Interval_pack(up(_mm_add_pd(a.val, _mm_shuffle_pd(b.val, b.val, 1))));
+#else
+    return Interval_pack(up({{ a.val.v[0] + b.val.v[1], a.val.v[1] + b.val.v[0] }}));
+#endif
+  }
+
+  // Same as the SSE2 version of the product of `Interval_nt`: with a = {-ai,as} and b = {-bi,bs},
+  // the four products {-ai*bi,as*bs}, {-ai*bs,as*bi}, {-as*bi,ai*bs}, and {-as*bs,ai*bi}
+  // are computed at once, and their maximum gives {-inf,sup}.
+  friend Interval_pack operator*(const Interval_pack& a, const Interval_pack& b)
+  {
+#ifdef CGAL_INTERVAL_PACK_USE_AVX
+    const __m256d m = _mm256_setr_pd(-0., 0., -0., 0.);
+    const __m256d m1 = _mm256_set1_pd(-0.);
+    const __m256d ap = _mm256_xor_pd(_mm256_permute_pd(a.val, 5), m1); // {-as,ai}
+    const __m256d bz = _mm256_xor_pd(b.val, m);                         // {bi,bs}
+    const __m256d c = _mm256_permute_pd(bz, 5);                         // {bs,bi}
+    const __m256d x1 = _mm256_mul_pd(a.val, bz);
+    const __m256d x2 = _mm256_mul_pd(a.val, c);
+    const __m256d x3 = _mm256_mul_pd(ap, bz);
+    const __m256d x4 = _mm256_mul_pd(ap, c);
+    return Interval_pack(up(max(max(x1, x2), max(x3, x4))));
+#elif defined CGAL_INTERVAL_PACK_USE_SSE2
+    const __m128d m = _mm_set_sd(-0.);
+    const __m128d m1 = _mm_set1_pd(-0.);
+    const __m128d ap = _mm_xor_pd(_mm_shuffle_pd(a.val, a.val, 1), m1); // {-as,ai}
+    const __m128d bz = _mm_xor_pd(b.val, m);                            // {bi,bs}
+    const __m128d c = _mm_shuffle_pd(bz, bz, 1);                        // {bs,bi}
+    const __m128d x1 = _mm_mul_pd(a.val, bz);
+    const __m128d x2 = _mm_mul_pd(a.val, c);
+    const __m128d x3 = _mm_mul_pd(ap, bz);
+    const __m128d x4 = _mm_mul_pd(ap, c);
+    return Interval_pack(up(max(max(x1, x2), max(x3, x4))));
+#else
+    const double ai = -a.val.v[0], as = a.val.v[1];
+    const double bi = -b.val.v[0], bs = b.val.v[1];
+    const double p[4] = { ai*bi, ai*bs, as*bi, as*bs };
+    double lo = p[0], hi = p[0];
+    bool nan = (p[0] != p[0]);
+    for(int k=1; k<4; ++k)
+    {
+      nan = nan || (p[k] != p[k]);
+      lo = (p[k] < lo) ? p[k] : lo;
+      hi = (p[k] > hi) ? p[k] : hi;
+    }
+    if(nan)
+      lo = hi = std::numeric_limits<double>::quiet_NaN();
+    return Interval_pack(up({{ -lo, hi }}));
+#endif
+  }
+
+private:
+  Vector val;
+
+  // u(1+2u), computed exactly
+  static double phi()
+  {
+    return (std::numeric_limits<double>::epsilon() / 2) * (1 + std::numeric_limits<double>::epsilon());
+  }
+  static double eta() { return (std::numeric_limits<double>::denorm_min)(); }
+
+  // The maximum of the lanes, which is NaN when one of them is NaN.
+  // `_mm_max_pd()` returns its second argument when one is NaN.
+#ifdef CGAL_INTERVAL_PACK_USE_AVX
+  static __m256d max(__m256d x, __m256d y)
+  {
+    const __m256d nan = _mm256_cmp_pd(x, x, _CMP_UNORD_Q);
+    return _mm256_max_pd(x, _mm256_or_pd(y, nan));
+  }
+#elif defined CGAL_INTERVAL_PACK_USE_SSE2
+  static __m128d max(__m128d x, __m128d y)
+  {
+    const __m128d nan = _mm_cmpunord_pd(x, x);
+    return _mm_max_pd(x, _mm_or_pd(y, nan));
+  }
+#endif
+
+  // moves the upper bounds up to at least their successors. A bound of -infinity,
+  // which comes from an overflow, is first replaced by the lowest finite double.
+  // NaNs are kept, as `_mm_max_pd()` returns its second argument when one is NaN.
+#ifdef CGAL_INTERVAL_PACK_USE_AVX
+  static __m256d up(__m256d x)
+  {
+    x = _mm256_max_pd(_mm256_set1_pd(std::numeric_limits<double>::lowest()), x);
+    const __m256d ax = _mm256_andnot_pd(_mm256_set1_pd(-0.), x);
+    const __m256d e = _mm256_add_pd(_mm256_mul_pd(ax, _mm256_set1_pd(phi())), _mm256_set1_pd(eta()));
+    return _mm256_add_pd(x, e);
+  }
+#elif defined CGAL_INTERVAL_PACK_USE_SSE2
+  static __m128d up(__m128d x)
+  {
+    x = _mm_max_pd(_mm_set1_pd(std::numeric_limits<double>::lowest()), x);
+    const __m128d ax = _mm_andnot_pd(_mm_set1_pd(-0.), x);
+    const __m128d e = _mm_add_pd(_mm_mul_pd(ax, _mm_set1_pd(phi())), _mm_set1_pd(eta()));
+    return _mm_add_pd(x, e);
+  }
+#else
+  static double up(double x)
+  {
+    if(x < std::numeric_limits<double>::lowest())
+      x = std::numeric_limits<double>::lowest();
+    return x + ((x < 0 ? -x : x) * phi() + eta());
+  }
+  static Vector up(Vector x)
+  {
+    return {{ up(x.v[0]), up(x.v[1]) }};
+  }
+#endif
+};
+
+} // namespace internal
+} // namespace CGAL
+
+#endif // CGAL_NUMBER_TYPES_INTERNAL_INTERVAL_PACK_H
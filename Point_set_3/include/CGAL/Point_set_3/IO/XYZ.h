@@ -32,25 +32,16 @@ class Point_set_3;
 
 namespace IO {
 
-/*!
-  \ingroup PkgPointSet3IOXYZ
-
-  \brief reads the content of an intput stream in the \ref IOStreamXYZ into a point set.
-
-  If normals are present in the input stream, a normal map will be created and filled.
-
-  \param is the input stream
-  \param point_set the point set
+namespace internal {
 
-  \return `true` if the reading was successful, `false` otherwise.
- */
-template <typename Point, typename Vector>
-bool read_XYZ(std::istream& is,
-              CGAL::Point_set_3<Point, Vector>& point_set)
+// `Input` is either a stream or the name of a file
+template <typename Input, typename Point, typename Vector>
+bool read_point_set_XYZ(Input& input,
+                        CGAL::Point_set_3<Point, Vector>& point_set)
 {
   point_set.add_normal_map();
 
-  bool out = CGAL::IO::read_XYZ(is, point_set.index_back_inserter(),
+  bool out = CGAL::IO::read_XYZ(input, point_set.index_back_inserter(),
                                 CGAL::parameters::point_map(point_set.point_push_map())
                                                  .normal_map(point_set.normal_push_map()));
 
@@ -70,6 +61,27 @@ bool read_XYZ(std::istream& is,
   return out;
 }
 
+} // namespace internal
+
+/*!
+  \ingroup PkgPointSet3IOXYZ
+
+  \brief reads the content of an intput stream in the \ref IOStreamXYZ into a point set.
+
+  If normals are present in the input stream, a normal map will be created and filled.
+
+  \param is the input stream
+  \param point_set the point set
+
+  \return `true` if the reading was successful, `false` otherwise.
+ */
+template <typename Point, typename Vector>
+bool read_XYZ(std::istream& is,
+              CGAL::Point_set_3<Point, Vector>& point_set)
+{
+  return internal::read_point_set_XYZ(is, point_set);
+}
+
 /*!
   \ingroup PkgPointSet3IOXYZ
 
@@ -85,8 +97,7 @@ bool read_XYZ(std::istream& is,
 template <typename Point, typename Vector>
 bool read_XYZ(const std::string& fname, CGAL::Point_set_3<Point, Vector>& point_set)
 {
-  std::ifstream is(fname);
-  return read_XYZ(is, point_set);
+  return internal::read_point_set_XYZ(fname, point_set);
 }
 
 } // namespace IO
@@ -0,0 +1,82 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/process_point_set_in_tiles.h>
+#include <CGAL/remove_outliers.h>
+#include <CGAL/grid_simplify_point_set.h>
+#include <CGAL/IO/read_ply_points.h>
+#include <CGAL/IO/write_xyz_points.h>
+
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+
+// types
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point;
+typedef CGAL::Point_set_processing_3::Point_set_tile<Point> Tile;
+
+// Concurrency
+typedef CGAL::Parallel_if_available_tag Concurrency_tag;
+
+int main(int argc, char*argv[])
+{
+  const std::string fname = (argc>1)?argv[1]:CGAL::data_file_path("points_3/b9_training.ply");
+
+  std::ifstream stream(fname, std::ios_base::binary);
+  if(!stream)
+  {
+    std::cerr << "Error: cannot read file " << fname << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The input is streamed once: it is never entirely loaded in memory
+  auto read_points = [&](auto output) -> bool
+  {
+    return CGAL::IO::read_PLY<Point>(stream, output);
+  };
+
+  const double neighbor_radius = 1.; // radius used to detect outliers
+  const double cell_size = 2.;       // size of the simplification grid
+
+  std::vector<Point> output;
+  std::mutex output_mutex;
+
+  // Each tile is cleaned and simplified independently. The tiles overlap by the
+  // radius of the neighborhoods, so that the points of the core of a tile are
+  // processed as if the whole point set was in memory.
+  auto process_tile = [&](std::vector<Point>& points, const Tile& tile)
+  {
+    points.erase(CGAL::remove_outliers<CGAL::Sequential_tag>
+                 (points, 24,
+                  CGAL::parameters::threshold_percent(100.)
+                                   .threshold_distance(neighbor_radius)
+                                   .neighbor_radius(neighbor_radius)),
+                 points.end());
+    points.erase(CGAL::grid_simplify_point_set(points, cell_size), points.end());
+
+    // Only the points of the core are kept: the others belong to other tiles
+    std::lock_guard<std::mutex> lock(output_mutex);
+    for(const Point& p : points)
+      if(tile.is_in_core(p))
+        output.push_back(p);
+  };
+
+  if(!CGAL::process_point_set_in_tiles<Concurrency_tag, Point>
+     (read_points, process_tile,
+      CGAL::parameters::tile_size(20.)
+                       .tile_overlap(neighbor_radius)
+                       .maximum_number_of_points_in_memory(10000)))
+  {
+    std::cerr << "Error: cannot process file " << fname << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << output.size() << " point(s) kept" << std::endl;
+
+  if(!CGAL::IO::write_XYZ("b9_simplified.xyz", output,
+                          CGAL::parameters::stream_precision(17)))
+    return EXIT_FAILURE;
+
+  return EXIT_SUCCESS;
+}
@@ -469,7 +469,7 @@ bool read_LAS(std::istream& is,
   typedef typename CGAL::GetPointMap<PointRange, CGAL_NP_CLASS>::type PointMap;
   PointMap point_map = choose_parameter<PointMap>(get_parameter(np, internal_np::point_map));
 
-  return read_LAS_with_properties(is, output, make_las_point_reader(point_map));
+  return read_LAS_with_properties<OutputIteratorValueType>(is, output, make_las_point_reader(point_map));
 }
 
 /// \cond SKIP_IN_MANUAL
@@ -139,7 +139,7 @@ bool read_PLY_with_properties(std::istream& is,
                               PointOutputIterator output,
                               PropertyHandler&& ... properties)
 {
-  typedef typename value_type_traits<PointOutputIterator>::type OutputValueType;
+  typedef OutputIteratorValueType OutputValueType;
 
   if(!is)
     return false;
@@ -264,11 +264,11 @@ bool read_PLY(std::istream& is,
   NormalMap normal_map = NP_helper::get_normal_map(np);
 
   if(has_normals)
-    return read_PLY_with_properties(is, output,
-                                    make_ply_point_reader(point_map),
-                                    make_ply_normal_reader(normal_map));
+    return read_PLY_with_properties<OutputIteratorValueType>(is, output,
+                                                             make_ply_point_reader(point_map),
+                                                             make_ply_normal_reader(normal_map));
   // else
-  return read_PLY_with_properties(is, output, make_ply_point_reader(point_map));
+  return read_PLY_with_properties<OutputIteratorValueType>(is, output, make_ply_point_reader(point_map));
 }
 
 /**
@@ -20,6 +20,8 @@
 #include <CGAL/Origin.h>
 #include <CGAL/Kernel_traits.h>
 #include <CGAL/is_iterator.h>
+#include <CGAL/IO/Mapped_file.h>
+#include <CGAL/IO/Mapped_text_parsing.h>
 
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
@@ -28,11 +30,133 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 namespace CGAL {
 
 namespace IO {
 
+namespace internal {
+
+// Reads an XYZ file from a memory mapping of the file.
+//
+// The lines are split in chunks, which are parsed in parallel (if TBB is available)
+// once the points of each chunk have been counted. The points are then written
+// in `output` in the order of the file.
+//
+// Returns `MAPPED_READING_UNSUPPORTED` without writing in `output` if the number type is not
+// `double`, or if a line is not read in the same way as by the stream reader, so that the stream
+// reader handles (and reports) the content of the file.
+template <typename OutputIteratorValueType,
+          typename OutputIterator,
+          typename CGAL_NP_TEMPLATE_PARAMETERS>
+Mapped_reading_status read_mapped_XYZ(const std::string& fname,
+                                      OutputIterator& output,
+                                      const CGAL_NP_CLASS& np)
+{
+  typedef Point_set_processing_3::Fake_point_range<OutputIteratorValueType> PointRange;
+
+  typedef Point_set_processing_3_np_helper<PointRange, CGAL_NP_CLASS> NP_helper;
+  typedef typename NP_helper::Point_map PointMap;
+  typedef typename NP_helper::Normal_map NormalMap;
+  typedef typename NP_helper::Geom_traits Kernel;
+
+  typedef typename Kernel::FT FT;
+  typedef typename Kernel::Point_3 Point;
+  typedef typename Kernel::Vector_3 Vector;
+
+  // The stream reader extracts values of type `FT`
+  if(!std::is_same<FT, double>::value)
+    return MAPPED_READING_UNSUPPORTED;
+
+  Mapped_file file(fname);
+  if(!file.is_open())
+    return MAPPED_READING_UNSUPPORTED;
+
+  const char* begin = file.data();
+  enum Line_category { POINT = 0, NUMBER_OF_POINTS, IGNORED };
+
+  // Comments and lines made of spaces are ignored, and the first line may give the number of points
+  auto classify = [begin](const char* line, const char* line_end) -> std::size_t
+  {
+    const char* p = line;
+    while(p != line_end && *p == ' ')
+      ++ p;
+    if(p == line_end || *p == '#')
+      return IGNORED;
+
+    // other lines which are not points are reported by the stream reader
+    std::size_t n;
+    if(line == begin)
+    {
+      if(*p == '-' || *p == '+')
+        ++ p;
+      if(parse_ASCII_digits(p, line_end, n) && skip_ASCII_blanks(p, line_end) == line_end)
+        return NUMBER_OF_POINTS;
+    }
+    return POINT;
+  };
+
+  Line_chunks<2> chunks(begin, begin + file.size());
+  chunks.count_lines(classify);
+
+  const bool has_normals = NP_helper::has_normal_map();
+  const std::size_t nb_points = chunks.number_of_lines(POINT);
+  std::vector<Point> points(nb_points);
+  std::vector<Vector> normals(has_normals ? nb_points : 0);
+
+  const bool ok = chunks.parse_lines(classify,
+    [&](std::size_t category, const Line_chunks<2>::Line_indices& indices, const char* line, const char* line_end) -> bool
+    {
+      if(category != POINT)
+        return true;
+
+      double x, y, z;
+      if(!parse_ASCII_number(line, line_end, x) ||
+         !parse_ASCII_number(line, line_end, y) ||
+         !parse_ASCII_number(line, line_end, z))
+        return false;
+      points[indices[POINT]] = Point(x, y, z);
+
+      // anything after the point must be a normal
+      if(skip_ASCII_blanks(line, line_end) == line_end)
+      {
+        if(has_normals)
+          normals[indices[POINT]] = CGAL::NULL_VECTOR;
+        return true;
+      }
+
+      double nx, ny, nz;
+      if(!parse_ASCII_number(line, line_end, nx) ||
+         !parse_ASCII_number(line, line_end, ny) ||
+         !parse_ASCII_number(line, line_end, nz))
+        return false;
+      if(has_normals)
+        normals[indices[POINT]] = Vector(nx, ny, nz);
+      return true;
+    });
+
+  if(!ok)
+    return MAPPED_READING_UNSUPPORTED;
+
+  PointMap point_map = NP_helper::get_point_map(np);
+  NormalMap normal_map = NP_helper::get_normal_map(np);
+
+  for(std::size_t i = 0; i < nb_points; ++ i)
+  {
+    OutputIteratorValueType pwn;
+    put(point_map, pwn, points[i]);
+    if(has_normals)
+      put(normal_map, pwn, normals[i]);
+    *output++ = pwn;
+  }
+
+  return MAPPED_READING_SUCCESS;
+}
+
+} // namespace internal
+
 /**
    \ingroup PkgPointSetProcessing3IOXyz
 
@@ -228,6 +352,9 @@ bool read_XYZ(const std::string& fname,
               OutputIterator output,
               const CGAL_NP_CLASS& np = parameters::default_values())
 {
+  if(internal::read_mapped_XYZ<OutputIteratorValueType>(fname, output, np) == internal::MAPPED_READING_SUCCESS)
+    return true;
+
   std::ifstream is(fname);
   return read_XYZ<OutputIteratorValueType>(is, output, np);
 }
@@ -245,8 +372,7 @@ bool read_XYZ(std::istream& is, OutputIterator output, const CGAL_NP_CLASS& np =
 template <typename OutputIterator,typename CGAL_NP_TEMPLATE_PARAMETERS>
 bool read_XYZ(const std::string& fname, OutputIterator output, const CGAL_NP_CLASS& np = parameters::default_values())
 {
-  std::ifstream is(fname);
-  return read_XYZ<typename value_type_traits<OutputIterator>::type>(is, output, np);
+  return read_XYZ<typename value_type_traits<OutputIterator>::type>(fname, output, np);
 }
 
 } // namespace IO
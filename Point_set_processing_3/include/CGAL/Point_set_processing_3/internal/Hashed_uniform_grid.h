@@ -0,0 +1,168 @@
+// Copyright (c) 2026  agent <agent@local>.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent <agent@local>
+
+#ifndef CGAL_PSP_INTERNAL_HASHED_UNIFORM_GRID_H
+#define CGAL_PSP_INTERNAL_HASHED_UNIFORM_GRID_H
+
+#include <CGAL/license/Point_set_processing_3.h>
+
+#include <CGAL/point_set_processing_assertions.h>
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/number_utils.h>
+#include <CGAL/squared_distance_2.h>
+#include <CGAL/squared_distance_3.h>
+
+#include <boost/functional/hash.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+namespace Point_set_processing_3 {
+namespace internal {
+
+// Uniform grid whose non-empty cells are stored in a hash map. It answers
+// fixed-radius queries by scanning the cells overlapping the bounding box
+// of the query sphere, which is faster than a kd-tree for dense and roughly
+// uniform point sets when the size of the cells is close to the radius.
+//
+// The points are copied, grouped by cell, along with the iterator to
+// their input element.
+template <typename Point, typename Iterator, int D>
+class Hashed_uniform_grid
+{
+public:
+
+  typedef typename Kernel_traits<Point>::Kernel::FT FT;
+
+private:
+
+  typedef std::array<std::int64_t, D> Cell;
+
+  struct Hash_cell
+  {
+    std::size_t operator() (const Cell& cell) const
+    {
+      std::size_t seed = 0;
+      for (int i = 0; i < D; ++ i)
+        boost::hash_combine (seed, cell[i]);
+      return seed;
+    }
+  };
+
+  // range of the points of a cell in `m_points`
+  typedef std::pair<std::size_t, std::size_t> Range;
+
+  double m_cell_size;
+  std::vector<std::pair<Point, Iterator> > m_points;
+  std::unordered_map<Cell, Range, Hash_cell> m_cells;
+
+  std::int64_t cell_coordinate (double c) const
+  {
+    return static_cast<std::int64_t>(std::floor (c / m_cell_size));
+  }
+
+  Cell cell (const Point& p) const
+  {
+    Cell out;
+    for (int i = 0; i < D; ++ i)
+      out[i] = cell_coordinate (CGAL::to_double (p[i]));
+    return out;
+  }
+
+public:
+
+  template <typename PointMap>
+  Hashed_uniform_grid (Iterator begin, Iterator end, PointMap point_map, FT cell_size)
+    : m_cell_size (CGAL::to_double (cell_size))
+  {
+    CGAL_point_set_processing_precondition (cell_size > FT(0));
+
+    // Count the points of each cell...
+    std::size_t nb_points = 0;
+    for (Iterator it = begin; it != end; ++ it, ++ nb_points)
+      ++ m_cells[cell (get (point_map, *it))].second;
+
+    // ... set the beginning of each range...
+    std::size_t offset = 0;
+    for (auto& c : m_cells)
+    {
+      c.second.first = offset;
+      offset += c.second.second;
+      c.second.second = c.second.first;
+    }
+
+    // ... and fill the ranges
+    m_points.resize (nb_points);
+    for (Iterator it = begin; it != end; ++ it)
+    {
+      const Point& p = get (point_map, *it);
+      Range& range = m_cells[cell (p)];
+      m_points[range.second ++] = std::make_pair (p, it);
+    }
+  }
+
+  // Writes in `output` the iterators of the points whose distance to `query`
+  // is at most `radius`, stopping after `k` points, and returns their number.
+  template <typename OutputIterator>
+  unsigned int search (const Point& query, FT radius, unsigned int k, OutputIterator& output) const
+  {
+    const FT squared_radius = CGAL::square (radius);
+    const double r = CGAL::to_double (radius);
+
+    Cell lower, upper;
+    for (int i = 0; i < D; ++ i)
+    {
+      const double q = CGAL::to_double (query[i]);
+      lower[i] = cell_coordinate (q - r);
+      upper[i] = cell_coordinate (q + r);
+    }
+
+    unsigned int nb = 0;
+    Cell current = lower;
+    while (true)
+    {
+      auto found = m_cells.find (current);
+      if (found != m_cells.end())
+        for (std::size_t i = found->second.first; i < found->second.second; ++ i)
+          if (CGAL::squared_distance (query, m_points[i].first) <= squared_radius)
+          {
+            *(output ++) = m_points[i].second;
+            if (++ nb == k)
+              return nb;
+          }
+
+      // next cell of the box [lower, upper]
+      int i = 0;
+      for (; i < D; ++ i)
+      {
+        if (current[i] < upper[i])
+        {
+          ++ current[i];
+          break;
+        }
+        current[i] = lower[i];
+      }
+      if (i == D)
+        break;
+    }
+
+    return nb;
+  }
+};
+
+} } } // namespace CGAL::Point_set_processing_3::internal
+
+#endif // CGAL_PSP_INTERNAL_HASHED_UNIFORM_GRID_H
@@ -19,11 +19,14 @@
 #include <CGAL/Fuzzy_sphere.h>
 #include <CGAL/Orthogonal_k_neighbor_search.h>
 #include <CGAL/point_set_processing_assertions.h>
+#include <CGAL/Point_set_processing_3/internal/Hashed_uniform_grid.h>
 
 #include <CGAL/iterator.h>
 
 #include <boost/iterator/function_output_iterator.hpp>
 
+#include <memory>
+
 namespace CGAL {
 namespace Point_set_processing_3 {
 namespace internal {
@@ -83,6 +86,8 @@ public:
   typedef CGAL::Orthogonal_k_neighbor_search<Tree_traits, Distance, Splitter, Tree> Neighbor_search;
   typedef typename Neighbor_search::iterator Search_iterator;
 
+  typedef Hashed_uniform_grid<Point, input_iterator, (Is_2d::value ? 2 : 3)> Grid;
+
 private:
 
   PointRangeRef m_points;
@@ -91,13 +96,17 @@ private:
   Tree_traits m_traits;
   Tree m_tree;
   Distance m_distance;
+  std::unique_ptr<Grid> m_grid;
 
   // Forbid copy
   Neighbor_query (const Neighbor_query&) { }
 
 public:
 
-  Neighbor_query (PointRangeRef points, PointMap point_map)
+  // If `grid_cell_size` is not 0, the fixed-radius queries are answered by a
+  // hashed uniform grid with cells of this size instead of the kd-tree, which
+  // is still used for the k nearest neighbor queries.
+  Neighbor_query (PointRangeRef points, PointMap point_map, FT grid_cell_size = FT(0))
     : m_points (points)
     , m_point_map (point_map)
     , m_deref_map (point_map)
@@ -106,41 +115,65 @@ public:
     , m_distance (m_deref_map)
   {
     m_tree.build();
+    if (grid_cell_size != FT(0))
+      m_grid.reset (new Grid (m_points.begin(), m_points.end(), m_point_map, grid_cell_size));
   }
 
   PointMap point_map() const { return m_point_map; }
 
+  // Rebuilds the grid with cells of size `grid_cell_size`, for queries with another radius
+  void set_grid_cell_size (FT grid_cell_size)
+  {
+    CGAL_point_set_processing_precondition (m_grid != nullptr);
+    m_grid.reset (new Grid (m_points.begin(), m_points.end(), m_point_map, grid_cell_size));
+  }
+
+private:
+
+  template <typename OutputIterator>
+  unsigned int search_in_sphere (const Point& query, unsigned int k, FT neighbor_radius,
+                                 OutputIterator& output) const
+  {
+    if (m_grid)
+      return m_grid->search (query, neighbor_radius, k, output);
+
+    Sphere fs (query, neighbor_radius, 0, m_traits);
+    unsigned int nb = 0;
+
+    try
+    {
+      std::function<void(const input_iterator&)> output_iterator_with_limit
+        = [&](const input_iterator& it)
+        {
+          *(output ++) = it;
+          if (++ nb == k)
+            throw Maximum_points_reached_exception();
+        };
+
+      auto function_output_iterator
+        = boost::make_function_output_iterator (output_iterator_with_limit);
+
+      m_tree.search (function_output_iterator, fs);
+    }
+    catch (const Maximum_points_reached_exception&)
+    { }
+
+    return nb;
+  }
+
+public:
+
   template <typename OutputIterator>
   void get_iterators (const Point& query, unsigned int k, FT neighbor_radius,
                       OutputIterator output, unsigned int fallback_k_if_sphere_empty = 3) const
   {
     if (neighbor_radius != FT(0))
     {
-      Sphere fs (query, neighbor_radius, 0, m_traits);
-
       // if k=0, no limit on the number of neighbors returned
       if (k == 0)
         k = (std::numeric_limits<unsigned int>::max)();
 
-      unsigned int nb = 0;
-
-      try
-      {
-        std::function<void(const input_iterator&)> output_iterator_with_limit
-          = [&](const input_iterator& it)
-          {
-            *(output ++) = it;
-            if (++ nb == k)
-              throw Maximum_points_reached_exception();
-          };
-
-        auto function_output_iterator
-          = boost::make_function_output_iterator (output_iterator_with_limit);
-
-        m_tree.search (function_output_iterator, fs);
-      }
-      catch (const Maximum_points_reached_exception&)
-      { }
+      unsigned int nb = search_in_sphere (query, k, neighbor_radius, output);
 
       // Fallback, if not enough  points are return, search for the knn
       // first points
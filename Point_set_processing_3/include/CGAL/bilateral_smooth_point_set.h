@@ -221,6 +221,13 @@ compute_max_spacing(
                        query (to avoid overly large number of points in high density areas).}
      \cgalParamNEnd
 
+     \cgalParamNBegin{use_grid_for_radius_queries}
+       \cgalParamDescription{if `true`, the spherical neighborhoods are computed with a uniform grid
+                             instead of a kd-tree (see \ref Point_set_processing_3NeighborQueries)}
+       \cgalParamType{Boolean}
+       \cgalParamDefault{`false`}
+     \cgalParamNEnd
+
      \cgalParamNBegin{sharpness_angle}
        \cgalParamDescription{controls the sharpness of the result}
        \cgalParamType{floating scalar value}
@@ -295,6 +302,7 @@ bilateral_smooth_point_set(
   PointMap point_map = NP_helper::get_point_map(points, np);
   NormalMap normal_map = NP_helper::get_normal_map(points, np);
   FT neighbor_radius = choose_parameter(get_parameter(np, internal_np::neighbor_radius), FT(0));
+  const bool use_grid = choose_parameter(get_parameter(np, internal_np::use_grid_for_radius_queries), false);
 
   std::size_t nb_points = points.size();
 
@@ -302,7 +310,7 @@ bilateral_smooth_point_set(
    std::cout << "Initialization and compute max spacing: " << std::endl;
 #endif
    // initiate a KD-tree search for points
-   Neighbor_query neighbor_query (points, point_map);
+   Neighbor_query neighbor_query (points, point_map, use_grid ? neighbor_radius : FT(0));
 
    // Guess spacing
 #ifdef CGAL_PSP3_VERBOSE
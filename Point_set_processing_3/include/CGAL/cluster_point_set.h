@@ -103,6 +103,13 @@ CGAL::Emptyset_iterator get_adjacencies (const NamedParameters&, CGAL::Emptyset_
        \cgalParamDefault{`1` percent of the bounding box diagonal}
      \cgalParamNEnd
 
+     \cgalParamNBegin{use_grid_for_radius_queries}
+       \cgalParamDescription{if `true`, the spherical neighborhoods are computed with a uniform grid
+                             instead of a kd-tree (see \ref Point_set_processing_3NeighborQueries)}
+       \cgalParamType{Boolean}
+       \cgalParamDefault{`false`}
+     \cgalParamNEnd
+
      \cgalParamNBegin{attraction_factor}
        \cgalParamDescription{used to compute adjacencies between clusters.
                              Adjacencies are computed using a nearest neighbor graph built similarly
@@ -152,6 +159,7 @@ std::size_t cluster_point_set (PointRange& points,
   PointMap point_map = NP_helper::get_point_map(points, np);
   typename Kernel::FT neighbor_radius = choose_parameter(get_parameter(np, internal_np::neighbor_radius),
                                                          typename Kernel::FT(-1));
+  const bool use_grid = choose_parameter(get_parameter(np, internal_np::use_grid_for_radius_queries), false);
   typename Kernel::FT factor = choose_parameter(get_parameter(np, internal_np::attraction_factor),
                                                 typename Kernel::FT(2));
 
@@ -179,7 +187,7 @@ std::size_t cluster_point_set (PointRange& points,
   for (const value_type& p : points)
     put (cluster_map, p, Cluster_index_t(-1));
 
-  Neighbor_query neighbor_query (points, point_map);
+  Neighbor_query neighbor_query (points, point_map, use_grid ? neighbor_radius : typename Kernel::FT(0));
 
   std::queue<iterator> todo;
   std::size_t nb_clusters = 0;
@@ -225,6 +233,8 @@ std::size_t cluster_point_set (PointRange& points,
   {
     Adjacencies adjacencies = Point_set_processing_3::internal::get_adjacencies(np, (Adjacencies*)(nullptr));
     neighbor_radius *= factor;
+    if (use_grid)
+      neighbor_query.set_grid_cell_size (neighbor_radius);
 
     std::vector<iterator> neighbors;
     std::vector<std::pair<std::size_t, std::size_t> > adj;
@@ -135,6 +135,13 @@ jet_estimate_normal(const typename NeighborQuery::Point_3& query, ///< point to
                        query (to avoid overly large number of points in high density areas).}
      \cgalParamNEnd
 
+     \cgalParamNBegin{use_grid_for_radius_queries}
+       \cgalParamDescription{if `true`, the spherical neighborhoods are computed with a uniform grid
+                             instead of a kd-tree (see \ref Point_set_processing_3NeighborQueries)}
+       \cgalParamType{Boolean}
+       \cgalParamDefault{`false`}
+     \cgalParamNEnd
+
      \cgalParamNBegin{degree_fitting}
        \cgalParamDescription{the degree of fitting}
        \cgalParamType{unsigned int}
@@ -205,6 +212,7 @@ jet_estimate_normals(
   NormalMap normal_map = NP_helper::get_normal_map(points, np);
   unsigned int degree_fitting = choose_parameter(get_parameter(np, internal_np::degree_fitting), 2);
   FT neighbor_radius = choose_parameter(get_parameter(np, internal_np::neighbor_radius), FT(0));
+  const bool use_grid = choose_parameter(get_parameter(np, internal_np::use_grid_for_radius_queries), false);
 
   const std::function<bool(double)>& callback = choose_parameter(get_parameter(np, internal_np::callback),
                                                                std::function<bool(double)>());
@@ -224,7 +232,7 @@ jet_estimate_normals(
   CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
   CGAL_TRACE_STREAM << "  Creates KD-tree\n";
 
-  Neighbor_query neighbor_query (points, point_map);
+  Neighbor_query neighbor_query (points, point_map, use_grid ? neighbor_radius : FT(0));
 
   memory = CGAL::Memory_sizer().virtual_size();
   CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
@@ -136,6 +136,13 @@ jet_smooth_point(
                        query (to avoid overly large number of points in high density areas).}
      \cgalParamNEnd
 
+     \cgalParamNBegin{use_grid_for_radius_queries}
+       \cgalParamDescription{if `true`, the spherical neighborhoods are computed with a uniform grid
+                             instead of a kd-tree (see \ref Point_set_processing_3NeighborQueries)}
+       \cgalParamType{Boolean}
+       \cgalParamDefault{`false`}
+     \cgalParamNEnd
+
      \cgalParamNBegin{degree_fitting}
        \cgalParamDescription{the degree of fitting}
        \cgalParamType{unsigned int}
@@ -207,6 +214,7 @@ jet_smooth_point_set(
   PointMap point_map = NP_helper::get_point_map(points, np);
   typename Kernel::FT neighbor_radius = choose_parameter(get_parameter(np, internal_np::neighbor_radius),
                                                          typename Kernel::FT(0));
+  const bool use_grid = choose_parameter(get_parameter(np, internal_np::use_grid_for_radius_queries), false);
   unsigned int degree_fitting = choose_parameter(get_parameter(np, internal_np::degree_fitting), 2);
   unsigned int degree_monge = choose_parameter(get_parameter(np, internal_np::degree_monge), 2);
   const std::function<bool(double)>& callback = choose_parameter(get_parameter(np, internal_np::callback),
@@ -224,7 +232,7 @@ jet_smooth_point_set(
   CGAL_point_set_processing_precondition(k >= 2);
 
   // Instanciate a KD-tree search.
-  Neighbor_query neighbor_query (points, point_map);
+  Neighbor_query neighbor_query (points, point_map, use_grid ? neighbor_radius : typename Kernel::FT(0));
 
   // Iterates over input points and mutates them.
   // Implementation note: the cast to Point& allows to modify only the point's position.
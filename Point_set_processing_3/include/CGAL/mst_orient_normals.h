@@ -322,6 +322,7 @@ create_riemannian_graph(
     ConstrainedMap constrained_map, ///< property map ForwardIterator -> bool
     unsigned int k, ///< number of neighbors
     typename Kernel::FT neighbor_radius,
+    bool use_grid, ///< use a hashed uniform grid for the spherical neighborhoods
     const Kernel& /*kernel*/) ///< geometric traits.
 {
     // Input points types
@@ -346,7 +347,7 @@ create_riemannian_graph(
     CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
     CGAL_TRACE_STREAM << "  Creates KD-tree\n";
 
-    Neighbor_query neighbor_query (points, point_map);
+    Neighbor_query neighbor_query (points, point_map, use_grid ? neighbor_radius : typename Kernel::FT(0));
 
     memory = CGAL::Memory_sizer().virtual_size();
     CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
@@ -590,6 +591,13 @@ create_mst_graph(
                        query (to avoid overly large number of points in high density areas).}
      \cgalParamNEnd
 
+     \cgalParamNBegin{use_grid_for_radius_queries}
+       \cgalParamDescription{if `true`, the spherical neighborhoods are computed with a uniform grid
+                             instead of a kd-tree (see \ref Point_set_processing_3NeighborQueries)}
+       \cgalParamType{Boolean}
+       \cgalParamDefault{`false`}
+     \cgalParamNEnd
+
      \cgalParamNBegin{point_is_constrained_map}
        \cgalParamDescription{a property map containing information about points being constrained or not}
        \cgalParamType{a class model of `ReadablePropertyMap` with `PointRange::iterator::value_type`
@@ -637,6 +645,7 @@ mst_orient_normals(
     NormalMap normal_map = NP_helper::get_normal_map(points, np);
     typename Kernel::FT neighbor_radius = choose_parameter(get_parameter(np, internal_np::neighbor_radius),
                                                            typename Kernel::FT(0));
+    const bool use_grid = choose_parameter(get_parameter(np, internal_np::use_grid_for_radius_queries), false);
     ConstrainedMap constrained_map = choose_parameter<ConstrainedMap>(get_parameter(np, internal_np::point_is_constrained));
     Kernel kernel;
 
@@ -687,6 +696,7 @@ mst_orient_normals(
                                                                   kernel)),
                                                  k,
                                                  neighbor_radius,
+                                                 use_grid,
                                                  kernel);
     else
       riemannian_graph = create_riemannian_graph(points,
@@ -694,6 +704,7 @@ mst_orient_normals(
                                                  constrained_map,
                                                  k,
                                                  neighbor_radius,
+                                                 use_grid,
                                                  kernel);
 
     // Creates a Minimum Spanning Tree starting at source_point
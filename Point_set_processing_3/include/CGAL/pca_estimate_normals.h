@@ -124,6 +124,13 @@ pca_estimate_normal(const typename NeighborQuery::Kernel::Point_3& query, ///< p
                        query (to avoid overly large number of points in high density areas).}
      \cgalParamNEnd
 
+     \cgalParamNBegin{use_grid_for_radius_queries}
+       \cgalParamDescription{if `true`, the spherical neighborhoods are computed with a uniform grid
+                             instead of a kd-tree (see \ref Point_set_processing_3NeighborQueries)}
+       \cgalParamType{Boolean}
+       \cgalParamDefault{`false`}
+     \cgalParamNEnd
+
      \cgalParamNBegin{callback}
        \cgalParamDescription{a mechanism to get feedback on the advancement of the algorithm
                              while it's running and to interrupt it if needed}
@@ -173,6 +180,7 @@ pca_estimate_normals(
   PointMap point_map = NP_helper::get_point_map(points, np);
   NormalMap normal_map = NP_helper::get_normal_map(points, np);
   FT neighbor_radius = choose_parameter(get_parameter(np, internal_np::neighbor_radius), FT(0));
+  const bool use_grid = choose_parameter(get_parameter(np, internal_np::use_grid_for_radius_queries), false);
   const std::function<bool(double)>& callback = choose_parameter(get_parameter(np, internal_np::callback),
                                                                  std::function<bool(double)>());
 
@@ -195,7 +203,7 @@ pca_estimate_normals(
   CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
   CGAL_TRACE_STREAM << "  Creates KD-tree\n";
 
-  Neighbor_query neighbor_query (points, point_map);
+  Neighbor_query neighbor_query (points, point_map, use_grid ? neighbor_radius : FT(0));
 
   memory = CGAL::Memory_sizer().virtual_size();
   CGAL_TRACE_STREAM << (memory >> 20) << " Mb allocated\n";
@@ -0,0 +1,410 @@
+// Copyright (c) 2026  agent <agent@local>.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s) : agent <agent@local>
+
+#ifndef CGAL_PROCESS_POINT_SET_IN_TILES_H
+#define CGAL_PROCESS_POINT_SET_IN_TILES_H
+
+#include <CGAL/license/Point_set_processing_3.h>
+
+#include <CGAL/disable_warnings.h>
+
+#include <CGAL/Bbox_3.h>
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/for_each.h>
+#include <CGAL/point_set_processing_assertions.h>
+
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+
+#include <boost/iterator/function_output_iterator.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <type_traits>
+#include <vector>
+
+namespace CGAL {
+
+namespace Point_set_processing_3 {
+
+/// \cond SKIP_IN_MANUAL
+namespace internal {
+
+// Regular partition of the xy-plane in square tiles. The indices of the
+// tiles are clamped, so that the border tiles extend to infinity.
+struct Tiling
+{
+  double xmin, ymin, size;
+  std::size_t nx, ny;
+
+  std::size_t coordinate_index (double c, double cmin, std::size_t n) const
+  {
+    const double i = std::floor ((c - cmin) / size);
+    if (i < 0.)
+      return 0;
+    if (i >= double(n - 1))
+      return n - 1;
+    return static_cast<std::size_t>(i);
+  }
+
+  std::size_t x_index (double x) const { return coordinate_index (x, xmin, nx); }
+  std::size_t y_index (double y) const { return coordinate_index (y, ymin, ny); }
+};
+
+// Binary temporary file, removed when closed
+class Temporary_file
+{
+  std::FILE* m_file;
+  bool m_good;
+
+public:
+
+  Temporary_file() : m_file (std::tmpfile()), m_good (m_file != nullptr) { }
+  ~Temporary_file() { close(); }
+
+  Temporary_file (const Temporary_file&) = delete;
+  Temporary_file& operator= (const Temporary_file&) = delete;
+  Temporary_file (Temporary_file&& other)
+    : m_file (other.m_file), m_good (other.m_good)
+  {
+    other.m_file = nullptr;
+  }
+
+  bool good() const { return m_good; }
+
+  template <typename T>
+  void write (const T& t)
+  {
+    if (m_good && std::fwrite (&t, sizeof(T), 1, m_file) != 1)
+      m_good = false;
+  }
+
+  template <typename T>
+  bool read (T& t)
+  {
+    return m_good && std::fread (&t, sizeof(T), 1, m_file) == 1;
+  }
+
+  void rewind()
+  {
+    if (m_good && std::fflush (m_file) != 0)
+      m_good = false;
+    if (m_good)
+      std::rewind (m_file);
+  }
+
+  void close()
+  {
+    if (m_file != nullptr)
+      std::fclose (m_file);
+    m_file = nullptr;
+  }
+};
+
+} // namespace internal
+/// \endcond
+
+/**
+   \ingroup PkgPointSetProcessing3Algorithms
+
+   A tile of the partition of the point set used by `CGAL::process_point_set_in_tiles()`.
+
+   The tiles form a regular grid of squares in the xy-plane. Each point is in the
+   core of exactly one tile, and the border tiles extend to infinity. The points
+   passed to the tile processor are the ones of its core and the ones of its overlap,
+   that is the points of the square obtained by offsetting the core by the overlap.
+
+   \tparam Point the point type.
+*/
+template <typename Point>
+class Point_set_tile
+{
+  internal::Tiling m_tiling;
+  std::size_t m_x, m_y;
+  Bbox_3 m_bbox;
+
+public:
+
+  /// \cond SKIP_IN_MANUAL
+  Point_set_tile (const internal::Tiling& tiling, std::size_t x, std::size_t y, const Bbox_3& bbox)
+    : m_tiling (tiling), m_x (x), m_y (y)
+    , m_bbox (tiling.xmin + x * tiling.size, tiling.ymin + y * tiling.size, bbox.zmin(),
+              tiling.xmin + (x + 1) * tiling.size, tiling.ymin + (y + 1) * tiling.size, bbox.zmax())
+  { }
+  /// \endcond
+
+  /// returns the index of the tile in the grid, between 0 and the number of tiles minus 1.
+  std::size_t index() const { return m_y * m_tiling.nx + m_x; }
+
+  /// returns the bounding box of the core of the tile, whose z-range is the one of the point set.
+  const Bbox_3& bbox() const { return m_bbox; }
+
+  /// returns `true` if `p` is in the core of the tile. The results computed on a point
+  /// of the tile should only be kept if this point is in the core of the tile.
+  bool is_in_core (const Point& p) const
+  {
+    return m_tiling.x_index (CGAL::to_double (p.x())) == m_x
+        && m_tiling.y_index (CGAL::to_double (p.y())) == m_y;
+  }
+};
+
+} // namespace Point_set_processing_3
+
+/**
+   \ingroup PkgPointSetProcessing3Algorithms
+
+   Processes a point set too large to fit in memory by tiles.
+
+   The points are streamed once from the input by `read_points` and stored in temporary
+   binary files. They are then partitioned in square tiles of the xy-plane, adapted to
+   aerial acquisitions, and the tiles are loaded in memory by batches whose number of points
+   is bounded, including the points of the overlap of the tiles. The tiles of a batch are passed
+   to `process_tile`, in parallel if `ConcurrencyTag` is `Parallel_tag`, which typically runs
+   algorithms of this package on the points of the tile and streams the results
+   computed on the points of the core of the tile to disk.
+
+   Algorithms whose result on a point only depends on its neighborhood, such as
+   `remove_outliers()`, `pca_estimate_normals()`, or `grid_simplify_point_set()` with a grid
+   aligned on the tiles, give the same results as on the whole point set if the overlap is larger
+   than the size of the neighborhoods.
+
+   \tparam ConcurrencyTag enables sequential versus parallel processing of the tiles.
+                          Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+   \tparam Point the point type, a trivially copyable `Point_3` of a \cgal kernel.
+   \tparam PointReader a functor with an operator `bool operator()(OutputIterator output)`, for any
+                       output iterator `output` accepting objects of type `Point`, which writes all the points
+                       of the input in `output` and returns `true` on success, for example using `IO::read_PLY()`
+                       or `IO::read_LAS()`.
+   \tparam TileProcessor a functor with an operator `void operator()(std::vector<Point>& points,
+                         const Point_set_processing_3::Point_set_tile<Point>& tile)`, which processes
+                         the points of a tile. The points can be modified. If `ConcurrencyTag` is `Parallel_tag`,
+                         it is called concurrently for different tiles.
+
+   \param read_points the reader of the input points
+   \param process_tile the processor of the tiles
+   \param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+   \cgalNamedParamsBegin
+     \cgalParamNBegin{tile_size}
+       \cgalParamDescription{the size of the sides of the square tiles}
+       \cgalParamType{double}
+       \cgalParamDefault{such that a tile contains on average one sixteenth of `maximum_number_of_points_in_memory` points}
+       \cgalParamExtra{The tiling must not have more than four tiles per input point.}
+     \cgalParamNEnd
+
+     \cgalParamNBegin{tile_overlap}
+       \cgalParamDescription{the offset of the core of the tiles in the xy-plane within which the points
+                             are added to the points of the tile, so that the neighborhoods of the points of the core are complete}
+       \cgalParamType{double}
+       \cgalParamDefault{`0`}
+     \cgalParamNEnd
+
+     \cgalParamNBegin{maximum_number_of_points_in_memory}
+       \cgalParamDescription{the maximum number of points of the batches of tiles loaded at once}
+       \cgalParamType{`std::size_t`}
+       \cgalParamDefault{\f$ 2^{24} \f$}
+       \cgalParamExtra{A tile that contains more points is loaded alone.}
+     \cgalParamNEnd
+   \cgalNamedParamsEnd
+
+   \return `true` if the input was read and all the tiles were processed, `false` if `read_points`
+   returned `false`, if `tile_size` gives more than four tiles per input point, or if a temporary
+   file could not be written or read.
+*/
+template <typename ConcurrencyTag,
+          typename Point,
+          typename PointReader,
+          typename TileProcessor,
+          typename CGAL_NP_TEMPLATE_PARAMETERS>
+bool process_point_set_in_tiles (PointReader read_points,
+                                 TileProcessor process_tile,
+                                 const CGAL_NP_CLASS& np = parameters::default_values())
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef Point_set_processing_3::internal::Tiling Tiling;
+  typedef Point_set_processing_3::internal::Temporary_file Temporary_file;
+  typedef Point_set_processing_3::Point_set_tile<Point> Tile;
+
+  CGAL_static_assertion_msg (std::is_trivially_copyable<Point>::value,
+                             "Error: the points must be trivially copyable to be stored in temporary files");
+
+  double tile_size = choose_parameter (get_parameter (np, internal_np::tile_size), 0.);
+  const double tile_overlap = choose_parameter (get_parameter (np, internal_np::tile_overlap), 0.);
+  const std::size_t maximum_number_of_points_in_memory
+    = choose_parameter (get_parameter (np, internal_np::maximum_number_of_points_in_memory), std::size_t(1) << 24);
+
+  CGAL_point_set_processing_precondition (tile_size >= 0.);
+  CGAL_point_set_processing_precondition (tile_overlap >= 0.);
+  CGAL_point_set_processing_precondition (maximum_number_of_points_in_memory > 0);
+
+  // Stream the input points to a temporary file
+  Temporary_file all_points;
+  Bbox_3 bbox;
+  std::size_t nb_points = 0;
+  if (!read_points (boost::make_function_output_iterator
+                    ([&](const Point& p)
+                     {
+                       bbox += p.bbox();
+                       ++ nb_points;
+                       all_points.write (p);
+                     })))
+    return false;
+
+  all_points.rewind();
+  if (!all_points.good())
+    return false;
+  if (nb_points == 0)
+    return true;
+
+  // Partition the xy-plane in tiles. The automatic tiling has at most `target_nb_tiles`
+  // tiles along each axis, so at most 3 * `target_nb_tiles` + 1 tiles, which is
+  // at most 4 * `nb_points`: finer tilings, whose counters would need more memory
+  // than the points, are rejected.
+  const double dx = bbox.xmax() - bbox.xmin();
+  const double dy = bbox.ymax() - bbox.ymin();
+  if (tile_size == 0.)
+  {
+    const double target_nb_tiles
+      = (std::min) (std::ceil (16. * double(nb_points) / double(maximum_number_of_points_in_memory)),
+                    double(nb_points));
+    tile_size = (std::max) (std::sqrt (dx * dy / target_nb_tiles),
+                            (std::max) (dx, dy) / target_nb_tiles);
+    if (tile_size == 0.)
+      tile_size = 1.;
+  }
+
+  const double nx = (std::max) (1., std::ceil (dx / tile_size));
+  const double ny = (std::max) (1., std::ceil (dy / tile_size));
+  if (!(nx * ny <= 4. * double(nb_points)))
+    return false;
+
+  Tiling tiling;
+  tiling.xmin = bbox.xmin();
+  tiling.ymin = bbox.ymin();
+  tiling.size = tile_size;
+  tiling.nx = static_cast<std::size_t>(nx);
+  tiling.ny = static_cast<std::size_t>(ny);
+  const std::size_t nb_tiles = tiling.nx * tiling.ny;
+
+  // calls `f` on the index of each tile whose core or overlap contains `p`
+  auto for_each_tile_of = [&](const Point& p, auto f)
+  {
+    const double x = CGAL::to_double (p.x()), y = CGAL::to_double (p.y());
+    const std::size_t ymax = tiling.y_index (y + tile_overlap);
+    for (std::size_t iy = tiling.y_index (y - tile_overlap); iy <= ymax; ++ iy)
+    {
+      const std::size_t xmax = tiling.x_index (x + tile_overlap);
+      for (std::size_t ix = tiling.x_index (x - tile_overlap); ix <= xmax; ++ ix)
+        f (iy * tiling.nx + ix);
+    }
+  };
+
+  // Count the points of each tile...
+  std::vector<std::size_t> tile_sizes (nb_tiles, 0);
+  std::vector<std::size_t> tile_core_sizes (nb_tiles, 0);
+  Point p;
+  for (std::size_t i = 0; i < nb_points; ++ i)
+  {
+    if (!all_points.read (p))
+      return false;
+    for_each_tile_of (p, [&](std::size_t t) { ++ tile_sizes[t]; });
+    ++ tile_core_sizes[tiling.y_index (CGAL::to_double (p.y())) * tiling.nx
+                       + tiling.x_index (CGAL::to_double (p.x()))];
+  }
+
+  // ... group the consecutive tiles in batches of bounded size...
+  std::vector<std::size_t> batch_begin (1, 0);
+  std::vector<std::size_t> tile_batch (nb_tiles);
+  std::size_t batch_size = 0;
+  for (std::size_t t = 0; t < nb_tiles; ++ t)
+  {
+    if (batch_size != 0 && batch_size + tile_sizes[t] > maximum_number_of_points_in_memory)
+    {
+      batch_begin.push_back (t);
+      batch_size = 0;
+    }
+    batch_size += tile_sizes[t];
+    tile_batch[t] = batch_begin.size() - 1;
+  }
+  batch_begin.push_back (nb_tiles);
+  const std::size_t nb_batches = batch_begin.size() - 1;
+
+  // ... and dispatch the points in one temporary file per batch
+  std::vector<Temporary_file> batch_files;
+  batch_files.reserve (nb_batches);
+  for (std::size_t b = 0; b < nb_batches; ++ b)
+    batch_files.emplace_back();
+
+  all_points.rewind();
+  for (std::size_t i = 0; i < nb_points; ++ i)
+  {
+    if (!all_points.read (p))
+      return false;
+    for_each_tile_of (p, [&](std::size_t t)
+                         {
+                           Temporary_file& file = batch_files[tile_batch[t]];
+                           file.write (t);
+                           file.write (p);
+                         });
+  }
+  all_points.close();
+
+  // Process the tiles batch by batch
+  for (std::size_t b = 0; b < nb_batches; ++ b)
+  {
+    Temporary_file& file = batch_files[b];
+    file.rewind();
+    if (!file.good())
+      return false;
+
+    const std::size_t first = batch_begin[b], last = batch_begin[b + 1];
+    std::vector<std::vector<Point> > tile_points (last - first);
+    std::vector<std::size_t> tiles;
+    std::size_t nb_batch_points = 0;
+    for (std::size_t t = first; t < last; ++ t)
+    {
+      tile_points[t - first].reserve (tile_sizes[t]);
+      nb_batch_points += tile_sizes[t];
+      if (tile_core_sizes[t] != 0)
+        tiles.push_back (t);
+    }
+
+    std::size_t t;
+    for (std::size_t i = 0; i < nb_batch_points; ++ i)
+    {
+      if (!file.read (t) || !file.read (p))
+        return false;
+      tile_points[t - first].push_back (p);
+    }
+    file.close();
+
+    CGAL::for_each<ConcurrencyTag>
+      (tiles,
+       [&](const std::size_t& t) -> bool
+       {
+         std::vector<Point>& points = tile_points[t - first];
+         process_tile (points, Tile (tiling, t % tiling.nx, t / tiling.nx, bbox));
+         std::vector<Point>().swap (points);
+         return true;
+       });
+  }
+
+  return true;
+}
+
+} // namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif // CGAL_PROCESS_POINT_SET_IN_TILES_H
@@ -0,0 +1,110 @@
+// neighbor_query_test.cpp
+
+//----------------------------------------------------------
+// Test the fixed-radius queries answered by the hashed uniform grid:
+// they must find the same neighbors as the kd-tree.
+// No input file.
+//----------------------------------------------------------
+
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/property_map.h>
+
+#include <CGAL/Point_set_processing_3/internal/Neighbor_query.h>
+#include <CGAL/remove_outliers.h>
+#include <CGAL/cluster_point_set.h>
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Simple_cartesian<double> Kernel;
+typedef Kernel::FT FT;
+typedef Kernel::Point_2 Point_2;
+typedef Kernel::Point_3 Point_3;
+
+template <typename Point>
+void test_neighbor_query(std::vector<Point>& points, const FT radius)
+{
+  typedef CGAL::Identity_property_map<Point> Point_map;
+  typedef CGAL::Point_set_processing_3::internal::Neighbor_query<Kernel, std::vector<Point>&, Point_map>
+    Neighbor_query;
+  typedef typename std::vector<Point>::iterator iterator;
+
+  Neighbor_query tree_query (points, Point_map());
+  Neighbor_query grid_query (points, Point_map(), radius);
+
+  std::size_t nb_neighbors = 0;
+  for (std::size_t i = 0; i < points.size(); i += 7)
+  {
+    for (const FT r : { radius, radius / 3, radius * 2 })
+    {
+      std::vector<iterator> tree_neighbors, grid_neighbors;
+      tree_query.get_iterators (points[i], 0, r, std::back_inserter (tree_neighbors));
+      grid_query.get_iterators (points[i], 0, r, std::back_inserter (grid_neighbors));
+      std::sort (tree_neighbors.begin(), tree_neighbors.end());
+      std::sort (grid_neighbors.begin(), grid_neighbors.end());
+      assert (tree_neighbors == grid_neighbors);
+      nb_neighbors += grid_neighbors.size();
+    }
+
+    // the number of neighbors is limited by k
+    std::vector<iterator> tree_neighbors, grid_neighbors;
+    tree_query.get_iterators (points[i], 5, radius * 2, std::back_inserter (tree_neighbors));
+    grid_query.get_iterators (points[i], 5, radius * 2, std::back_inserter (grid_neighbors));
+    assert (grid_neighbors.size() == tree_neighbors.size());
+  }
+  std::cerr << nb_neighbors << " neighbors found" << std::endl;
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+
+  std::vector<Point_2> points_2;
+  std::copy_n (CGAL::Random_points_in_square_2<Point_2>(1., rnd), 5000, std::back_inserter (points_2));
+  test_neighbor_query (points_2, 0.05);
+
+  std::vector<Point_3> points_3;
+  std::copy_n (CGAL::Random_points_in_cube_3<Point_3>(1., rnd), 5000, std::back_inserter (points_3));
+  test_neighbor_query (points_3, 0.1);
+
+  // an algorithm gives the same result with both backends
+  std::vector<Point_3> outliers_tree = points_3, outliers_grid = points_3;
+  outliers_tree.erase (CGAL::remove_outliers<CGAL::Parallel_if_available_tag>
+                       (outliers_tree, 24, CGAL::parameters::threshold_percent(5.).neighbor_radius(0.1)),
+                       outliers_tree.end());
+  outliers_grid.erase (CGAL::remove_outliers<CGAL::Parallel_if_available_tag>
+                       (outliers_grid, 24, CGAL::parameters::threshold_percent(5.).neighbor_radius(0.1)
+                                           .use_grid_for_radius_queries(true)),
+                       outliers_grid.end());
+  assert (outliers_tree.size() == outliers_grid.size());
+
+  // the adjacencies of the clusters are queried with a larger radius than the clusters
+  typedef boost::associative_property_map<std::map<Point_3, int> > Cluster_map;
+  std::map<Point_3, int> clusters_tree, clusters_grid;
+  std::vector<std::pair<std::size_t, std::size_t> > adjacencies_tree, adjacencies_grid;
+  std::size_t nb_clusters_tree
+    = CGAL::cluster_point_set (points_3, Cluster_map (clusters_tree),
+                               CGAL::parameters::neighbor_radius(0.03).attraction_factor(3.)
+                                                .adjacencies(std::back_inserter (adjacencies_tree)));
+  std::size_t nb_clusters_grid
+    = CGAL::cluster_point_set (points_3, Cluster_map (clusters_grid),
+                               CGAL::parameters::neighbor_radius(0.03).attraction_factor(3.)
+                                                .use_grid_for_radius_queries(true)
+                                                .adjacencies(std::back_inserter (adjacencies_grid)));
+  assert (nb_clusters_tree > 1);
+  assert (nb_clusters_tree == nb_clusters_grid);
+  assert (clusters_tree == clusters_grid);
+  std::sort (adjacencies_tree.begin(), adjacencies_tree.end());
+  std::sort (adjacencies_grid.begin(), adjacencies_grid.end());
+  assert (!adjacencies_tree.empty());
+  assert (adjacencies_tree == adjacencies_grid);
+
+  std::cerr << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,143 @@
+// process_point_set_in_tiles_test.cpp
+
+//----------------------------------------------------------
+// Test the processing of a point set by tiles:
+// each point is in the core of exactly one tile, and the
+// neighborhoods smaller than the overlap are complete.
+// No input file.
+//----------------------------------------------------------
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/process_point_set_in_tiles.h>
+#include <CGAL/IO/write_ply_points.h>
+#include <CGAL/IO/read_ply_points.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <atomic>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point;
+typedef CGAL::Point_set_processing_3::Point_set_tile<Point> Tile;
+
+const double radius = 0.25;
+
+std::size_t number_of_neighbors (const Point& query, const std::vector<Point>& points)
+{
+  return std::count_if (points.begin(), points.end(),
+                        [&](const Point& p) { return CGAL::squared_distance (p, query) <= radius * radius; });
+}
+
+template <typename ConcurrencyTag, typename PointReader>
+void test (PointReader read_points, const std::vector<Point>& points)
+{
+  std::vector<Point> sorted_points (points);
+  std::sort (sorted_points.begin(), sorted_points.end());
+
+  std::vector<std::atomic<int> > nb_owners (points.size());
+  for (std::atomic<int>& nb : nb_owners)
+    nb = 0;
+  std::atomic<std::size_t> nb_tiles (0);
+
+  const bool ok = CGAL::process_point_set_in_tiles<ConcurrencyTag, Point>
+    (read_points,
+     [&](std::vector<Point>& tile_points, const Tile& tile)
+     {
+       ++ nb_tiles;
+
+       // the tile contains the points of its core offset by the overlap
+       const CGAL::Bbox_3& bbox = tile.bbox();
+       for (const Point& p : tile_points)
+       {
+         assert (p.x() >= bbox.xmin() - radius || tile.is_in_core (p));
+         assert (p.x() <= bbox.xmax() + radius || tile.is_in_core (p));
+         assert (p.y() >= bbox.ymin() - radius || tile.is_in_core (p));
+         assert (p.y() <= bbox.ymax() + radius || tile.is_in_core (p));
+       }
+
+       for (const Point& p : tile_points)
+       {
+         if (!tile.is_in_core (p))
+           continue;
+
+         std::size_t index = std::lower_bound (sorted_points.begin(), sorted_points.end(), p)
+           - sorted_points.begin();
+         ++ nb_owners[index];
+
+         // the neighborhoods are complete
+         assert (number_of_neighbors (p, tile_points) == number_of_neighbors (p, points));
+       }
+     },
+     CGAL::parameters::tile_size(1.).tile_overlap(radius).maximum_number_of_points_in_memory(500));
+  assert (ok);
+  assert (nb_tiles > 1);
+
+  for (const std::atomic<int>& nb : nb_owners)
+    assert (nb == 1);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  std::vector<Point> points;
+  for (std::size_t i = 0; i < 5000; ++ i)
+    points.emplace_back (rnd.get_double (0., 6.), rnd.get_double (0., 4.), rnd.get_double (0., 0.5));
+
+  auto read_vector = [&](auto output) -> bool
+  {
+    std::copy (points.begin(), points.end(), output);
+    return true;
+  };
+  test<CGAL::Sequential_tag> (read_vector, points);
+  test<CGAL::Parallel_if_available_tag> (read_vector, points);
+
+  // streaming from a PLY file
+  std::stringstream ply;
+  CGAL::IO::set_binary_mode (ply);
+  assert (CGAL::IO::write_PLY (ply, points));
+  auto read_ply = [&](auto output) -> bool
+  {
+    return CGAL::IO::read_PLY<Point> (ply, output);
+  };
+  test<CGAL::Parallel_if_available_tag> (read_ply, points);
+
+  // without overlap, each point is in a single tile
+  std::size_t nb_points = 0;
+  assert ((CGAL::process_point_set_in_tiles<CGAL::Sequential_tag, Point>
+           (read_vector, [&](std::vector<Point>& tile_points, const Tile&) { nb_points += tile_points.size(); })));
+  assert (nb_points == points.size());
+
+  // a nearly degenerate strip is split along its length only
+  std::vector<Point> strip;
+  for (std::size_t i = 0; i < 5000; ++ i)
+    strip.emplace_back (rnd.get_double (0., 1000.), rnd.get_double (0., 1e-12), 0.);
+  std::size_t nb_strip_tiles = 0, nb_strip_points = 0;
+  assert ((CGAL::process_point_set_in_tiles<CGAL::Sequential_tag, Point>
+           ([&](auto output) -> bool { std::copy (strip.begin(), strip.end(), output); return true; },
+            [&](std::vector<Point>& tile_points, const Tile& tile)
+            {
+              assert (tile.index() < 4 * strip.size());
+              ++ nb_strip_tiles;
+              nb_strip_points += tile_points.size();
+            },
+            CGAL::parameters::maximum_number_of_points_in_memory(500))));
+  assert (nb_strip_tiles > 1 && nb_strip_tiles <= 160);
+  assert (nb_strip_points == strip.size());
+
+  // a tiling with more tiles than four times the number of points is rejected
+  assert (!(CGAL::process_point_set_in_tiles<CGAL::Sequential_tag, Point>
+            (read_vector, [](std::vector<Point>&, const Tile&) { assert (false); },
+             CGAL::parameters::tile_size(1e-9))));
+
+  // reading errors are reported
+  assert (!(CGAL::process_point_set_in_tiles<CGAL::Sequential_tag, Point>
+            ([](auto) { return false; }, [](std::vector<Point>&, const Tile&) { })));
+
+  std::cerr << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
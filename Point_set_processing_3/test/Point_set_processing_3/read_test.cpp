@@ -46,6 +46,18 @@ bool read_ply(std::string s,
                                              .normal_map(CGAL::Second_of_pair_property_map<PointVectorPair>()));
 }
 
+// Files given by name are read from a memory mapping, which must give the same points as the stream reader
+void compare_mapped_reading(std::string s)
+{
+  std::vector<PointVectorPair> pv_pairs, mapped_pv_pairs;
+  std::ifstream is(s);
+  assert(CGAL::IO::read_XYZ(is, back_inserter(pv_pairs),
+                            CGAL::parameters::point_map(CGAL::First_of_pair_property_map<PointVectorPair>())
+                                             .normal_map(CGAL::Second_of_pair_property_map<PointVectorPair>())));
+  assert(read(s, mapped_pv_pairs));
+  assert(pv_pairs == mapped_pv_pairs);
+}
+
 int main()
 {
   std::cerr << "### There should be three errors following this line...\n";
@@ -69,6 +81,23 @@ int main()
 
   pv_pairs.clear();
 
+  // large enough to be split in several chunks
+  {
+    std::ofstream os("tmp_mapped.xyz");
+    os << "100000\n";
+    for(std::size_t i=0; i<100000; ++i)
+    {
+      os << 0.1 * i << " " << -1.5e-3 * i << "\t" << i % 7;
+      if(i % 2 == 0)
+        os << " 0 0 1";
+      os << "\n";
+      if(i % 3 == 0)
+        os << "# comment\n";
+    }
+  }
+  compare_mapped_reading("tmp_mapped.xyz");
+  compare_mapped_reading("data/read_test/ok_2.xyz");
+
   assert(read_off("data/read_test/ok_1.off", pv_pairs));
   assert(pv_pairs.size() == 4);
   assert(pv_pairs[0] == std::make_pair(Point_3(3,2,0), Vector_3(1,2,3)));
@@ -31,6 +31,7 @@
 #include <CGAL/property_map.h>
 #include <CGAL/Dynamic_property_map.h>
 #include <CGAL/iterator.h>
+#include <CGAL/for_each.h>
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/boost/graph/properties.h>
 #include <boost/graph/graph_traits.hpp>
@@ -297,6 +298,20 @@ namespace internal {
     typedef typename boost::property_map<
       PM, CGAL::dynamic_halfedge_property_t<Halfedge_status> >::type Halfedge_status_pmap;
 
+    // an edge that may be flipped, with the results of the geometric tests
+    // of `flip_edges_for_valence_and_shape()`
+    struct Flip_candidate
+    {
+      Flip_candidate(edge_descriptor e)
+        : e(e), evaluated(false), should_flip(false)
+      {}
+
+      edge_descriptor e;
+      bool evaluated;
+      bool should_flip;
+      std::array<halfedge_descriptor, 4> needle_and_cap; // of the faces of `halfedge(e)` and its opposite
+    };
+
   public:
     Incremental_remesher(PolygonMesh& pmesh
                        , VertexPointMap& vpmap
@@ -473,6 +488,7 @@ namespace internal {
     // "visits all edges of the mesh
     //if an edge is longer than the given threshold `high`, the edge
     //is split at its midpoint and the two adjacent triangles are bisected (2-4 split)"
+    template <typename ConcurrencyTag>
     void split_long_edges(const double& high)
     {
       typedef boost::bimap<
@@ -485,15 +501,22 @@ namespace internal {
 #endif
       double sq_high = high*high;
 
-      //collect long edges
-      Boost_bimap long_edges;
+      //collect long edges: the edges that can be split are found sequentially,
+      //as reading the status of the halfedges may fill a dynamic property map,
+      //and their lengths are computed in parallel if possible
+      std::vector<std::pair<halfedge_descriptor, double> > candidates;
       for(edge_descriptor e : edges(mesh_))
       {
-        if (!is_split_allowed(e))
-          continue;
-        double sqlen = sqlength(e);
-        if(sqlen > sq_high)
-          long_edges.insert(long_edge(halfedge(e, mesh_), sqlen));
+        if (is_split_allowed(e))
+          candidates.emplace_back(halfedge(e, mesh_), 0.);
+      }
+      compute_sqlengths<ConcurrencyTag>(candidates);
+
+      Boost_bimap long_edges;
+      for(const std::pair<halfedge_descriptor, double>& c : candidates)
+      {
+        if(c.second > sq_high)
+          long_edges.insert(long_edge(c.first, c.second));
       }
 
       //split long edges
@@ -611,6 +634,7 @@ namespace internal {
     // "collapses and thus removes all edges that are shorter than a
     // threshold `low`. [...] testing before each collapse whether the collapse
     // would produce an edge that is longer than `high`"
+    template <typename ConcurrencyTag>
     void collapse_short_edges(const double& low,
                               const double& high,
                               const bool collapse_constraints)
@@ -631,12 +655,19 @@ namespace internal {
       double sq_low = low*low;
       double sq_high = high*high;
 
-      Boost_bimap short_edges;
+      //the lengths of the edges are computed in parallel if possible,
+      //and the collapses allowed for the short ones are checked sequentially
+      std::vector<std::pair<halfedge_descriptor, double> > candidates;
+      candidates.reserve(num_edges(mesh_));
       for(edge_descriptor e : edges(mesh_))
+        candidates.emplace_back(halfedge(e, mesh_), 0.);
+      compute_sqlengths<ConcurrencyTag>(candidates);
+
+      Boost_bimap short_edges;
+      for(const std::pair<halfedge_descriptor, double>& c : candidates)
       {
-        double sqlen = sqlength(e);
-        if ((sqlen < sq_low) && is_collapse_allowed(e, collapse_constraints))
-          short_edges.insert(short_edge(halfedge(e, mesh_), sqlen));
+        if ((c.second < sq_low) && is_collapse_allowed(edge(c.first, mesh_), collapse_constraints))
+          short_edges.insert(short_edge(c.first, c.second));
       }
 #ifdef CGAL_PMP_REMESHING_VERBOSE_PROGRESS
       std::cout << "done." << std::endl;
@@ -822,6 +853,7 @@ namespace internal {
     // The target valence is 6 and 4 for interior and boundary vertices, resp.
     // The algo. tentatively flips each edge `e` and checks whether the deviation
     // to the target valences decreases. If not, the edge is flipped back"
+    template <typename ConcurrencyTag>
     void flip_edges_for_valence_and_shape()
     {
 #ifdef CGAL_PMP_REMESHING_VERBOSE
@@ -842,34 +874,56 @@ namespace internal {
 
       const double cap_threshold = std::cos(160. / 180 * CGAL_PI);
 
-      unsigned int nb_flips = 0;
+      //only the patch edges are allowed to be flipped, and flips do not change
+      //the status of the halfedges, so the candidates are collected once
+      std::vector<Flip_candidate> candidates;
       for(edge_descriptor e : edges(mesh_))
       {
-        //only the patch edges are allowed to be flipped
+        halfedge_descriptor h = halfedge(e, mesh_);
+        if (is_on_patch(h) && is_on_patch(opposite(h, mesh_)))
+          candidates.emplace_back(e);
+      }
+
+      //in parallel mode, the geometric tests of the candidates are evaluated
+      //beforehand, and are evaluated again only for the candidates incident
+      //to a face modified by a previous flip, so that the flips are the same
+      //as in sequential mode
+      const bool evaluate_beforehand = boost::is_convertible<ConcurrencyTag, Parallel_tag>::value;
+      typedef typename boost::property_map<PM, CGAL::dynamic_face_property_t<bool> >::type Face_modified;
+      Face_modified modified = get(CGAL::dynamic_face_property_t<bool>(), mesh_);
+      if (evaluate_beforehand)
+      {
+        for(face_descriptor f : faces(mesh_))
+          put(modified, f, false);
+
+        CGAL::for_each<ConcurrencyTag>(candidates, [&](Flip_candidate& c) -> bool
+        {
+          evaluate_flip_candidate(c, cap_threshold);
+          return true;
+        });
+      }
+
+      unsigned int nb_flips = 0;
+      for(Flip_candidate& c : candidates)
+      {
+        edge_descriptor e = c.e;
         if (!is_flip_allowed(e))
           continue;
-        //add geometric test to avoid axe cuts
-        if (!internal::should_flip(e, mesh_, vpmap_, gt_))
-          continue;
 
         halfedge_descriptor he = halfedge(e, mesh_);
+        if (!c.evaluated
+          || get(modified, face(he, mesh_))
+          || get(modified, face(opposite(he, mesh_), mesh_)))
+        {
+          evaluate_flip_candidate(c, cap_threshold);
+        }
 
-        std::array<halfedge_descriptor, 2> r1 = internal::is_badly_shaped(
-            face(he, mesh_),
-            mesh_, vpmap_, vcmap_, ecmap_, gt_,
-            cap_threshold, // bound on the angle: above 160 deg => cap
-            4, // bound on shortest/longest edge above 4 => needle
-            0,// collapse length threshold : not needed here
-            0); // flip triangle height threshold
-
-        std::array<halfedge_descriptor, 2> r2 = internal::is_badly_shaped(
-            face(opposite(he, mesh_), mesh_),
-            mesh_, vpmap_, vcmap_, ecmap_, gt_, cap_threshold, 4, 0, 0);
+        //add geometric test to avoid axe cuts
+        if (!c.should_flip)
+          continue;
 
-        const bool badly_shaped = (r1[0] != boost::graph_traits<PolygonMesh>::null_halfedge()//needle
-                                || r1[1] != boost::graph_traits<PolygonMesh>::null_halfedge()//cap
-                                || r2[0] != boost::graph_traits<PolygonMesh>::null_halfedge()//needle
-                                || r2[1] != boost::graph_traits<PolygonMesh>::null_halfedge());//cap
+        const bool badly_shaped = is_badly_shaped_for_flip(c.needle_and_cap[0], c.needle_and_cap[1])
+                               || is_badly_shaped_for_flip(c.needle_and_cap[2], c.needle_and_cap[3]);
 
         vertex_descriptor va = source(he, mesh_);
         vertex_descriptor vb = target(he, mesh_);
@@ -969,6 +1023,12 @@ namespace internal {
         Patch_id pid = get_patch_id(face(he, mesh_));
         set_patch_id(face(he, mesh_), pid);
         set_patch_id(face(opposite(he, mesh_), mesh_), pid);
+
+        if (evaluate_beforehand)
+        {
+          put(modified, face(he, mesh_), true);
+          put(modified, face(opposite(he, mesh_), mesh_), true);
+        }
       }
 
 #ifdef CGAL_PMP_REMESHING_VERBOSE
@@ -990,6 +1050,7 @@ namespace internal {
     // "applies an iterative smoothing filter to the mesh.
     // The vertex movement has to be constrained to the vertex tangent plane [...]
     // smoothing algorithm with uniform Laplacian weights"
+    template <typename ConcurrencyTag>
     void tangential_relaxation_impl(const bool relax_constraints/*1d smoothing*/
                                    , const unsigned int nb_iterations)
     {
@@ -1031,6 +1092,7 @@ namespace internal {
                          .edge_is_constrained_map(constrained_edges_pmap)
                          .vertex_is_constrained_map(constrained_vertices_pmap)
                          .relax_constraints(relax_constraints)
+                         .concurrency_tag(ConcurrencyTag())
       );
 
       CGAL_assertion(!input_mesh_is_valid_ || is_valid_polygon_mesh(mesh_));
@@ -1048,6 +1110,7 @@ namespace internal {
 
     // PMP book :
     // "maps the vertices back to the surface"
+    template <typename ConcurrencyTag>
     void project_to_surface(internal_np::Param_not_found)
     {
       //todo : handle the case of boundary vertices
@@ -1056,15 +1119,31 @@ namespace internal {
       std::cout.flush();
 #endif
 
+      // the patch of each vertex is found sequentially, as reading the status
+      // of the halfedges may fill a dynamic property map, and the projections
+      // on the AABB trees are computed in parallel if possible
+      typedef std::tuple<vertex_descriptor, std::size_t, Point> Projection; // vertex, tree, point
+      std::vector<Projection> projections;
       for(vertex_descriptor v : vertices(mesh_))
       {
         if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
           continue;
         //note if v is constrained, it has not moved
 
-        Point proj = trees[patch_id_to_index_map[get_patch_id(face(halfedge(v, mesh_), mesh_))]]->closest_point(get(vpmap_, v));
-        put(vpmap_, v, proj);
+        projections.emplace_back(v,
+          patch_id_to_index_map[get_patch_id(face(halfedge(v, mesh_), mesh_))],
+          get(vpmap_, v));
       }
+
+      CGAL::for_each<ConcurrencyTag>(projections, [&](Projection& p) -> bool
+      {
+        std::get<2>(p) = trees[std::get<1>(p)]->closest_point(std::get<2>(p));
+        return true;
+      });
+
+      for(const Projection& p : projections)
+        put(vpmap_, std::get<0>(p), std::get<2>(p));
+
       CGAL_assertion(!input_mesh_is_valid_ || is_valid_polygon_mesh(mesh_));
 #ifdef CGAL_PMP_REMESHING_DEBUG
       debug_self_intersections();
@@ -1078,7 +1157,9 @@ namespace internal {
 #endif
     }
 
-    template <class ProjectionFunctor>
+    // the projection functor is provided by the user and is not required to
+    // be thread-safe: the projection is sequential
+    template <typename ConcurrencyTag, class ProjectionFunctor>
     void project_to_surface(const ProjectionFunctor& proj)
     {
       //todo : handle the case of boundary vertices
@@ -1147,6 +1228,49 @@ private:
   };
 
   private:
+    template <typename ConcurrencyTag>
+    void compute_sqlengths(std::vector<std::pair<halfedge_descriptor, double> >& candidates) const
+    {
+      CGAL::for_each<ConcurrencyTag>(candidates, [&](std::pair<halfedge_descriptor, double>& c) -> bool
+      {
+        c.second = sqlength(c.first);
+        return true;
+      });
+    }
+
+    // only reads the points of the vertices, so that it can be called in parallel
+    void evaluate_flip_candidate(Flip_candidate& c, const double cap_threshold) const
+    {
+      halfedge_descriptor h = halfedge(c.e, mesh_);
+      c.should_flip = internal::should_flip(c.e, mesh_, vpmap_, gt_);
+      if (c.should_flip)
+      {
+        const face_descriptor f1 = face(h, mesh_);
+        const face_descriptor f2 = face(opposite(h, mesh_), mesh_);
+        const auto np = parameters::vertex_point_map(vpmap_).geom_traits(gt_);
+
+        // bound on shortest/longest edge above 4 => needle,
+        // bound on the angle: above 160 deg => cap
+        c.needle_and_cap[0] = is_needle_triangle_face(f1, mesh_, 4, np);
+        c.needle_and_cap[1] = is_cap_triangle_face(f1, mesh_, cap_threshold, np);
+        c.needle_and_cap[2] = is_needle_triangle_face(f2, mesh_, 4, np);
+        c.needle_and_cap[3] = is_cap_triangle_face(f2, mesh_, cap_threshold, np);
+      }
+      c.evaluated = true;
+    }
+
+    // same as `internal::is_badly_shaped()` without collapse length and flip
+    // height thresholds, from the needle and cap halfedges of a face
+    bool is_badly_shaped_for_flip(const halfedge_descriptor needle,
+                                  const halfedge_descriptor cap) const
+    {
+      const halfedge_descriptor null_h = boost::graph_traits<PolygonMesh>::null_halfedge();
+      if (needle != null_h
+        && (!get(vcmap_, source(needle, mesh_)) || !get(vcmap_, target(needle, mesh_))))
+        return true;
+      return cap != null_h && !get(ecmap_, edge(cap, mesh_));
+    }
+
     Triangle_3 triangle(face_descriptor f) const
     {
       halfedge_descriptor h = halfedge(f, mesh_);
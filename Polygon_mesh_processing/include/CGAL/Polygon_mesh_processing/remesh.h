@@ -38,6 +38,12 @@ namespace Polygon_mesh_processing {
 * edge flips, tangential relaxation and projection to the initial surface
 * to generate a smooth mesh with a prescribed edge length.
 *
+* If the named parameter `concurrency_tag` allows it, the tangential relaxation and the
+* projection to the initial surface are computed in parallel. The edge splits, collapses,
+* and flips, which modify the connectivity of the mesh, are always performed sequentially,
+* but the edge lengths and the geometric tests on which they are decided are then
+* evaluated in parallel. The output mesh does not depend on the concurrency tag.
+*
 * @tparam PolygonMesh model of `MutableFaceGraph`.
 *         The descriptor types `boost::graph_traits<PolygonMesh>::%face_descriptor`
 *         and `boost::graph_traits<PolygonMesh>::%halfedge_descriptor` must be
@@ -177,6 +183,16 @@ namespace Polygon_mesh_processing {
 *     \cgalParamType{Unary functor that provides `%Point_3 operator()(vertex_descriptor)`, `%Point_3` being the value type
 *                    of the vertex point map.}
 *     \cgalParamDefault{If not provided, vertices are projected on the input surface mesh.}
+*     \cgalParamExtra{The projection functor is always called sequentially.}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the tangential relaxation, the projection, and the
+*                           evaluation of the edges to be split, collapsed, or flipped
+*                           should be computed sequentially or in parallel}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{Parallel mode requires the \ref thirdpartyTBB library.}
 *   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
@@ -246,6 +262,12 @@ void isotropic_remeshing(const FaceRange& faces
   VCMap vcmap = choose_parameter(get_parameter(np, internal_np::vertex_is_constrained),
                                  Static_boolean_property_map<vertex_descriptor, false>());
 
+  typedef typename internal_np::Lookup_named_param_def <
+      internal_np::concurrency_tag_t,
+      NamedParameters,
+      Sequential_tag
+    > ::type ConcurrencyTag;
+
   bool protect = choose_parameter(get_parameter(np, internal_np::protect_constraints), false);
   typedef typename internal_np::Lookup_named_param_def <
       internal_np::face_patch_t,
@@ -316,15 +338,15 @@ void isotropic_remeshing(const FaceRange& faces
     if (target_edge_length>0)
     {
       if(do_split)
-        remesher.split_long_edges(high);
+        remesher.template split_long_edges<ConcurrencyTag>(high);
       if(do_collapse)
-        remesher.collapse_short_edges(low, high, collapse_constraints);
+        remesher.template collapse_short_edges<ConcurrencyTag>(low, high, collapse_constraints);
     }
     if(do_flip)
-      remesher.flip_edges_for_valence_and_shape();
-    remesher.tangential_relaxation_impl(smoothing_1d, nb_laplacian);
+      remesher.template flip_edges_for_valence_and_shape<ConcurrencyTag>();
+    remesher.template tangential_relaxation_impl<ConcurrencyTag>(smoothing_1d, nb_laplacian);
     if ( choose_parameter(get_parameter(np, internal_np::do_project), true) )
-      remesher.project_to_surface(get_parameter(np, internal_np::projection_functor));
+      remesher.template project_to_surface<ConcurrencyTag>(get_parameter(np, internal_np::projection_functor));
 #ifdef CGAL_PMP_REMESHING_VERBOSE
     std::cout << std::endl;
 #endif
@@ -21,10 +21,13 @@
 
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace CGAL {
 namespace Polygon_mesh_processing {
@@ -47,6 +50,10 @@ struct Allow_all_moves{
 * is projected back to the tangent plane to the surface at `v`, iteratively.
 * The connectivity remains unchanged.
 *
+* The new locations of the vertices are computed in parallel if the named parameter
+* `concurrency_tag` allows it, while the vertices are moved sequentially, as the validity
+* of each move depends on the location of its neighbors.
+*
 * @tparam TriangleMesh model of `FaceGraph` and `VertexListGraph`.
 *         The descriptor types `boost::graph_traits<TriangleMesh>::%face_descriptor`
 *         and `boost::graph_traits<TriangleMesh>::%halfedge_descriptor` must be
@@ -115,11 +122,20 @@ struct Allow_all_moves{
 *     \cgalParamDefault{If not provided, all moves are allowed.}
 *   \cgalParamNEnd
 *
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the new locations of the vertices should be computed sequentially or in parallel}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{Parallel mode requires the \ref thirdpartyTBB library.}
+*   \cgalParamNEnd
+*
 * \cgalNamedParamsEnd
 *
 * \todo check if it should really be a triangle mesh or if a polygon mesh is fine
 */
-template <typename VertexRange, class TriangleMesh, class NamedParameters = parameters::Default_named_parameters>
+template <typename VertexRange,
+          class TriangleMesh,
+          class NamedParameters = parameters::Default_named_parameters>
 void tangential_relaxation(const VertexRange& vertices,
                            TriangleMesh& tm,
                            const NamedParameters& np = parameters::default_values())
@@ -203,6 +219,26 @@ void tangential_relaxation(const VertexRange& vertices,
   Shall_move shall_move = choose_parameter(get_parameter(np, internal_np::allow_move_functor),
                                            internal::Allow_all_moves());
 
+  typedef typename internal_np::Lookup_named_param_def <
+      internal_np::concurrency_tag_t,
+      NamedParameters,
+      Sequential_tag
+    > ::type ConcurrencyTag;
+
+  // In parallel, the vertex normals are computed on the fly from the incident faces,
+  // as a map of normals cannot be filled concurrently
+  const bool parallel_execution = std::is_convertible<ConcurrencyTag, Parallel_tag>::value;
+
+  // the new location of a vertex, computed from the location of the vertices of its star.
+  // `ph0` and `ph1` are the endpoints of the constrained edges incident to a vertex
+  // relaxed along a constrained polyline, and null vertices otherwise.
+  struct Relocation
+  {
+    vertex_descriptor v, ph0, ph1;
+    Point_3 new_location;
+    bool moves;
+  };
+
   for (unsigned int nit = 0; nit < nb_iterations; ++nit)
   {
 #ifdef CGAL_PMP_TANGENTIAL_RELAXATION_VERBOSE
@@ -211,79 +247,85 @@ void tangential_relaxation(const VertexRange& vertices,
     std::cout.flush();
 #endif
 
-    typedef std::tuple<vertex_descriptor, Vector_3, Point_3> VNP;
-    std::vector< VNP > barycenters;
     auto gt_barycenter = gt.construct_barycenter_3_object();
 
     // at each vertex, compute vertex normal
     std::unordered_map<vertex_descriptor, Vector_3> vnormals;
-    compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
+    if (!parallel_execution)
+      compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
 
-    // at each vertex, compute barycenter of neighbors
+    // collect the vertices to relocate. The constraints are only read here,
+    // so that the computation of the new locations only reads the points.
+    std::vector<Relocation> relocations;
     for(vertex_descriptor v : vertices)
     {
       if (get(vcm, v) || CGAL::internal::is_isolated(v, tm))
         continue;
 
       // collect hedges to detect if we have to handle boundary cases
-      std::vector<halfedge_descriptor> interior_hedges, border_halfedges;
+      std::vector<halfedge_descriptor> border_halfedges;
       for(halfedge_descriptor h : halfedges_around_target(v, tm))
       {
         if (is_border_edge(h, tm) || get(ecm, edge(h, tm)))
           border_halfedges.push_back(h);
-        else
-          interior_hedges.push_back(h);
       }
 
+      const vertex_descriptor null_v = boost::graph_traits<TriangleMesh>::null_vertex();
       if (border_halfedges.empty())
+        relocations.push_back(Relocation{ v, null_v, null_v, get(vpm, v), false });
+      else if (relax_constraints && border_halfedges.size() == 2)// corners are constrained
+        relocations.push_back(Relocation{ v,
+                                          source(border_halfedges[0], tm),
+                                          source(border_halfedges[1], tm),
+                                          get(vpm, v), false });
+    }
+
+    // at each vertex, compute barycenter of neighbors, and project it
+    // on the tangent plane
+    CGAL::for_each<ConcurrencyTag>(relocations, [&](Relocation& r) -> bool
+    {
+      const vertex_descriptor v = r.v;
+      const Point_3& pv = get(vpm, v);
+      if (r.ph0 == boost::graph_traits<TriangleMesh>::null_vertex())
       {
-        const Vector_3& vn = vnormals.at(v);
+        const Vector_3 vn = parallel_execution ? compute_vertex_normal(v, tm, np)
+                                               : vnormals.at(v);
         Vector_3 move = CGAL::NULL_VECTOR;
         unsigned int star_size = 0;
-        for(halfedge_descriptor h :interior_hedges)
+        for(halfedge_descriptor h : halfedges_around_target(v, tm))
         {
-          move = move + Vector_3(get(vpm, v), get(vpm, source(h, tm)));
+          move = move + Vector_3(pv, get(vpm, source(h, tm)));
           ++star_size;
         }
         CGAL_assertion(star_size > 0); //isolated vertices have already been discarded
         move = (1. / static_cast<double>(star_size)) * move;
 
-        barycenters.emplace_back(v, vn, get(vpm, v) + move);
+        const Point_3 qv = pv + move; //barycenter at v
+        r.new_location = qv + (vn * Vector_3(qv, pv)) * vn;
+        r.moves = true;
       }
       else
       {
-        if (!relax_constraints) continue;
-        Vector_3 vn(NULL_VECTOR);
-
-        if (border_halfedges.size() == 2)// corners are constrained
+        const Point_3& p0 = get(vpm, r.ph0);
+        const Point_3& p1 = get(vpm, r.ph1);
+        double dot = to_double(Vector_3(pv, p0) * Vector_3(pv, p1));
+        // \todo shouldn't it be an input parameter?
+        //check squared cosine is < 0.25 (~120 degrees)
+        if (0.25 < dot*dot / ( squared_distance(p0, pv) * squared_distance(p1, pv)) )
         {
-          vertex_descriptor ph0 = source(border_halfedges[0], tm);
-          vertex_descriptor ph1 = source(border_halfedges[1], tm);
-          double dot = to_double(Vector_3(get(vpm, v), get(vpm, ph0))
-                                 * Vector_3(get(vpm, v), get(vpm, ph1)));
-          // \todo shouldn't it be an input parameter?
-          //check squared cosine is < 0.25 (~120 degrees)
-          if (0.25 < dot*dot / ( squared_distance(get(vpm,ph0), get(vpm, v)) *
-                                 squared_distance(get(vpm,ph1), get(vpm, v))) )
-            barycenters.emplace_back(v, vn,
-              gt_barycenter(get(vpm, ph0), 0.25, get(vpm, ph1), 0.25, get(vpm, v), 0.5));
+          r.new_location = gt_barycenter(p0, 0.25, p1, 0.25, pv, 0.5);
+          r.moves = true;
         }
       }
-    }
+      return true;
+    });
 
-    // compute moves
     typedef std::pair<vertex_descriptor, Point_3> VP_pair;
-    std::vector< std::pair<vertex_descriptor, Point_3> > new_locations;
-    new_locations.reserve(barycenters.size());
-    for(const VNP& vnp : barycenters)
-    {
-      vertex_descriptor v = std::get<0>(vnp);
-      const Point_3& pv = get(vpm, v);
-      const Vector_3& nv = std::get<1>(vnp);
-      const Point_3& qv = std::get<2>(vnp); //barycenter at v
-
-      new_locations.emplace_back(v, qv + (nv * Vector_3(qv, pv)) * nv);
-    }
+    std::vector<VP_pair> new_locations;
+    new_locations.reserve(relocations.size());
+    for(const Relocation& r : relocations)
+      if (r.moves)
+        new_locations.emplace_back(r.v, r.new_location);
 
     // perform moves
     for(const VP_pair& vp : new_locations)
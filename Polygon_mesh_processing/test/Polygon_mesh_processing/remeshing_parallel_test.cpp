@@ -0,0 +1,91 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Polyhedron_3.h>
+
+#include <CGAL/Polygon_mesh_processing/remesh.h>
+#include <CGAL/Polygon_mesh_processing/tangential_relaxation.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <cassert>
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3                                          Point_3;
+
+template <typename Mesh>
+std::vector<Point_3> points(const Mesh& mesh)
+{
+  std::vector<Point_3> out;
+  for(auto v : vertices(mesh))
+    out.push_back(get(CGAL::vertex_point, mesh, v));
+  return out;
+}
+
+// the points of the vertices of each face, which are equal if the flips are the same
+template <typename Mesh>
+std::vector<std::vector<Point_3> > faces_around_points(const Mesh& mesh)
+{
+  std::vector<std::vector<Point_3> > out;
+  for(auto f : faces(mesh))
+  {
+    out.emplace_back();
+    for(auto v : vertices_around_face(halfedge(f, mesh), mesh))
+      out.back().push_back(get(CGAL::vertex_point, mesh, v));
+  }
+  return out;
+}
+
+// The parallel computation of the new locations, of the projections, and of the
+// edges to be split, collapsed, or flipped must give the same result as the sequential one
+template <typename Mesh>
+void test(const std::string& filename)
+{
+  std::cout << "Test " << filename << std::endl;
+
+  Mesh mesh;
+  if(!PMP::IO::read_polygon_mesh(filename, mesh) || is_empty(mesh))
+  {
+    std::cerr << "Error: cannot read " << filename << std::endl;
+    assert(false);
+    return;
+  }
+
+  Mesh seq_mesh = mesh, par_mesh = mesh;
+  PMP::tangential_relaxation(seq_mesh,
+    CGAL::parameters::number_of_iterations(3).relax_constraints(true));
+  PMP::tangential_relaxation(par_mesh,
+    CGAL::parameters::number_of_iterations(3).relax_constraints(true)
+                     .concurrency_tag(CGAL::Parallel_if_available_tag()));
+  assert(points(seq_mesh) == points(par_mesh));
+  assert(points(seq_mesh) != points(mesh));
+
+  seq_mesh = mesh;
+  par_mesh = mesh;
+  PMP::isotropic_remeshing(faces(seq_mesh), 0.02, seq_mesh,
+    CGAL::parameters::number_of_iterations(2).relax_constraints(true));
+  PMP::isotropic_remeshing(faces(par_mesh), 0.02, par_mesh,
+    CGAL::parameters::number_of_iterations(2).relax_constraints(true)
+                     .concurrency_tag(CGAL::Parallel_if_available_tag()));
+  assert(num_vertices(seq_mesh) == num_vertices(par_mesh));
+  assert(num_faces(seq_mesh) == num_faces(par_mesh));
+  assert(points(seq_mesh) == points(par_mesh));
+  assert(faces_around_points(seq_mesh) == faces_around_points(par_mesh));
+}
+
+int main()
+{
+  const std::string closed = CGAL::data_file_path("meshes/elephant.off");
+  const std::string with_hole = "data/elephant_flat_hole.off";
+
+  test<CGAL::Surface_mesh<Point_3> >(closed);
+  test<CGAL::Surface_mesh<Point_3> >(with_hole);
+  test<CGAL::Polyhedron_3<K> >(closed);
+  test<CGAL::Polyhedron_3<K> >(with_hole);
+
+  std::cout << "Done!" << std::endl;
+  return EXIT_SUCCESS;
+}
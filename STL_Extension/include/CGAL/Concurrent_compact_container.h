@@ -19,8 +19,10 @@
 #include <CGAL/basic.h>
 #include <CGAL/Default.h>
 
+#include <atomic>
 #include <iterator>
 #include <algorithm>
+#include <utility>
 #include <vector>
 #include <cstring>
 #include <cstddef>
@@ -31,6 +33,7 @@
 #include <CGAL/memory.h>
 #include <CGAL/iterator.h>
 #include <CGAL/CC_safe_handle.h>
+#include <CGAL/Profile_counter.h>
 #include <CGAL/Time_stamper.h>
 
 #include <tbb/enumerable_thread_specific.h>
@@ -61,6 +64,13 @@ template<typename T> class has_##X {                                          \
 #define CGAL_INIT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE 14
 #define CGAL_INCREMENT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE 16
 
+// When the free list of a thread has twice this number of elements, this number of
+// elements is moved at once to the free list shared by all threads, where threads
+// whose free lists are empty take them before allocating a new block.
+#ifndef CGAL_CONCURRENT_COMPACT_CONTAINER_FREE_LIST_BATCH_SIZE
+#define CGAL_CONCURRENT_COMPACT_CONTAINER_FREE_LIST_BATCH_SIZE 256
+#endif
+
 // The traits class describes the way to access the pointer.
 // It can be specialized.
 template < class T >
@@ -117,7 +127,7 @@ class Free_list {
   // Not that the implicitly-defined member functions copy the
   // pointer, and not the pointed data.
 public:
-  Free_list() : m_head(nullptr), m_size(0) {
+  Free_list() : m_head(nullptr), m_size(0), m_fresh_size(0) {
 #if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
     // Note that the performance penalty with
     // CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE=1 is
@@ -127,7 +137,7 @@ public:
 #endif // CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
   }
 
-  void init()                { m_head = nullptr; m_size = 0; }
+  void init()                { m_head = nullptr; m_size = 0; m_fresh_size = 0; }
   pointer head() const       { return m_head; }
   void set_head(pointer p)   { m_head = p; }
   size_type size() const     { return m_size; }
@@ -146,6 +156,8 @@ public:
   }
   void dec_size() {
     --m_size;
+    if(m_size < m_fresh_size)
+      m_fresh_size = m_size;
 #if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
     if((m_size * precision_of_approximate_size_plus_1) < m_approximate_size)
       refresh_approximate_size();
@@ -153,6 +165,11 @@ public:
   }
   bool empty()               { return size() == 0; }
 
+  // The elements of a new block are put on an empty free list, so they are at the end
+  // of the list until they are used: this is the number of such elements.
+  size_type fresh_size() const       { return m_fresh_size; }
+  void set_fresh_size(size_type s)   { m_fresh_size = s; }
+
   void merge(Free_list &other)
   {
     if (m_head == nullptr) {
@@ -165,6 +182,7 @@ public:
         p = CCC::clean_pointee(p);
       CCC::set_type(p, other.m_head, CCC::FREE);
       m_size += other.m_size;
+      m_fresh_size = other.m_fresh_size;
     }
     other.init(); // clear other
   }
@@ -178,6 +196,7 @@ public:
 protected:
   pointer   m_head;  // the free list head pointer
   size_type m_size;  // the free list size
+  size_type m_fresh_size;  // the number of elements of a new block at the end of the list
 
 #if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
   // `m_size` plus or minus `precision_of_approximate_size - 1`
@@ -196,6 +215,17 @@ protected:
 // Safe concurrent "insert" and "erase".
 // Do not parse the container while others are modifying it.
 //
+// Each thread has its own free list. Erased elements go to the free list of the
+// erasing thread, and are given by batches to the shared free list when this free
+// list gets too long, so that the threads which mostly insert reuse them.
+// New blocks are allocated and initialized by the thread which needs them, so that
+// with a first-touch policy their memory is local to the NUMA node of this thread.
+// The elements of a new block which were never used stay on the free list of this
+// thread: only erased elements are given to the shared free list.
+//
+// If CGAL_PROFILE is defined, the numbers of new blocks, of batches moved to and from
+// the shared free list, and of lock acquisitions which had to wait are counted.
+//
 template < class T, class Allocator_ = Default >
 class Concurrent_compact_container
 {
@@ -306,6 +336,9 @@ public:
     std::swap(m_last_item, c.m_last_item);
     std::swap(m_free_lists, c.m_free_lists);
     m_all_items.swap(c.m_all_items);
+    m_shared_free_batches.swap(c.m_shared_free_batches);
+    // non-atomic swap of m_shared_free_size
+    c.m_shared_free_size = m_shared_free_size.exchange(c.m_shared_free_size.load());
     // non-atomic swap of m_time_stamp
     c.m_time_stamp = m_time_stamp.exchange(c.m_time_stamp.load());
   }
@@ -396,6 +429,8 @@ private:
     std::allocator_traits<allocator_type>::destroy(m_alloc, &*x);
 
     put_on_free_list(&*x, fl);
+    if (fl->size() - fl->fresh_size() >= 2 * CGAL_CONCURRENT_COMPACT_CONTAINER_FREE_LIST_BATCH_SIZE)
+      give_free_batch(fl);
   }
 public:
 
@@ -423,6 +458,7 @@ public:
 #else // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
     size_type size = m_capacity;
 #endif // not CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
+    size -= m_shared_free_size.load(std::memory_order_relaxed);
     for( typename Free_lists::iterator it_free_list = m_free_lists.begin() ;
          it_free_list != m_free_lists.end() ;
          ++it_free_list )
@@ -436,6 +472,7 @@ public:
   size_type approximate_size() const
   {
     size_type size = m_capacity.load(std::memory_order_relaxed);
+    size -= m_shared_free_size.load(std::memory_order_relaxed);
     for( typename Free_lists::iterator it_free_list = m_free_lists.begin() ;
          it_free_list != m_free_lists.end() ;
          ++it_free_list )
@@ -577,7 +614,8 @@ private:
   {
     pointer fl2 = fl->head();
     if (fl2 == nullptr) {
-      allocate_new_block(fl);
+      if (!take_free_batch(fl))
+        allocate_new_block(fl);
       fl2 = fl->head();
     }
     pointer ret = fl2;
@@ -659,6 +697,66 @@ private:
 
   typedef tbb::queuing_mutex Mutex;
 
+  // Acquires `mutex`, counting the acquisitions which have to wait if CGAL_PROFILE is defined.
+  static void acquire(Mutex::scoped_lock& lock, Mutex& mutex)
+  {
+#ifdef CGAL_PROFILE
+    if (lock.try_acquire(mutex))
+      return;
+    CGAL_PROFILER("[Concurrent_compact_container] contended lock acquisitions");
+#endif
+    lock.acquire(mutex);
+  }
+
+  // Moves the first elements of the free list of the current thread to the shared free list.
+  // These are erased elements, the elements of new blocks being at the end of the list.
+  void give_free_batch(FreeList *fl)
+  {
+    const size_type n = CGAL_CONCURRENT_COMPACT_CONTAINER_FREE_LIST_BATCH_SIZE;
+    CGAL_assertion(fl->size() - fl->fresh_size() >= n);
+
+    pointer first = fl->head();
+    pointer last = first;
+    for (size_type i = 1; i < n; ++i)
+      last = clean_pointee(last);
+    fl->set_head(clean_pointee(last));
+    fl->set_size(fl->size() - n);
+    set_type(last, nullptr, FREE);
+
+    {
+      Mutex::scoped_lock lock;
+      acquire(lock, m_shared_mutex);
+      m_shared_free_batches.push_back(std::make_pair(first, n));
+      m_shared_free_size.fetch_add(n, std::memory_order_relaxed);
+    }
+    CGAL_PROFILER("[Concurrent_compact_container] batches given to the shared free list");
+  }
+
+  // Moves a batch of the shared free list to the empty free list of the current thread.
+  // Returns false if the shared free list is empty.
+  bool take_free_batch(FreeList *fl)
+  {
+    CGAL_precondition(fl->head() == nullptr);
+
+    if (m_shared_free_size.load(std::memory_order_relaxed) == 0)
+      return false;
+
+    std::pair<pointer, size_type> batch;
+    {
+      Mutex::scoped_lock lock;
+      acquire(lock, m_shared_mutex);
+      if (m_shared_free_batches.empty())
+        return false;
+      batch = m_shared_free_batches.back();
+      m_shared_free_batches.pop_back();
+      m_shared_free_size.fetch_sub(batch.second, std::memory_order_relaxed);
+    }
+    fl->set_head(batch.first);
+    fl->set_size(fl->size() + batch.second);
+    CGAL_PROFILER("[Concurrent_compact_container] batches taken from the shared free list");
+    return true;
+  }
+
   // We store a vector of pointers to all allocated blocks and their sizes.
   // Knowing all pointers, we don't have to walk to the end of a block to reach
   // the pointer to the next block.
@@ -668,6 +766,10 @@ private:
   // function considerably when has_trivial_destructor<T>.
   using All_items = std::vector<std::pair<pointer, size_type> >;
 
+  // Batches of free elements (first element and size) of the shared free list.
+  // Each batch is a free list ending with nullptr.
+  using Free_batches = std::vector<std::pair<pointer, size_type> >;
+
   using time_stamp_t = std::atomic<std::size_t>;
 
   void init()
@@ -684,6 +786,8 @@ private:
     m_first_item = nullptr;
     m_last_item  = nullptr;
     m_all_items  = All_items();
+    m_shared_free_batches = Free_batches();
+    m_shared_free_size = 0;
     m_time_stamp = 0;
   }
 
@@ -699,6 +803,9 @@ private:
   pointer           m_last_item     = nullptr;
   All_items         m_all_items     = {};
   mutable Mutex     m_mutex;
+  Free_batches      m_shared_free_batches = {};
+  std::atomic<size_type> m_shared_free_size = {};
+  Mutex             m_shared_mutex;
   time_stamp_t      m_time_stamp    = {};
 
 };
@@ -743,6 +850,10 @@ void Concurrent_compact_container<T, Allocator>::merge(Self &d)
     m_last_item = d.m_last_item;
   }
   m_all_items.insert(m_all_items.end(), d.m_all_items.begin(), d.m_all_items.end());
+  // Concatenate the shared free lists.
+  m_shared_free_batches.insert(m_shared_free_batches.end(),
+                               d.m_shared_free_batches.begin(), d.m_shared_free_batches.end());
+  m_shared_free_size.fetch_add(d.m_shared_free_size.load(), std::memory_order_relaxed);
   // Add the capacities.
 #if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
   m_capacity.fetch_add(d.m_capacity, std::memory_order_relaxed);
@@ -778,13 +889,35 @@ void Concurrent_compact_container<T, Allocator>::
   typedef CCC_internal::Erase_counter_strategy<
     CCC_internal::has_increment_erase_counter<T>::value> EraseCounterStrategy;
 
+  CGAL_precondition(fl->head() == nullptr);
   size_type old_block_size;
-  pointer new_block;
 
   {
-    Mutex::scoped_lock lock(m_mutex);
+    Mutex::scoped_lock lock;
+    acquire(lock, m_mutex);
     old_block_size = m_block_size;
-    new_block = m_alloc.allocate(old_block_size + 2);
+    // Increase the m_block_size for the next time.
+    m_block_size += CGAL_INCREMENT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE;
+  }
+
+  // The block is allocated and initialized out of the lock, by the thread which uses it.
+  pointer new_block = m_alloc.allocate(old_block_size + 2);
+  CGAL_PROFILER("[Concurrent_compact_container] new blocks");
+
+  // We don't touch the first and the last one.
+  // We mark them free in reverse order, so that the insertion order
+  // will correspond to the iterator order...
+  for (size_type i = old_block_size; i >= 1; --i)
+  {
+    EraseCounterStrategy::set_erase_counter(*(new_block + i), 0);
+    Time_stamper::initialize_time_stamp(new_block + i);
+    put_on_free_list(new_block + i, fl);
+  }
+  fl->set_fresh_size(fl->size());
+
+  {
+    Mutex::scoped_lock lock;
+    acquire(lock, m_mutex);
     m_all_items.push_back(std::make_pair(new_block, old_block_size + 2));
 #if CGAL_CONCURRENT_COMPACT_CONTAINER_APPROXIMATE_SIZE
     m_capacity.fetch_add(old_block_size, std::memory_order_relaxed);
@@ -806,18 +939,6 @@ void Concurrent_compact_container<T, Allocator>::
         m_last_item = new_block + old_block_size + 1;
     }
     set_type(m_last_item, nullptr, START_END);
-    // Increase the m_block_size for the next time.
-    m_block_size += CGAL_INCREMENT_CONCURRENT_COMPACT_CONTAINER_BLOCK_SIZE;
-  }
-
-  // We don't touch the first and the last one.
-  // We mark them free in reverse order, so that the insertion order
-  // will correspond to the iterator order...
-  for (size_type i = old_block_size; i >= 1; --i)
-  {
-    EraseCounterStrategy::set_erase_counter(*(new_block + i), 0);
-    Time_stamper::initialize_time_stamp(new_block + i);
-    put_on_free_list(new_block + i, fl);
   }
 }
 
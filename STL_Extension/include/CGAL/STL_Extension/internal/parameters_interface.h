@@ -149,6 +149,8 @@ CGAL_add_named_parameter(get_cost_policy_t, get_cost_policy, get_cost)
 CGAL_add_named_parameter(get_placement_policy_t, get_placement_policy, get_placement)
 CGAL_add_named_parameter(filter_t, filter, filter)
 CGAL_add_named_parameter(use_relaxed_order_t, use_relaxed_order, use_relaxed_order)
+CGAL_add_named_parameter(concurrency_tag_t, concurrency_tag, concurrency_tag)
+CGAL_add_named_parameter(use_breadth_first_order_t, use_breadth_first_order, use_breadth_first_order)
 
 //to be documented
 CGAL_add_named_parameter(face_normal_t, face_normal, face_normal_map)
@@ -170,6 +172,7 @@ CGAL_add_named_parameter(callback_t, callback, callback)
 CGAL_add_named_parameter(sharpness_angle_t, sharpness_angle, sharpness_angle)
 CGAL_add_named_parameter(edge_sensitivity_t, edge_sensitivity, edge_sensitivity)
 CGAL_add_named_parameter(neighbor_radius_t, neighbor_radius, neighbor_radius)
+CGAL_add_named_parameter(use_grid_for_radius_queries_t, use_grid_for_radius_queries, use_grid_for_radius_queries)
 CGAL_add_named_parameter(number_of_output_points_t, number_of_output_points, number_of_output_points)
 CGAL_add_named_parameter(size_t, size, size)
 CGAL_add_named_parameter(maximum_variation_t, maximum_variation, maximum_variation)
@@ -198,6 +201,9 @@ CGAL_add_named_parameter(scan_angle_t, scan_angle_map, scan_angle_map)
 CGAL_add_named_parameter(scanline_id_t, scanline_id_map, scanline_id_map)
 CGAL_add_named_parameter(min_points_per_cell_t, min_points_per_cell, min_points_per_cell)
 CGAL_add_named_parameter(scalar_t, scalar_map, scalar_map)
+CGAL_add_named_parameter(tile_size_t, tile_size, tile_size)
+CGAL_add_named_parameter(tile_overlap_t, tile_overlap, tile_overlap)
+CGAL_add_named_parameter(maximum_number_of_points_in_memory_t, maximum_number_of_points_in_memory, maximum_number_of_points_in_memory)
 
 // List of named parameters used in Surface_mesh_approximation package
 CGAL_add_named_parameter(verbose_level_t, verbose_level, verbose_level)
@@ -225,6 +231,7 @@ CGAL_add_named_parameter(smooth_constrained_edges_t, smooth_constrained_edges, s
 // List of named parameters used in Alpha_wrap_3
 CGAL_add_named_parameter(do_enforce_manifoldness_t, do_enforce_manifoldness, do_enforce_manifoldness)
 CGAL_add_named_parameter(seed_points_t, seed_points, seed_points)
+CGAL_add_named_parameter(refine_triangulation_t, refine_triangulation, refine_triangulation)
 
 // SMDS_3 parameters
 CGAL_add_named_parameter(surface_facets_t, surface_facets, surface_facets)
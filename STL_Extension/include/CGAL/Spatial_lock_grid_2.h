@@ -0,0 +1,420 @@
+// Copyright (c) 2026  agent <agent@local>.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent <agent@local>
+
+#ifndef CGAL_STL_EXTENSION_SPATIAL_LOCK_GRID_2_H
+#define CGAL_STL_EXTENSION_SPATIAL_LOCK_GRID_2_H
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+#include <CGAL/Bbox_2.h>
+#include <CGAL/Spatial_lock_grid_3.h> // for the lock tags
+
+#include <atomic>
+#include <limits>
+#include <thread>
+#include <tbb/enumerable_thread_specific.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace CGAL {
+
+//*****************************************************************************
+// class Spatial_lock_grid_base_2
+// (Uses Curiously recurring template pattern)
+// The 2D counterpart of `Spatial_lock_grid_base_3`.
+//*****************************************************************************
+
+template <typename Derived>
+class Spatial_lock_grid_base_2
+{
+protected:
+  // Unlike in `Spatial_lock_grid_base_3`, all the data of a thread is stored in one
+  // thread-local object, so that it is obtained with one lookup per lock operation.
+  struct Thread_data
+  {
+    std::vector<char> grid; // the cells locked by this thread
+    std::vector<int>  locked_cells;
+    unsigned int      priority;
+  };
+
+  Thread_data &get_thread_data()
+  {
+    return m_tls_data.local();
+  }
+
+public:
+  void set_bbox(const Bbox_2 &bbox)
+  {
+    // Compute resolutions
+    m_bbox = bbox;
+    double n = static_cast<double>(m_num_grid_cells_per_axis);
+    m_resolution_x = n / (bbox.xmax() - bbox.xmin());
+    m_resolution_y = n / (bbox.ymax() - bbox.ymin());
+  }
+
+  const Bbox_2 &get_bbox() const
+  {
+    return m_bbox;
+  }
+
+  int num_grid_cells_per_axis() const
+  {
+    return m_num_grid_cells_per_axis;
+  }
+
+  bool is_locked_by_this_thread(int cell_index)
+  {
+    return get_thread_data().grid[cell_index] != 0;
+  }
+
+  template <typename P2>
+  bool is_locked(const P2 &point)
+  {
+    return is_cell_locked(get_grid_index(point));
+  }
+
+  template <typename P2>
+  bool is_locked_by_this_thread(const P2 &point)
+  {
+    return get_thread_data().grid[get_grid_index(point)] != 0;
+  }
+
+  bool try_lock(int cell_index)
+  {
+    return try_lock<false>(cell_index);
+  }
+
+  template <bool no_spin>
+  bool try_lock(int cell_index)
+  {
+    Thread_data &td = get_thread_data();
+    return td.grid[cell_index] != 0
+        || try_lock_cell<no_spin>(cell_index, td);
+  }
+
+  bool try_lock(int index_x, int index_y, int lock_radius)
+  {
+    return try_lock<false>(index_x, index_y, lock_radius);
+  }
+
+  template <bool no_spin>
+  bool try_lock(int index_x, int index_y, int lock_radius)
+  {
+    if (lock_radius == 0)
+      return try_lock<no_spin>(index_y*m_num_grid_cells_per_axis + index_x);
+
+    // We have to lock the square
+    Thread_data &td = get_thread_data();
+    std::vector<int> locked_cells_tmp;
+
+    // For each cell inside the square
+    for (int i = (std::max)(0, index_x-lock_radius) ;
+         i <= (std::min)(m_num_grid_cells_per_axis - 1, index_x+lock_radius) ;
+         ++i)
+    {
+      for (int j = (std::max)(0, index_y-lock_radius) ;
+           j <= (std::min)(m_num_grid_cells_per_axis - 1, index_y+lock_radius) ;
+           ++j)
+      {
+        int index_to_lock = j*m_num_grid_cells_per_axis + i;
+        if (td.grid[index_to_lock])
+          continue;
+        // Try to lock it
+        if (try_lock_cell<no_spin>(index_to_lock, td))
+        {
+          locked_cells_tmp.push_back(index_to_lock);
+        }
+        else
+        {
+          // failed => we unlock already locked cells and return false
+          for(int c : locked_cells_tmp)
+            unlock(c, td);
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  // P2 must provide .x(), .y()
+  template <typename P2>
+  bool try_lock(const P2 &point, int lock_radius = 0)
+  {
+    return try_lock<false, P2>(point, lock_radius);
+  }
+
+  // P2 must provide .x(), .y()
+  template <bool no_spin, typename P2>
+  bool try_lock(const P2 &point, int lock_radius = 0)
+  {
+    if (lock_radius == 0)
+      return try_lock<no_spin>(get_grid_index(point));
+
+    return try_lock<no_spin>(get_grid_index_x(point),
+                             get_grid_index_y(point),
+                             lock_radius);
+  }
+
+  void unlock(int cell_index)
+  {
+    unlock(cell_index, get_thread_data());
+  }
+
+  void unlock_all_points_locked_by_this_thread()
+  {
+    Thread_data &td = get_thread_data();
+    for(int cell_index : td.locked_cells)
+    {
+      // If we still own the lock
+      if (td.grid[cell_index])
+        unlock(cell_index, td);
+    }
+    td.locked_cells.clear();
+  }
+
+  bool check_if_all_cells_are_unlocked()
+  {
+    int num_cells = m_num_grid_cells_per_axis*m_num_grid_cells_per_axis;
+    bool unlocked = true;
+    for (int i = 0 ; unlocked && i < num_cells ; ++i)
+      unlocked = !is_cell_locked(i);
+    return unlocked;
+  }
+
+  bool check_if_all_tls_cells_are_unlocked()
+  {
+    const std::vector<char> &grid = get_thread_data().grid;
+    return std::find(grid.begin(), grid.end(), char(1)) == grid.end();
+  }
+
+protected:
+
+  // Constructor
+  Spatial_lock_grid_base_2(const Bbox_2 &bbox, int num_grid_cells_per_axis)
+    : m_num_grid_cells_per_axis(num_grid_cells_per_axis),
+      m_tls_data([num_grid_cells_per_axis]()
+                 {
+                   static std::atomic<unsigned int> last_id;
+                   Thread_data td;
+                   td.grid.resize(num_grid_cells_per_axis*num_grid_cells_per_axis, 0);
+                   // Ensure it is > 0
+                   td.priority = 1 + (++last_id)%((std::numeric_limits<unsigned int>::max)());
+                   return td;
+                 })
+  {
+    set_bbox(bbox);
+  }
+
+  void unlock(int cell_index, Thread_data &td)
+  {
+    // Unlock lock and shared grid
+    unlock_cell(cell_index);
+    td.grid[cell_index] = 0;
+  }
+
+  int clamp_index(int index) const
+  {
+    return (index < 0 ?
+              0
+              : (index >= m_num_grid_cells_per_axis ?
+                   m_num_grid_cells_per_axis - 1
+                   : index));
+  }
+
+  template <typename P2>
+  int get_grid_index_x(const P2& point) const
+  {
+    return clamp_index(static_cast<int>(
+      (CGAL::to_double(point.x()) - m_bbox.xmin()) * m_resolution_x));
+  }
+
+  template <typename P2>
+  int get_grid_index_y(const P2& point) const
+  {
+    return clamp_index(static_cast<int>(
+      (CGAL::to_double(point.y()) - m_bbox.ymin()) * m_resolution_y));
+  }
+
+  template <typename P2>
+  int get_grid_index(const P2& point) const
+  {
+    return get_grid_index_y(point)*m_num_grid_cells_per_axis
+           + get_grid_index_x(point);
+  }
+
+  bool is_cell_locked(int cell_index)
+  {
+    return static_cast<Derived*>(this)->is_cell_locked_impl(cell_index);
+  }
+
+  // Locks a cell that is not locked by this thread
+  template <bool no_spin>
+  bool try_lock_cell(int cell_index, Thread_data &td)
+  {
+    if(static_cast<Derived*>(this)
+         ->template try_lock_cell_impl<no_spin>(cell_index, td.priority))
+    {
+      td.grid[cell_index] = 1;
+      td.locked_cells.push_back(cell_index);
+      return true;
+    }
+    return false;
+  }
+
+  void unlock_cell(int cell_index)
+  {
+    static_cast<Derived*>(this)->unlock_cell_impl(cell_index);
+  }
+
+  int                                             m_num_grid_cells_per_axis;
+  Bbox_2                                          m_bbox;
+  double                                          m_resolution_x;
+  double                                          m_resolution_y;
+
+  // TLS
+  typedef tbb::enumerable_thread_specific<
+    Thread_data,
+    tbb::cache_aligned_allocator<Thread_data>,
+    tbb::ets_key_per_instance>                    TLS_data;
+
+  TLS_data                                        m_tls_data;
+};
+
+
+//*****************************************************************************
+// class Spatial_lock_grid_2
+//*****************************************************************************
+template <typename Grid_lock_tag = Tag_priority_blocking>
+class Spatial_lock_grid_2;
+
+
+//*****************************************************************************
+// class Spatial_lock_grid_2<Tag_non_blocking>
+//*****************************************************************************
+template <>
+class Spatial_lock_grid_2<Tag_non_blocking>
+  : public Spatial_lock_grid_base_2<
+      Spatial_lock_grid_2<Tag_non_blocking> >
+{
+  typedef Spatial_lock_grid_base_2<
+    Spatial_lock_grid_2<Tag_non_blocking> > Base;
+
+public:
+  // Constructors
+  Spatial_lock_grid_2(const Bbox_2 &bbox, int num_grid_cells_per_axis)
+  : Base(bbox, num_grid_cells_per_axis),
+    m_grid(num_grid_cells_per_axis*num_grid_cells_per_axis)
+  {
+    for (std::atomic<bool>& c : m_grid)
+      c = false;
+  }
+
+  bool is_cell_locked_impl(int cell_index)
+  {
+    return (m_grid[cell_index] == true);
+  }
+
+  template <bool no_spin>
+  bool try_lock_cell_impl(int cell_index, unsigned int /* priority */)
+  {
+    bool v1 = true, v2 = false;
+    return m_grid[cell_index].compare_exchange_strong(v2,v1);
+  }
+
+  void unlock_cell_impl(int cell_index)
+  {
+    m_grid[cell_index] = false;
+  }
+
+protected:
+
+  std::vector<std::atomic<bool> > m_grid;
+};
+
+
+//*****************************************************************************
+// class Spatial_lock_grid_2<Tag_priority_blocking>
+//*****************************************************************************
+
+template <>
+class Spatial_lock_grid_2<Tag_priority_blocking>
+  : public Spatial_lock_grid_base_2<Spatial_lock_grid_2<Tag_priority_blocking> >
+{
+  typedef Spatial_lock_grid_base_2<
+    Spatial_lock_grid_2<Tag_priority_blocking> > Base;
+
+public:
+  // Constructors
+  Spatial_lock_grid_2(const Bbox_2 &bbox, int num_grid_cells_per_axis)
+  : Base(bbox, num_grid_cells_per_axis),
+    m_grid(num_grid_cells_per_axis*num_grid_cells_per_axis)
+  {
+    // Explicitly initialize the atomics
+    for (std::atomic<unsigned int>& c : m_grid)
+      c = 0;
+  }
+
+  bool is_cell_locked_impl(int cell_index)
+  {
+    return (m_grid[cell_index] != 0);
+  }
+
+  template <bool no_spin>
+  bool try_lock_cell_impl(int cell_index, unsigned int this_thread_priority)
+  {
+    // NO SPIN
+    if (no_spin)
+    {
+      unsigned int old_value = 0;
+      return m_grid[cell_index].compare_exchange_strong(old_value, this_thread_priority);
+    }
+
+    // SPIN
+    for(;;)
+    {
+      unsigned int old_value = 0;
+      if(m_grid[cell_index].compare_exchange_weak(old_value, this_thread_priority))
+        return true;
+      else if (old_value > this_thread_priority)
+        // Another "more prioritary" thread owns the lock, we back off
+        return false;
+      else
+        std::this_thread::yield();
+    }
+  }
+
+  void unlock_cell_impl(int cell_index)
+  {
+    m_grid[cell_index] = 0;
+  }
+
+protected:
+
+  std::vector<std::atomic<unsigned int> >               m_grid;
+};
+
+} //namespace CGAL
+
+#else // !CGAL_LINKED_WITH_TBB
+
+namespace CGAL {
+
+template <typename Grid_lock_tag = void>
+class Spatial_lock_grid_2
+{
+};
+
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+#endif // CGAL_STL_EXTENSION_SPATIAL_LOCK_GRID_2_H
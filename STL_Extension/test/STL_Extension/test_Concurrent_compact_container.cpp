@@ -15,8 +15,12 @@ int main()
 #else
 
 #include <cassert>
+#include <condition_variable>
 #include <cstddef>
 #include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
 #include <vector>
 #include <CGAL/Compact_container.h>
 #include <CGAL/Concurrent_compact_container.h>
@@ -377,6 +381,73 @@ void test(const Cont &)
   );
   assert(c12.size() == v12.size() - num_erasures);
   }
+
+  std::cout << "Testing reuse of the elements erased by other threads" << std::endl;
+  {
+  // A first thread erases all the elements, then a second thread, which has its
+  // own free list as both threads are alive, inserts as many elements
+  Cont c13;
+  Vect v13(100000);
+  std::vector<typename Cont::iterator> iterators(v13.size());
+  std::unordered_set<const void*> erased, reused;
+  for(std::size_t i = 0 ; i < v13.size() ; ++i)
+  {
+    iterators[i] = c13.insert(v13[i]);
+    erased.insert(&*iterators[i]);
+  }
+
+  std::mutex mutex;
+  std::condition_variable condition;
+  bool erasing_done = false, inserting_done = false;
+  std::thread eraser([&]()
+  {
+    for(std::size_t i = 0 ; i < iterators.size() ; ++i)
+      c13.erase(iterators[i]);
+    std::unique_lock<std::mutex> lock(mutex);
+    erasing_done = true;
+    condition.notify_all();
+    condition.wait(lock, [&]() { return inserting_done; });
+  });
+  std::thread inserter([&]()
+  {
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      condition.wait(lock, [&]() { return erasing_done; });
+    }
+    for(std::size_t i = 0 ; i < v13.size() ; ++i)
+      reused.insert(&*c13.insert(v13[i]));
+    std::lock_guard<std::mutex> lock(mutex);
+    inserting_done = true;
+    condition.notify_all();
+  });
+  eraser.join();
+  inserter.join();
+
+  assert(c13.size() == v13.size());
+  // all the erased elements but the last batches kept by the first thread are reused
+  std::size_t nb_reused = 0;
+  for(const void* p : reused)
+    nb_reused += erased.count(p);
+  std::cout << nb_reused << " elements reused by the other thread" << std::endl;
+  assert(nb_reused + 2 * CGAL_CONCURRENT_COMPACT_CONTAINER_FREE_LIST_BATCH_SIZE >= v13.size());
+  }
+
+  std::cout << "Testing that the unused elements of new blocks are not given to other threads" << std::endl;
+  {
+  // This thread gets a new block with many unused elements, and erases an element
+  Cont c14;
+  Vect v14(1);
+  std::vector<typename Cont::iterator> iterators;
+  while(c14.capacity() - c14.size() < 2 * CGAL_CONCURRENT_COMPACT_CONTAINER_FREE_LIST_BATCH_SIZE)
+    iterators.push_back(c14.insert(v14[0]));
+  c14.erase(iterators.front());
+  const typename Cont::size_type capacity = c14.capacity();
+
+  // Another thread must allocate its own block
+  std::thread inserter([&]() { c14.insert(v14[0]); });
+  inserter.join();
+  assert(c14.capacity() > capacity);
+  }
 }
 
 
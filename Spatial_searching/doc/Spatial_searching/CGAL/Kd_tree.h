@@ -29,13 +29,23 @@ increase memory consumption but provide better search performance.
 See also the `GeneralDistance` and `FuzzyQueryItem` concepts for
 additional requirements when using such a cache.
 
+\tparam EnableCompactLayout can be `Tag_true` or `Tag_false` (the default).
+When `EnableCompactLayout` is set to `Tag_true`, the nodes of the tree are
+stored in depth-first order, also when the tree is built in parallel, and the
+coordinates of the points of each leaf are additionally stored in a contiguous
+block, coordinate by coordinate. The `k`-nearest and furthest neighbor searches of
+`Orthogonal_k_neighbor_search` with `Euclidean_distance` use these blocks to compute
+all the distances to the points of a leaf at once, in loops that the compiler
+can vectorize. This increases memory consumption like `EnablePointsCache`.
+After a call to `remove()`, the blocks are not used until the tree is rebuilt.
+
 \sa `CGAL::Kd_tree_node<Traits>`
 \sa `CGAL::Search_traits_2<Kernel>`
 \sa `CGAL::Search_traits_3<Kernel>`
 \sa `CGAL::Search_traits<FT_,Point,CartesianIterator,ConstructCartesianIterator>`
 
 */
-template< typename Traits, typename Splitter, typename UseExtendedNode, typename EnablePointsCache >
+template< typename Traits, typename Splitter, typename UseExtendedNode, typename EnablePointsCache, typename EnableCompactLayout >
 class Kd_tree {
 public:
 
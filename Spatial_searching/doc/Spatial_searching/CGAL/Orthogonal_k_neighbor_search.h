@@ -102,5 +102,39 @@ std::ostream& statistics(std::ostream& s);
 
 /// @}
 
+/// \name Batched Search
+/// @{
+
+/*!
+Searches approximately the `k` nearest neighbors of each query item of `queries`
+in the points stored in `tree`, using distance `d` and approximation factor `eps`.
+
+The results are written in two flat arrays, without any allocation per query: denoting by `m`
+the returned value, which is the minimum of `k` and of the number of points of `tree`,
+the neighbors of the `i`-th query item are written, sorted by increasing distance,
+at the positions `i*m` to `(i+1)*m - 1` of `indices` and `transformed_distances`.
+A neighbor is given by its index in the range `[tree.begin(), tree.end())`, and
+its transformed distance to the query item is the one of `d` (for example the
+squared distance for `Euclidean_distance`).
+
+Each thread reuses the memory of its searches from one query item to the next.
+
+\tparam ConcurrencyTag enables sequential versus parallel search.
+Possible values are `Sequential_tag` (the default), `Parallel_tag`, and `Parallel_if_available_tag`.
+\tparam QueryRange a model of `ConstRange` with value type `Query_item`. If its iterator type
+is not a random access iterator, the iterators of the range are first copied into a vector.
+\tparam IndexIterator a random access iterator with value type `std::size_t`, such as `std::size_t*`.
+\tparam FTIterator a random access iterator with value type `FT`.
+
+\note As the tree is built if it was not, the indices are only valid until the next insertion of points into `tree`.
+*/
+template <typename ConcurrencyTag = Sequential_tag, typename QueryRange,
+          typename IndexIterator, typename FTIterator>
+static unsigned int batched_search(const SpatialTree& tree, const QueryRange& queries, unsigned int k,
+                                   IndexIterator indices, FTIterator transformed_distances,
+                                   FT eps=FT(0.0), OrthogonalDistance d=OrthogonalDistance());
+
+/// @}
+
 }; /* end Orthogonal_k_neighbor_search */
 } /* end namespace CGAL */
@@ -68,7 +68,8 @@ template <
   class SearchTraits,
   class Splitter_=Sliding_midpoint<SearchTraits>,
   class UseExtendedNode = Tag_true,
-  class EnablePointsCache = Tag_false>
+  class EnablePointsCache = Tag_false,
+  class EnableCompactLayout = Tag_false>
 class Kd_tree {
 
 public:
@@ -81,8 +82,8 @@ public:
   typedef Kd_tree_node<SearchTraits, Splitter, UseExtendedNode, EnablePointsCache> Node;
   typedef Kd_tree_leaf_node<SearchTraits, Splitter, UseExtendedNode, EnablePointsCache> Leaf_node;
   typedef Kd_tree_internal_node<SearchTraits, Splitter, UseExtendedNode, EnablePointsCache> Internal_node;
-  typedef Kd_tree<SearchTraits, Splitter, UseExtendedNode, EnablePointsCache> Tree;
-  typedef Kd_tree<SearchTraits, Splitter, UseExtendedNode, EnablePointsCache> Self;
+  typedef Kd_tree<SearchTraits, Splitter, UseExtendedNode, EnablePointsCache, EnableCompactLayout> Tree;
+  typedef Kd_tree<SearchTraits, Splitter, UseExtendedNode, EnablePointsCache, EnableCompactLayout> Self;
 
   typedef Node* Node_handle;
   typedef const Node* Node_const_handle;
@@ -101,6 +102,7 @@ public:
   typedef typename internal::Get_dimension_tag<SearchTraits>::Dimension D;
 
   typedef EnablePointsCache Enable_points_cache;
+  typedef EnableCompactLayout Enable_compact_layout;
 
 private:
 
@@ -124,6 +126,13 @@ private:
   // for faster queries (reduce the number of cache misses)
   std::vector<FT> points_cache;
 
+  // In compact layout, the coordinates of the points of each leaf are
+  // stored coordinate by coordinate (structure of arrays) in a block, so that
+  // the distances from a query to all the points of a leaf can be vectorized.
+  // The block of the leaf containing the points [b, e) starts at dim*b and
+  // the d-th coordinate of the point b+j is at dim*b + d*(e-b) + j.
+  std::vector<FT> leaf_coordinates;
+
   // Instead of storing the points in arrays in the Kd_tree_node
   // we put all the data in a vector in the Kd_tree.
   // and we only store an iterator range in the Kd_tree_node.
@@ -275,6 +284,67 @@ private:
 
 #endif
 
+  // Copies the subtree of `n` in `new_internal_nodes` and `new_leaf_nodes`
+  // in depth-first order, and returns the handle of its copy.
+  template <typename Internal_nodes, typename Leaf_nodes>
+  static Node_handle
+  copy_subtree(Node_handle n, Internal_nodes& new_internal_nodes, Leaf_nodes& new_leaf_nodes)
+  {
+    if (n->is_leaf())
+    {
+#ifdef CGAL_TBB_STRUCTURE_IN_KD_TREE
+      return &*(new_leaf_nodes.push_back(*static_cast<Leaf_node_handle>(n)));
+#else
+      new_leaf_nodes.emplace_back(*static_cast<Leaf_node_handle>(n));
+      return &(new_leaf_nodes.back());
+#endif
+    }
+
+    Internal_node_handle nh = static_cast<Internal_node_handle>(n);
+#ifdef CGAL_TBB_STRUCTURE_IN_KD_TREE
+    Internal_node_handle new_nh = &*(new_internal_nodes.push_back(*nh));
+#else
+    new_internal_nodes.emplace_back(*nh);
+    Internal_node_handle new_nh = &(new_internal_nodes.back());
+#endif
+    new_nh->lower_ch = copy_subtree(nh->lower_ch, new_internal_nodes, new_leaf_nodes);
+    new_nh->upper_ch = copy_subtree(nh->upper_ch, new_internal_nodes, new_leaf_nodes);
+    return new_nh;
+  }
+
+  // The sequential construction creates the nodes in depth-first order, but
+  // the parallel one interleaves the nodes of the subtrees built concurrently.
+  void compact_nodes(const Sequential_tag&) { }
+
+  void compact_nodes(const Parallel_tag&)
+  {
+    decltype(internal_nodes) new_internal_nodes;
+    decltype(leaf_nodes) new_leaf_nodes;
+#ifdef CGAL_TBB_STRUCTURE_IN_KD_TREE
+    new_internal_nodes.reserve(internal_nodes.size());
+    new_leaf_nodes.reserve(leaf_nodes.size());
+#endif
+    tree_root = copy_subtree(tree_root, new_internal_nodes, new_leaf_nodes);
+    internal_nodes.swap(new_internal_nodes);
+    leaf_nodes.swap(new_leaf_nodes);
+  }
+
+  void build_leaf_coordinates()
+  {
+    typename SearchTraits::Construct_cartesian_const_iterator_d construct_it = traits_.construct_cartesian_const_iterator_d_object();
+    leaf_coordinates.resize(dim_ * pts.size());
+    for(std::size_t i = 0; i < leaf_nodes.size(); ++i){
+      const std::size_t b = leaf_nodes[i].begin() - pts.begin();
+      const std::size_t n = leaf_nodes[i].size();
+      FT* block = leaf_coordinates.data() + dim_ * b;
+      for(std::size_t j = 0; j < n; ++j){
+        typename SearchTraits::Cartesian_const_iterator_d cit = construct_it(pts[b + j]);
+        for(int d = 0; d < dim_; ++d, ++cit)
+          block[d * n + j] = *cit;
+      }
+    }
+  }
+
 public:
 
   Kd_tree(Splitter s = Splitter(),const SearchTraits traits=SearchTraits())
@@ -371,6 +441,12 @@ public:
 
     data.clear();
 
+    if (Enable_compact_layout::value)
+    {
+      compact_nodes(ConcurrencyTag());
+      build_leaf_coordinates();
+    }
+
     built_ = true;
   }
 
@@ -446,6 +522,7 @@ public:
       internal_nodes.clear();
       leaf_nodes.clear();
       data.clear();
+      leaf_coordinates.clear();
       delete bbox;
       built_ = false;
     }
@@ -514,6 +591,10 @@ public:
     // Do not set the flag is the tree has been cleared.
     if(is_built())
       removed_ |= success;
+
+    // The points of the leaves have moved: the blocks are not valid anymore
+    if(success)
+      leaf_coordinates.clear();
   }
 private:
   template<class Equal>
@@ -669,6 +750,17 @@ public:
     return points_cache.begin();
   }
 
+  // Returns a pointer to the block of coordinates of the points of `node`
+  // (see `leaf_coordinates`), or `nullptr` if the blocks are not available,
+  // that is if the tree does not use the compact layout or if a point was removed.
+  const FT*
+  leaf_coordinates_begin(Leaf_node_const_handle node) const
+  {
+    if (leaf_coordinates.empty())
+      return nullptr;
+    return leaf_coordinates.data() + dim_ * (node->begin() - pts.begin());
+  }
+
   const_iterator
   begin() const
   {
@@ -22,7 +22,20 @@
 #include <CGAL/Spatial_searching/internal/K_neighbor_search.h>
 #include <CGAL/Spatial_searching/internal/Search_helpers.h>
 
+#include <CGAL/tags.h>
+
+#include <boost/optional.hpp>
+
 #include <iterator> // for std::distance
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/enumerable_thread_specific.h>
+#include <tbb/parallel_for.h>
+#endif
 
 namespace CGAL {
 
@@ -33,6 +46,7 @@ template <class SearchTraits,
 class Orthogonal_k_neighbor_search: public internal::K_neighbor_search<SearchTraits,Distance,Splitter,Tree>
 {
   typedef internal::K_neighbor_search<SearchTraits,Distance,Splitter,Tree> Base;
+  typedef Orthogonal_k_neighbor_search<SearchTraits,Distance,Splitter,Tree> Self;
   typedef typename Tree::Point_d Point;
 
 public:
@@ -43,8 +57,10 @@ private:
 
   internal::Distance_helper<Distance, SearchTraits> m_distance_helper;
   std::vector<FT> dists;
+  std::vector<FT> m_leaf_distances;
   int m_dim;
   Tree const& m_tree;
+  bool m_sorted;
 
 public:
 
@@ -52,7 +68,8 @@ public:
                                unsigned int k=1, FT Eps=FT(0.0), bool Search_nearest=true, const Distance& d=Distance(),bool sorted=true)
   : Base(q,k,Eps,Search_nearest,d),
     m_distance_helper(this->distance_instance, tree.traits()),
-    m_tree(tree)
+    m_tree(tree),
+    m_sorted(sorted)
   {
     if (tree.empty()) return;
 
@@ -62,23 +79,148 @@ public:
     m_dim = static_cast<int>(std::distance(query_object_it, construct_it(this->query_object,0)));
 
     dists.resize(m_dim);
+    compute_neighbors();
+  }
+
+  // undocumented: restarts the search with the query item `q`, reusing the memory
+  // allocated by the previous search. The other parameters of the search are unchanged.
+  void search(const typename Base::Query_item& q)
+  {
+    this->reset(q);
+    if (m_tree.empty()) return;
+
+    typename SearchTraits::Construct_cartesian_const_iterator_d construct_it=m_tree.traits().construct_cartesian_const_iterator_d_object();
+    query_object_it = construct_it(this->query_object);
+    compute_neighbors();
+  }
+
+  template <typename ConcurrencyTag = Sequential_tag,
+            typename QueryRange, typename IndexIterator, typename FTIterator>
+  static unsigned int
+  batched_search(const Tree& tree, const QueryRange& queries, unsigned int k,
+                 IndexIterator indices, FTIterator transformed_distances,
+                 FT Eps=FT(0.0), const Distance& d=Distance())
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    CGAL_static_assertion_msg (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                               "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+    if (tree.empty()) return 0;
+    const unsigned int nb_neighbors = static_cast<unsigned int>((std::min)(std::size_t(k), std::size_t(tree.size())));
+
+    // the construction of the tree reorders its points, so it must be done first
+    tree.root();
+    const Point* first_point = std::addressof(*tree.begin());
+
+    // the iterators of a range without random access are stored, so that the i-th query is found in constant time
+    typedef decltype(queries.begin())                                              Query_iterator;
+    const bool is_random_access =
+      std::is_convertible<typename std::iterator_traits<Query_iterator>::iterator_category,
+                          std::random_access_iterator_tag>::value;
+    std::vector<Query_iterator> query_iterators;
+    if (!is_random_access)
+      for (Query_iterator it = queries.begin(); it != queries.end(); ++it)
+        query_iterators.push_back(it);
+
+    auto search_query = [&](boost::optional<Self>& searcher, const std::size_t i)
+    {
+      const typename Base::Query_item& q = is_random_access ? *(std::next(queries.begin(), i))
+                                                            : *(query_iterators[i]);
+      if (searcher)
+        searcher->search(q);
+      else
+        searcher.emplace(tree, q, nb_neighbors, Eps, true, d, true);
+
+      std::size_t j = i * nb_neighbors;
+      for (typename Base::advanced_iterator it = searcher->advanced_begin(); it != searcher->advanced_end(); ++it, ++j)
+      {
+        *(indices + j) = static_cast<std::size_t>(it->first - first_point);
+        *(transformed_distances + j) = it->second;
+      }
+    };
+
+    const std::size_t nb_queries = is_random_access ? std::size_t(std::distance(queries.begin(), queries.end()))
+                                                    : query_iterators.size();
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::enumerable_thread_specific<boost::optional<Self> > searchers;
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, nb_queries),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          boost::optional<Self>& searcher = searchers.local();
+                          for (std::size_t i = r.begin(); i != r.end(); ++i)
+                            search_query(searcher, i);
+                        });
+    }
+    else
+#endif
+    {
+      boost::optional<Self> searcher;
+      for (std::size_t i = 0; i < nb_queries; ++i)
+        search_query(searcher, i);
+    }
+
+    return nb_neighbors;
+  }
+
+private:
+
+  void compute_neighbors()
+  {
     for(int i=0;i<m_dim;i++)
         dists[i]=0;
 
     FT distance_to_root;
     if (this->search_nearest){
-      distance_to_root = this->distance_instance.min_distance_to_rectangle(q, tree.bounding_box(),dists);
-      compute_nearest_neighbors_orthogonally(tree.root(), distance_to_root);
+      distance_to_root = this->distance_instance.min_distance_to_rectangle(this->query_object, m_tree.bounding_box(),dists);
+      compute_nearest_neighbors_orthogonally(m_tree.root(), distance_to_root);
     }
     else {
-      distance_to_root = this->distance_instance.max_distance_to_rectangle(q, tree.bounding_box(),dists);
-      compute_furthest_neighbors_orthogonally(tree.root(), distance_to_root);
+      distance_to_root = this->distance_instance.max_distance_to_rectangle(this->query_object, m_tree.bounding_box(),dists);
+      compute_furthest_neighbors_orthogonally(m_tree.root(), distance_to_root);
     }
 
-    if (sorted) this->queue.sort();
+    if (m_sorted) this->queue.sort();
   }
+
 private:
 
+  typedef typename internal::Has_leaf_coordinate_blocks<
+    Tree, Distance, internal::has_Enable_compact_layout<Tree>::type::value>::type Leaf_coordinate_blocks;
+
+  // With blocks of coordinates: the distances to all the points of the leaf
+  // are computed at once. Returns `false` if the blocks are not available.
+  bool compute_distances_in_leaf_block(typename Tree::Leaf_node_const_handle node)
+  {
+    const FT* block = m_tree.leaf_coordinates_begin(node);
+    if (block == nullptr)
+      return false;
+    m_leaf_distances.resize(node->size());
+    internal::squared_distances_to_coordinate_block(query_object_it, m_dim, block,
+                                                    node->size(), m_leaf_distances.data());
+    this->number_of_items_visited += node->size();
+    return true;
+  }
+
+  bool search_nearest_in_leaf_block(typename Tree::Leaf_node_const_handle node, Tag_true)
+  {
+    if (!compute_distances_in_leaf_block(node))
+      return false;
+    typename Tree::iterator it_node_point = node->begin();
+    for (std::size_t j = 0; j < m_leaf_distances.size(); ++j, ++it_node_point)
+    {
+      if (!this->queue.full() || m_leaf_distances[j] < this->queue.top().second)
+        this->queue.insert(std::make_pair(&(*it_node_point), m_leaf_distances[j]));
+    }
+    return true;
+  }
+
+  bool search_nearest_in_leaf_block(typename Tree::Leaf_node_const_handle, Tag_false)
+  {
+    return false;
+  }
+
   // With cache
   void search_nearest_in_leaf(typename Tree::Leaf_node_const_handle node, Tag_true)
   {
@@ -157,7 +299,7 @@ private:
       typename Tree::Leaf_node_const_handle node =
         static_cast<typename Tree::Leaf_node_const_handle>(N);
       this->number_of_leaf_nodes_visited++;
-      if (node->size() > 0)
+      if (node->size() > 0 && !search_nearest_in_leaf_block(node, Leaf_coordinate_blocks()))
       {
         typename internal::Has_points_cache<Tree, internal::has_Enable_points_cache<Tree>::type::value>::type dummy;
         search_nearest_in_leaf(node, dummy);
@@ -198,6 +340,21 @@ private:
     }
   }
 
+  bool search_furthest_in_leaf_block(typename Tree::Leaf_node_const_handle node, Tag_true)
+  {
+    if (!compute_distances_in_leaf_block(node))
+      return false;
+    typename Tree::iterator it_node_point = node->begin();
+    for (std::size_t j = 0; j < m_leaf_distances.size(); ++j, ++it_node_point)
+      this->queue.insert(std::make_pair(&(*it_node_point), m_leaf_distances[j]));
+    return true;
+  }
+
+  bool search_furthest_in_leaf_block(typename Tree::Leaf_node_const_handle, Tag_false)
+  {
+    return false;
+  }
+
   // With cache
   void search_furthest_in_leaf(typename Tree::Leaf_node_const_handle node, Tag_true)
   {
@@ -240,7 +397,7 @@ private:
       typename Tree::Leaf_node_const_handle node =
         static_cast<typename Tree::Leaf_node_const_handle>(N);
       this->number_of_leaf_nodes_visited++;
-      if (node->size() > 0)
+      if (node->size() > 0 && !search_furthest_in_leaf_block(node, Leaf_coordinate_blocks()))
       {
         typename internal::Has_points_cache<Tree, internal::has_Enable_points_cache<Tree>::type::value>::type dummy;
         search_furthest_in_leaf(node, dummy);
@@ -16,10 +16,17 @@
 #include <CGAL/license/Spatial_searching.h>
 
 #include <CGAL/Has_member.h>
+#include <CGAL/tags.h>
 
 #include <boost/mpl/has_xxx.hpp>
 
+#include <cstddef>
+
 namespace CGAL {
+
+template <class SearchTraits>
+class Euclidean_distance;
+
 namespace internal {
 
 // Helper struct to know at compile-time if there is a cache of the points
@@ -44,6 +51,53 @@ struct Has_points_cache<Tree, false>
 CGAL_GENERATE_MEMBER_DETECTOR(transformed_distance_from_coordinates);
 CGAL_GENERATE_MEMBER_DETECTOR(interruptible_transformed_distance);
 BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(has_Enable_points_cache, Enable_points_cache, false)
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(has_Enable_compact_layout, Enable_compact_layout, false)
+
+// Helper struct to know at compile-time if the distances to the points of a leaf
+// can be computed from the blocks of coordinates of the compact layout of the tree.
+// Only the Euclidean distance, whose query items are points, is supported.
+template <typename Tree, typename Distance, bool has_enable_compact_layout>
+struct Has_leaf_coordinate_blocks
+{
+  typedef Tag_false type;
+  static const bool value = false;
+};
+
+template <typename Tree, typename SearchTraits>
+struct Has_leaf_coordinate_blocks<Tree, Euclidean_distance<SearchTraits>, true>
+{
+  typedef typename Tree::Enable_compact_layout type;
+  static const bool value = type::value;
+};
+
+// Computes the squared Euclidean distances from the query point whose coordinates
+// start at `qit` to the `n` points of a leaf whose coordinates are stored
+// in `block`, coordinate by coordinate. The inner loops have no dependency
+// between iterations, so that they can be vectorized by the compiler.
+// The distances are accumulated in the same order as in `Euclidean_distance`.
+template <typename FT, typename Query_coord_iterator>
+void squared_distances_to_coordinate_block(Query_coord_iterator qit, const int dim,
+                                           const FT* block, const std::size_t n,
+                                           FT* out)
+{
+  const FT q0 = *qit;
+  for (std::size_t j = 0; j < n; ++j)
+  {
+    const FT diff = q0 - block[j];
+    out[j] = diff * diff;
+  }
+  for (int d = 1; d < dim; ++d)
+  {
+    ++qit;
+    const FT qd = *qit;
+    const FT* coords = block + d * n;
+    for (std::size_t j = 0; j < n; ++j)
+    {
+      const FT diff = qd - coords[j];
+      out[j] += diff * diff;
+    }
+  }
+}
 
 
 
@@ -0,0 +1,96 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Search_traits_2.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Simple_cartesian<double> K;
+
+// Compares the neighbors found in a tree with the compact layout to the ones
+// found in the same tree without it
+template <typename Traits, typename Point>
+void test(const std::vector<Point>& points, const std::vector<Point>& queries,
+          const bool parallel_build)
+{
+  typedef CGAL::Sliding_midpoint<Traits> Splitter;
+  typedef CGAL::Kd_tree<Traits, Splitter, CGAL::Tag_true, CGAL::Tag_false> Tree;
+  typedef CGAL::Kd_tree<Traits, Splitter, CGAL::Tag_true, CGAL::Tag_false, CGAL::Tag_true> Compact_tree;
+  typedef CGAL::Orthogonal_k_neighbor_search<Traits> Neighbor_search;
+  typedef CGAL::Orthogonal_k_neighbor_search<Traits, typename Neighbor_search::Distance,
+                                             Splitter, Compact_tree> Compact_neighbor_search;
+
+  Tree tree(points.begin(), points.end());
+  Compact_tree compact_tree(points.begin(), points.end());
+  tree.build();
+#ifdef CGAL_LINKED_WITH_TBB
+  if (parallel_build)
+    compact_tree.template build<CGAL::Parallel_tag>();
+  else
+#endif
+    compact_tree.build();
+  assert(parallel_build || std::equal(tree.begin(), tree.end(), compact_tree.begin()));
+
+  // the coordinates of the points of a leaf are stored coordinate by coordinate
+  typename Compact_tree::Node_const_handle n = compact_tree.root();
+  while (!n->is_leaf())
+    n = static_cast<typename Compact_tree::Internal_node_const_handle>(n)->lower();
+  const typename Compact_tree::Leaf_node_const_handle leaf =
+    static_cast<typename Compact_tree::Leaf_node_const_handle>(n);
+  const double* block = compact_tree.leaf_coordinates_begin(leaf);
+  assert(block != nullptr);
+  for (std::size_t j = 0; j < leaf->size(); ++j)
+    for (int d = 0; d < compact_tree.dim(); ++d)
+      assert(block[d * leaf->size() + j] == (*(leaf->begin() + j))[d]);
+
+  for (bool search_nearest : { true, false })
+  {
+    for (const Point& q : queries)
+    {
+      Neighbor_search search(tree, q, 10, 0., search_nearest);
+      Compact_neighbor_search compact_search(compact_tree, q, 10, 0., search_nearest);
+      typename Neighbor_search::iterator it = search.begin();
+      typename Compact_neighbor_search::iterator cit = compact_search.begin();
+      for (; it != search.end(); ++it, ++cit)
+      {
+        assert(cit != compact_search.end());
+        assert(CGAL::abs(it->second - cit->second) <= 1e-12 * (1 + it->second));
+      }
+      assert(cit == compact_search.end());
+    }
+  }
+
+  // after a removal, the search falls back to the points
+  compact_tree.remove(points.front());
+  Neighbor_search search(tree, points.front(), 2);
+  Compact_neighbor_search compact_search(compact_tree, points.front(), 1);
+  assert(compact_search.begin()->second == std::next(search.begin())->second);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+
+  CGAL::Random_points_in_square_2<K::Point_2> rpit2(1.0, rnd);
+  std::vector<K::Point_2> points_2, queries_2;
+  std::copy_n(rpit2, 10000, std::back_inserter(points_2));
+  std::copy_n(rpit2, 200, std::back_inserter(queries_2));
+
+  CGAL::Random_points_in_cube_3<K::Point_3> rpit3(1.0, rnd);
+  std::vector<K::Point_3> points_3, queries_3;
+  std::copy_n(rpit3, 10000, std::back_inserter(points_3));
+  std::copy_n(rpit3, 200, std::back_inserter(queries_3));
+
+  for (bool parallel_build : { false, true })
+  {
+    test<CGAL::Search_traits_2<K> >(points_2, queries_2, parallel_build);
+    test<CGAL::Search_traits_3<K> >(points_3, queries_3, parallel_build);
+  }
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
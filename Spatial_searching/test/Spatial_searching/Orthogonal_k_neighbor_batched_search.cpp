@@ -0,0 +1,113 @@
+#include <CGAL/Simple_cartesian.h>
+#include <CGAL/point_generators_3.h>
+#include <CGAL/Search_traits_3.h>
+#include <CGAL/Search_traits_adapter.h>
+#include <CGAL/Orthogonal_k_neighbor_search.h>
+#include <CGAL/property_map.h>
+
+#include <boost/iterator/counting_iterator.hpp>
+
+#include <iostream>
+#include <list>
+#include <vector>
+#include <cassert>
+
+typedef CGAL::Simple_cartesian<double> K;
+typedef K::Point_3 Point;
+typedef CGAL::Random_points_in_cube_3<Point> Random_points_iterator;
+typedef CGAL::Search_traits_3<K> Traits;
+typedef CGAL::Orthogonal_k_neighbor_search<Traits> Neighbor_search;
+
+typedef CGAL::Sliding_midpoint<Traits> Splitter;
+typedef CGAL::Kd_tree<Traits, Splitter, CGAL::Tag_true, CGAL::Tag_true> Tree_with_cache;
+typedef CGAL::Orthogonal_k_neighbor_search<Traits, Neighbor_search::Distance, Splitter, Tree_with_cache> Neighbor_search_with_cache;
+
+// points given by their indices, as in Point_set_processing_3
+typedef CGAL::Pointer_property_map<Point>::const_type Point_map;
+typedef CGAL::Search_traits_adapter<std::size_t, Point_map, Traits> Traits_with_index;
+typedef CGAL::Orthogonal_k_neighbor_search<Traits_with_index> Neighbor_search_with_index;
+
+template <typename ConcurrencyTag, typename K_search>
+void test(const typename K_search::Tree& tree,
+          const std::vector<typename K_search::Query_item>& queries,
+          const unsigned int k,
+          const typename K_search::Distance& d = typename K_search::Distance())
+{
+  std::vector<std::size_t> indices(queries.size() * k);
+  std::vector<double> distances(queries.size() * k);
+  const unsigned int m = K_search::template batched_search<ConcurrencyTag>(tree, queries, k,
+                                                                           indices.begin(), distances.data(),
+                                                                           0., d);
+  assert(m == (std::min)(std::size_t(k), tree.size()));
+
+  for(std::size_t i=0; i<queries.size(); ++i)
+  {
+    K_search search(tree, queries[i], k, 0., true, d);
+    std::size_t j = i * m;
+    for(typename K_search::iterator it = search.begin(); it != search.end(); ++it, ++j)
+    {
+      assert(distances[j] == it->second);
+      assert(d.transformed_distance(queries[i], *(tree.begin() + indices[j])) == it->second);
+    }
+    assert(j == (i + 1) * m);
+  }
+}
+
+template <typename ConcurrencyTag>
+void test_all(const std::vector<Point>& points, const std::vector<Point>& queries)
+{
+  Neighbor_search::Tree tree(points.begin(), points.end());
+  test<ConcurrencyTag, Neighbor_search>(tree, queries, 1);
+  test<ConcurrencyTag, Neighbor_search>(tree, queries, 10);
+
+  Tree_with_cache tree_with_cache(points.begin(), points.end());
+  test<ConcurrencyTag, Neighbor_search_with_cache>(tree_with_cache, queries, 10);
+
+  Point_map point_map(points.data());
+  Neighbor_search_with_index::Tree tree_with_index(boost::counting_iterator<std::size_t>(0),
+                                                   boost::counting_iterator<std::size_t>(points.size()),
+                                                   Neighbor_search_with_index::Splitter(),
+                                                   Traits_with_index(point_map));
+  test<ConcurrencyTag, Neighbor_search_with_index>(tree_with_index, queries, 10,
+                                                   Neighbor_search_with_index::Distance(point_map));
+
+  // queries in a range without random access
+  const std::list<Point> query_list(queries.begin(), queries.end());
+  std::vector<std::size_t> list_indices(queries.size() * 10), vector_indices(queries.size() * 10);
+  std::vector<double> list_distances(queries.size() * 10), vector_distances(queries.size() * 10);
+  Neighbor_search::batched_search<ConcurrencyTag>(tree, query_list, 10,
+                                                  list_indices.begin(), list_distances.begin());
+  Neighbor_search::batched_search<ConcurrencyTag>(tree, queries, 10,
+                                                  vector_indices.begin(), vector_distances.begin());
+  assert(list_indices == vector_indices);
+  assert(list_distances == vector_distances);
+
+  // more neighbors than points
+  std::vector<Point> few(points.begin(), points.begin() + 5);
+  Neighbor_search::Tree small_tree(few.begin(), few.end());
+  test<ConcurrencyTag, Neighbor_search>(small_tree, queries, 10);
+
+  // empty tree
+  Neighbor_search::Tree empty_tree;
+  std::vector<std::size_t> indices;
+  std::vector<double> distances;
+  assert(Neighbor_search::batched_search<ConcurrencyTag>(empty_tree, queries, 10,
+                                                         indices.begin(), distances.begin()) == 0);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  Random_points_iterator rpit(1.0, rnd);
+  std::vector<Point> points, queries;
+  std::copy_n(rpit, 10000, std::back_inserter(points));
+  std::copy_n(rpit, 1000, std::back_inserter(queries));
+
+  test_all<CGAL::Sequential_tag>(points, queries);
+#ifdef CGAL_LINKED_WITH_TBB
+  test_all<CGAL::Parallel_tag>(points, queries);
+#endif
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
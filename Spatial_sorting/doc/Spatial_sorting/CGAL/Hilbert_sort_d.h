@@ -13,8 +13,12 @@ or the middle depending on the `PolicyTag`.
 Possible values are \link CGAL::Hilbert_sort_median_policy `Hilbert_sort_median_policy` \endlink
 (the default policy) or \link CGAL::Hilbert_sort_middle_policy `Hilbert_sort_middle_policy` \endlink.
 
+\tparam ConcurrencyTag enables sequential versus parallel algorithm.
+Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+With parallelism enabled, the `2^d` subranges of the large ranges are sorted in parallel.
+Parallel sorting is available only when the median strategy policy (the default policy) is used.
 */
-template< typename Traits, typename PolicyTag >
+template< typename Traits, typename PolicyTag, typename ConcurrencyTag = Sequential_tag >
 class Hilbert_sort_d {
 public:
 
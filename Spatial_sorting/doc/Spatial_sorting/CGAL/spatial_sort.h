@@ -13,7 +13,7 @@ It sorts the range `[begin, end)` in place.
 \tparam ConcurrencyTag enables sequential versus parallel algorithm.
 Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
 With parallelism enabled, sorting will be performed using up to four threads in 2D,
-and up to eight threads in 3D.
+and up to eight threads in 3D. In dD, the subranges of the large ranges are sorted in parallel.
 Parallel sorting is available only when the median strategy policy (the default policy) is used.
 
 \tparam InputPointIterator must be a model of `RandomAccessIterator` and
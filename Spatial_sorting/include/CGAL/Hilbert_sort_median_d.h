@@ -12,13 +12,23 @@
 #ifndef CGAL_HILBERT_SORT_MEDIAN_d_H
 #define CGAL_HILBERT_SORT_MEDIAN_d_H
 
+#include <CGAL/assertions.h>
 #include <CGAL/config.h>
+#include <CGAL/tags.h>
+#include <CGAL/use.h>
 #include <functional>
 #include <cstddef>
 #include <iterator>
 #include <vector>
 #include <CGAL/Hilbert_sort_base.h>
 
+#include <boost/type_traits/is_convertible.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace CGAL {
 
 namespace internal {
@@ -43,7 +53,7 @@ struct Hilbert_cmp_d
 
 } // namespace internal
 
-template <class K>
+template <class K, class ConcurrencyTag = Sequential_tag>
 class Hilbert_sort_median_d
 {
 public:
@@ -68,12 +78,15 @@ public:
     : _k(k), _limit (limit)
   {}
 
+  // Splits the range in `2^_dimension` subranges, delimited by `places`, and returns
+  // `false` if the subranges need not be sorted further.
   template <class RandomAccessIterator>
-  void sort (RandomAccessIterator begin, RandomAccessIterator end,
-             Starting_position start, int direction) const
+  bool split (RandomAccessIterator begin, RandomAccessIterator end,
+              const Starting_position& start, int direction,
+              std::vector<RandomAccessIterator>& places, std::vector<int>& dir) const
   {
     if (end - begin <= _limit)
-      return;
+      return false;
 
     int nb_directions = _dimension;
     int nb_splits     = two_to_dim;
@@ -87,8 +100,8 @@ public:
       }
     }
 
-    std::vector<RandomAccessIterator> places(nb_splits +1);
-    std::vector<int>                  dir   (nb_splits +1);
+    places.resize(nb_splits +1);
+    dir.resize(nb_splits +1);
     places[0]=begin;
     places[nb_splits]=end;
 
@@ -114,10 +127,20 @@ public:
       current_dir = (current_dir +1) % _dimension;
     }while (current_dir != last_dir);
 
-    if ( end-begin < two_to_dim) return; // fewer than 2^dim points
+    return ( end-begin >= two_to_dim); // fewer than 2^dim points are not sorted further
+  }
+
+  template <class RandomAccessIterator>
+  void sort (RandomAccessIterator begin, RandomAccessIterator end,
+             Starting_position start, int direction) const
+  {
+    std::vector<RandomAccessIterator> places;
+    std::vector<int>                  dir;
+    if (! split(begin, end, start, direction, places, dir))
+      return;
 
     /////////////start recursive calls
-    last_dir = (direction + _dimension -1) % _dimension;
+    int last_dir = (direction + _dimension -1) % _dimension;
     // first step is special
     sort( places[0], places[1], start, last_dir);
 
@@ -132,6 +155,66 @@ public:
     sort( places[two_to_dim-1], places[two_to_dim], start, last_dir);
   }
 
+  // Same as `sort()`, except that the `2^_dimension` subranges of a large range are sorted in parallel
+  template <class RandomAccessIterator>
+  void parallel_sort (RandomAccessIterator begin, RandomAccessIterator end,
+                      Starting_position start, int direction) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    CGAL_USE(begin);
+    CGAL_USE(end);
+    CGAL_USE(start);
+    CGAL_USE(direction);
+    CGAL_static_assertion_msg (!(boost::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                               "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if((end - begin) <= 2048){ // same cutoff as Hilbert_sort_median_3
+      sort(begin, end, start, direction);
+      return;
+    }
+
+    std::vector<RandomAccessIterator> places;
+    std::vector<int>                  dir;
+    if (! split(begin, end, start, direction, places, dir))
+      return;
+
+    // the starting position and the direction of each subrange, as in `sort()`
+    std::vector<Starting_position> starts(two_to_dim, start);
+    std::vector<int>               directions(two_to_dim);
+    int last_dir = (direction + _dimension -1) % _dimension;
+    directions[0] = last_dir;
+    for(int i=1; i<two_to_dim-1; i +=2){
+      starts[i] = starts[i+1] = start;
+      directions[i] = directions[i+1] = dir[i+1];
+      start[dir[i+1]] = !  start[dir[i+1]];
+      start[last_dir] = !  start[last_dir];
+    }
+    starts[two_to_dim-1] = start;
+    directions[two_to_dim-1] = last_dir;
+
+    tbb::parallel_for(tbb::blocked_range<int>(0, two_to_dim),
+                      [&](const tbb::blocked_range<int>& r)
+                      {
+                        for(int i = r.begin(); i != r.end(); ++i)
+                          parallel_sort(places[i], places[i+1], starts[i], directions[i]);
+                      });
+#endif
+  }
+
+  template <class RandomAccessIterator>
+  void sort (RandomAccessIterator begin, RandomAccessIterator end,
+             const Starting_position& start, Parallel_tag) const
+  {
+    parallel_sort(begin, end, start, 0);
+  }
+
+  template <class RandomAccessIterator>
+  void sort (RandomAccessIterator begin, RandomAccessIterator end,
+             const Starting_position& start, Sequential_tag) const
+  {
+    sort(begin, end, start, 0);
+  }
+
   template <class RandomAccessIterator>
   void operator() (RandomAccessIterator begin, RandomAccessIterator end) const
   {
@@ -152,7 +235,7 @@ public:
     }
 
     // we start with  direction 0;
-    sort (begin, end, start, 0);
+    sort (begin, end, start, ConcurrencyTag());
   }
 };
 
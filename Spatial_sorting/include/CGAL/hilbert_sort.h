@@ -72,7 +72,7 @@ void hilbert_sort (RandomAccessIterator begin,
   boost::rand48 random;
   boost::random_number_generator<boost::rand48, Diff_t> rng(random);
   CGAL::cpp98::random_shuffle(begin,end, rng);
-  (Hilbert_sort_d<Kernel, Policy> (k))(begin, end);
+  (Hilbert_sort_d<Kernel, Policy, ConcurrencyTag> (k))(begin, end);
 }
 
 } // namespace internal
@@ -86,7 +86,7 @@ void spatial_sort (RandomAccessIterator begin, RandomAccessIterator end,
 {
   typedef std::iterator_traits<RandomAccessIterator> Iterator_traits;
   typedef typename Iterator_traits::difference_type Diff_t;
-  typedef Hilbert_sort_d<Kernel, Policy> Sort;
+  typedef Hilbert_sort_d<Kernel, Policy, ConcurrencyTag> Sort;
   boost::rand48 random;
   boost::random_number_generator<boost::rand48, Diff_t> rng(random);
   CGAL::cpp98::random_shuffle(begin,end, rng);
@@ -442,6 +442,7 @@ int main ()
     std::cout << "done." << std::endl;
 
     std::vector<Point> v2 (v);
+    std::vector<Point> v3 (v);
 
     std::cout << "            Sorting points...    " << std::flush;
 
@@ -451,8 +452,18 @@ int main ()
 
     std::cout << "done in "<<timer.time()<<"seconds." << std::endl;
 
+    std::cout << "            Sorting points (parallel)...    " << std::flush;
+
+    timer.reset();timer.start();
+    CGAL::hilbert_sort<CGAL::Parallel_if_available_tag>(v3.begin(), v3.end(), CGAL::Hilbert_sort_median_policy());
+    timer.stop();
+
+    std::cout << "done in " << timer.time() << "seconds." << std::endl;
+
     std::cout << "            Checking...          " << std::flush;
 
+    assert(v == v3);
+
     std::sort (v.begin(),  v.end(), Kd().less_lexicographically_d_object());
     std::sort (v2.begin(), v2.end(),Kd().less_lexicographically_d_object());
     assert(v == v2);
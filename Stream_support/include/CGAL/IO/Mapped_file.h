@@ -0,0 +1,98 @@
+// Copyright (c) 2026  agent <agent@local>.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent <agent@local>
+
+#ifndef CGAL_IO_MAPPED_FILE_H
+#define CGAL_IO_MAPPED_FILE_H
+
+#include <CGAL/config.h>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <boost/interprocess/exceptions.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace CGAL {
+namespace IO {
+namespace internal {
+
+// Read-only memory mapping of a whole file: binary readers access the
+// content of the file directly instead of copying it through a stream.
+class Mapped_file
+{
+  boost::interprocess::file_mapping m_mapping;
+  boost::interprocess::mapped_region m_region;
+  bool m_is_open;
+
+public:
+  Mapped_file(const std::string& fname)
+    : m_is_open(false)
+  {
+    // The mapping fails for missing or empty files, in which case the
+    // caller should fall back to the stream readers
+    try
+    {
+      boost::interprocess::file_mapping mapping(fname.c_str(), boost::interprocess::read_only);
+      boost::interprocess::mapped_region region(mapping, boost::interprocess::read_only);
+      m_mapping.swap(mapping);
+      m_region.swap(region);
+      m_is_open = true;
+    }
+    catch(const boost::interprocess::interprocess_exception&)
+    { }
+  }
+
+  bool is_open() const { return m_is_open; }
+
+  const char* data() const { return static_cast<const char*>(m_region.get_address()); }
+  std::size_t size() const { return m_is_open ? m_region.get_size() : 0; }
+};
+
+// Status of a reader working on a mapped file: readers which do not
+// support the content of the file leave the output untouched, so that
+// the stream readers can be used instead.
+enum Mapped_reading_status
+{
+  MAPPED_READING_SUCCESS,
+  MAPPED_READING_FAILURE,
+  MAPPED_READING_UNSUPPORTED
+};
+
+// Reads a value stored in little endian at a (possibly unaligned) address
+template <typename Type>
+Type read_little_endian(const char* address)
+{
+  Type t;
+#ifdef CGAL_BIG_ENDIAN
+  char buffer[sizeof(Type)];
+  std::reverse_copy(address, address + sizeof(Type), buffer);
+  std::memcpy(&t, buffer, sizeof(Type));
+#else
+  std::memcpy(&t, address, sizeof(Type));
+#endif
+  return t;
+}
+
+// Reads an unsigned integer of `size` bytes stored in little endian
+inline std::size_t read_little_endian_unsigned(const char* address, std::size_t size)
+{
+  std::size_t out = 0;
+  for(std::size_t i = 0; i < size; ++ i)
+    out |= std::size_t(static_cast<unsigned char>(address[i])) << (8 * i);
+  return out;
+}
+
+} // namespace internal
+} // namespace IO
+} // namespace CGAL
+
+#endif // CGAL_IO_MAPPED_FILE_H
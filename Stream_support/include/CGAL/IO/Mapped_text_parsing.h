@@ -0,0 +1,234 @@
+// Copyright (c) 2026  agent <agent@local>.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent <agent@local>
+
+#ifndef CGAL_IO_MAPPED_TEXT_PARSING_H
+#define CGAL_IO_MAPPED_TEXT_PARSING_H
+
+#include <CGAL/IO/Mapped_file.h>
+
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#if CGAL_CXX17 && defined(__has_include)
+#  if __has_include(<charconv>)
+#    include <charconv>
+#  endif
+#endif
+
+namespace CGAL {
+namespace IO {
+namespace internal {
+
+inline bool is_ASCII_blank(const char c)
+{
+  return (c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f');
+}
+
+inline const char* skip_ASCII_blanks(const char* p, const char* end)
+{
+  while(p != end && is_ASCII_blank(*p))
+    ++ p;
+  return p;
+}
+
+// A token can only be followed by a blank or by the end of the line
+inline bool is_ASCII_token_end(const char* p, const char* end)
+{
+  return (p == end || is_ASCII_blank(*p));
+}
+
+// The parsing functions below skip the blanks preceding a number and, if the number is
+// followed by a blank or by the end of the line, set `p` past the number and return `true`.
+// Unlike the extraction from a stream, they do not depend on the locale.
+// As the extraction from a stream, they reject the infinities and NaNs, which
+// `from_chars()` and `strtod()` accept.
+inline bool parse_ASCII_number(const char*& p, const char* end, double& d)
+{
+  const char* first = skip_ASCII_blanks(p, end);
+  if(first != end && *first == '+') // accepted by streams, but not by `from_chars()`
+    ++ first;
+  if(first == end || is_ASCII_blank(*first))
+    return false;
+
+#if defined(__cpp_lib_to_chars) && __cpp_lib_to_chars >= 201611L
+  const std::from_chars_result res = std::from_chars(first, end, d);
+  if(res.ec != std::errc() || !is_ASCII_token_end(res.ptr, end) || !std::isfinite(d))
+    return false;
+  p = res.ptr;
+#else
+  // `strtod()` requires a null-terminated string, which a mapped file is not
+  char buffer[64];
+  const char* last = first;
+  while(last != end && !is_ASCII_blank(*last))
+    ++ last;
+  if(std::size_t(last - first) >= sizeof(buffer))
+    return false;
+  std::memcpy(buffer, first, last - first);
+  buffer[last - first] = '\0';
+
+  char* buffer_end = nullptr;
+  d = std::strtod(buffer, &buffer_end);
+  if(buffer_end != buffer + (last - first) || !std::isfinite(d))
+    return false;
+  p = last;
+#endif
+  return true;
+}
+
+// Parses the digits of a non-negative integer, and sets `p` at the first non-digit character
+inline bool parse_ASCII_digits(const char*& p, const char* end, std::size_t& n)
+{
+  const char* first = p;
+  n = 0;
+  for(; p != end && *p >= '0' && *p <= '9'; ++ p)
+  {
+    const std::size_t digit = std::size_t(*p - '0');
+    if(n > (std::numeric_limits<std::size_t>::max() - digit) / 10)
+      return false;
+    n = 10 * n + digit;
+  }
+  return (p != first);
+}
+
+inline bool parse_ASCII_number(const char*& p, const char* end, std::size_t& n)
+{
+  const char* q = skip_ASCII_blanks(p, end);
+  if(!parse_ASCII_digits(q, end, n) || !is_ASCII_token_end(q, end))
+    return false;
+  p = q;
+  return true;
+}
+
+// Splits the text between `begin` and `end` in chunks of complete lines, whose
+// lines are processed in parallel (if TBB is available) in two passes:
+// - `count_lines()` computes the category of each line, for example vertex or face;
+// - `parse_lines()` parses each line knowing its index among the lines of its category,
+//   so that the results can be written directly at their final place.
+//
+// The categories are given by a classifier `std::size_t(const char* line, const char* line_end)`,
+// which returns `K` for the lines that should be ignored. The end of the line excludes '\n'.
+template <std::size_t K>
+class Line_chunks
+{
+public:
+  typedef std::array<std::size_t, K>                             Line_indices;
+
+private:
+  std::vector<const char*> m_bounds;
+  std::vector<Line_indices> m_first_indices; // first index of each category in each chunk
+
+  template <typename Function>
+  void for_each_line(const std::size_t chunk, const Function& function) const
+  {
+    const char* end = m_bounds[chunk + 1];
+    for(const char* line = m_bounds[chunk]; line != end; )
+    {
+      const char* line_end = static_cast<const char*>(std::memchr(line, '\n', end - line));
+      if(line_end == nullptr)
+        line_end = end;
+      if(!function(line, line_end))
+        return;
+      line = (line_end == end) ? end : line_end + 1;
+    }
+  }
+
+public:
+  Line_chunks(const char* begin, const char* end, const std::size_t chunk_size = (std::size_t(1) << 20))
+  {
+    m_bounds.push_back(begin);
+    while(std::size_t(end - m_bounds.back()) > chunk_size)
+    {
+      const char* cut = m_bounds.back() + chunk_size;
+      const char* line_end = static_cast<const char*>(std::memchr(cut, '\n', end - cut));
+      if(line_end == nullptr || line_end + 1 == end)
+        break;
+      m_bounds.push_back(line_end + 1);
+    }
+    m_bounds.push_back(end);
+  }
+
+  std::size_t number_of_chunks() const { return m_bounds.size() - 1; }
+
+  // Only valid after `count_lines()`
+  std::size_t number_of_lines(const std::size_t category) const { return m_first_indices.back()[category]; }
+
+  template <typename Classifier>
+  void count_lines(const Classifier& classify)
+  {
+    m_first_indices.assign(number_of_chunks() + 1, Line_indices());
+    for(Line_indices& indices : m_first_indices)
+      indices.fill(0);
+
+    // the lines of each chunk are counted in the next slot, which then gives the first indices
+    CGAL::for_each<Parallel_if_available_tag>
+      (CGAL::make_counting_range<std::size_t>(0, number_of_chunks()),
+       [&](const std::size_t chunk) -> bool
+       {
+         Line_indices& counts = m_first_indices[chunk + 1];
+         for_each_line(chunk, [&](const char* line, const char* line_end) -> bool
+                              {
+                                const std::size_t category = classify(line, line_end);
+                                if(category < K)
+                                  ++ counts[category];
+                                return true;
+                              });
+         return true;
+       });
+
+    for(std::size_t chunk = 0; chunk < number_of_chunks(); ++ chunk)
+      for(std::size_t k = 0; k < K; ++ k)
+        m_first_indices[chunk + 1][k] += m_first_indices[chunk][k];
+  }
+
+  // Calls `parse(category, indices, line, line_end)` on each line which is not ignored, where
+  // `indices[k]` is the number of lines of category `k` before the line. Parsing stops as soon
+  // as a call returns `false`, in which case `false` is returned.
+  template <typename Classifier, typename Parser>
+  bool parse_lines(const Classifier& classify, const Parser& parse) const
+  {
+    std::atomic<bool> success(true);
+    CGAL::for_each<Parallel_if_available_tag>
+      (CGAL::make_counting_range<std::size_t>(0, number_of_chunks()),
+       [&](const std::size_t chunk) -> bool
+       {
+         Line_indices indices = m_first_indices[chunk];
+         for_each_line(chunk, [&](const char* line, const char* line_end) -> bool
+                              {
+                                const std::size_t category = classify(line, line_end);
+                                if(category >= K)
+                                  return true;
+                                if(!parse(category, indices, line, line_end))
+                                {
+                                  success = false;
+                                  return false;
+                                }
+                                ++ indices[category];
+                                return true;
+                              });
+         return success;
+       });
+    return success;
+  }
+};
+
+} // namespace internal
+} // namespace IO
+} // namespace CGAL
+
+#endif // CGAL_IO_MAPPED_TEXT_PARSING_H
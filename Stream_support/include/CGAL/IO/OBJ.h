@@ -15,6 +15,7 @@
 #define CGAL_IO_OBJ_H
 
 #include <CGAL/IO/OBJ/File_writer_wavefront.h>
+#include <CGAL/IO/OBJ/OBJ_mapped_reader.h>
 #include <CGAL/IO/Generic_writer.h>
 #include <CGAL/IO/io.h>
 #include <CGAL/IO/helpers.h>
@@ -128,20 +129,7 @@ bool read_OBJ(std::istream& is,
     {
       // this is a commented line, ignored
     }
-    else if(s == "vp" ||
-            // Display
-            s == "bevel" || s == "lod" || s == "ctech" || s == "c_interp" || s == "usemap" || s == "usemtl" ||
-            s == "stech" || s == "d_interp" || s == "mtllib" || s == "shadow_obj" || s == "trace_obj" ||
-            // groups
-            s == "o" || s == "g" || s == "s" ||
-            // Free
-            s == "p" || s == "cstype" || s == "deg" || s == "step" || s == "bmat" || s == "con" ||
-            s == "curv" || s == "curv2" || s == "surf" || s == "parm" || s == "trim" || s == "hole" ||
-            s == "scrv" || s == "sp" || s == "end" ||
-            s == "con" || s == "surf_1" || s == "q0_1" || s == "q1_1" || s == "curv2d_1" ||
-            s == "surf_2" || s == "q0_2" || s == "q1_2" || s == "curv2d_2" ||
-            // supersed statements
-            s == "bsp" || s == "bzp" || s == "cdc" || s == "cdp" || s == "res")
+    else if(is_unsupported_OBJ_keyword(s))
     {
       // valid, but unsupported
     }
@@ -227,6 +215,9 @@ bool read_OBJ(std::istream& is,
 ///
 /// \brief reads the content of the file `fname` into `points` and `polygons`, using the \ref IOStreamOBJ.
 ///
+/// If the coordinates of the points are of type `double`, the file is read from a memory mapping,
+/// and its lines are parsed in parallel if the \ref thirdpartyTBB library is available.
+///
 /// \attention The polygon soup is not cleared, and the data from the file are appended.
 ///
 /// \tparam PointRange a model of the concept `RandomAccessContainer` whose value type is the point type.
@@ -261,6 +252,14 @@ bool read_OBJ(const std::string& fname,
 #endif
               )
 {
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  if(internal::read_mapped_OBJ(fname, points, polygons,
+                               choose_parameter(get_parameter(np, internal_np::verbose), false))
+       == internal::MAPPED_READING_SUCCESS)
+    return true;
+
   std::ifstream is(fname);
   CGAL::IO::set_mode(is, CGAL::IO::ASCII);
   return read_OBJ(is, points, polygons, np);
@@ -0,0 +1,212 @@
+// Copyright (c) 2026  agent <agent@local>.
+//
+// This file is part of CGAL (www.cgal.org)
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent <agent@local>
+
+#ifndef CGAL_IO_OBJ_OBJ_MAPPED_READER_H
+#define CGAL_IO_OBJ_OBJ_MAPPED_READER_H
+
+#include <CGAL/IO/Mapped_file.h>
+#include <CGAL/IO/Mapped_text_parsing.h>
+#include <CGAL/IO/helpers.h>
+
+#include <CGAL/Container_helper.h>
+#include <CGAL/Point_3.h>
+
+#include <boost/range/value_type.hpp>
+
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace CGAL {
+namespace IO {
+namespace internal {
+
+// Statements which are valid, but ignored by the readers
+inline bool is_unsupported_OBJ_keyword(const std::string& s)
+{
+  return (s == "vp" ||
+          // Display
+          s == "bevel" || s == "lod" || s == "ctech" || s == "c_interp" || s == "usemap" || s == "usemtl" ||
+          s == "stech" || s == "d_interp" || s == "mtllib" || s == "shadow_obj" || s == "trace_obj" ||
+          // groups
+          s == "o" || s == "g" || s == "s" ||
+          // Free
+          s == "p" || s == "cstype" || s == "deg" || s == "step" || s == "bmat" || s == "con" ||
+          s == "curv" || s == "curv2" || s == "surf" || s == "parm" || s == "trim" || s == "hole" ||
+          s == "scrv" || s == "sp" || s == "end" ||
+          s == "con" || s == "surf_1" || s == "q0_1" || s == "q1_1" || s == "curv2d_1" ||
+          s == "surf_2" || s == "q0_2" || s == "q1_2" || s == "curv2d_2" ||
+          // supersed statements
+          s == "bsp" || s == "bzp" || s == "cdc" || s == "cdp" || s == "res");
+}
+
+// The stream reader extracts the points with `operator>>()`, which the mapped reader
+// reproduces with `fill_point()` for points with double coordinates only
+template <typename Point>
+struct is_mapped_OBJ_point
+  : public std::false_type
+{ };
+
+template <typename Kernel>
+struct is_mapped_OBJ_point<CGAL::Point_3<Kernel> >
+  : public std::is_same<typename Kernel::FT, double>
+{ };
+
+// Parses the vertex indices of a face line in the same way as the stream reader: an integer is read,
+// and the rest of the entry, for example "/vt/vn", is skipped up to the next space (ignoring at most
+// 256 characters). The reading stops at the first entry which does not start with an integer.
+inline void parse_OBJ_face_indices(const char* p, const char* end, std::vector<int>& ids)
+{
+  ids.clear();
+  for(;;)
+  {
+    p = skip_ASCII_blanks(p, end);
+
+    bool negative = false;
+    if(p != end && (*p == '-' || *p == '+'))
+    {
+      negative = (*p == '-');
+      ++ p;
+    }
+
+    std::size_t n;
+    if(!parse_ASCII_digits(p, end, n) || n > std::size_t((std::numeric_limits<int>::max)()))
+      return;
+    ids.push_back(negative ? - int(n) : int(n));
+
+    const char* skip_end = (std::size_t(end - p) > 256) ? p + 256 : end;
+    while(p != skip_end && *p != ' ')
+      ++ p;
+    if(p != skip_end)
+      ++ p;
+  }
+}
+
+// Reads an OBJ file from a memory mapping of the file.
+//
+// The lines are split in chunks, which are parsed in parallel (if TBB is available) once the vertex
+// and face lines of each chunk have been counted. The indices of the points and polygons of a line
+// are thus known before parsing it, including the number of points which precede a face with relative indices.
+//
+// Returns `MAPPED_READING_UNSUPPORTED` without modifying the output if the file or the point type is
+// not handled in the same way as by the stream reader, or if the stream reader would fail (and report why).
+template <typename PointRange, typename PolygonRange>
+Mapped_reading_status read_mapped_OBJ(const std::string& fname,
+                                      PointRange& points,
+                                      PolygonRange& polygons,
+                                      const bool verbose = false)
+{
+  typedef typename boost::range_value<PointRange>::type                   Point;
+  typedef typename std::iterator_traits<
+    typename PolygonRange::iterator>::iterator_category                   Polygon_iterator_category;
+
+  // The polygons are filled concurrently
+  if(!is_mapped_OBJ_point<Point>::value ||
+     !std::is_convertible<Polygon_iterator_category, std::random_access_iterator_tag>::value)
+    return MAPPED_READING_UNSUPPORTED;
+
+  Mapped_file file(fname);
+  if(!file.is_open())
+    return MAPPED_READING_UNSUPPORTED;
+
+  enum Line_category { VERTEX = 0, FACE, TEXTURE, NORMAL, UNKNOWN, IGNORED };
+
+  auto classify = [](const char* line, const char* line_end) -> std::size_t
+  {
+    line = skip_ASCII_blanks(line, line_end);
+    const char* keyword_end = line;
+    while(keyword_end != line_end && !is_ASCII_blank(*keyword_end))
+      ++ keyword_end;
+
+    const std::size_t size = keyword_end - line;
+    if(size == 0 || *line == '#')
+      return IGNORED;
+    if(size == 1 && *line == 'v')
+      return VERTEX;
+    if(size == 1 && *line == 'f')
+      return FACE;
+    if(size == 2 && line[0] == 'v' && line[1] == 't')
+      return TEXTURE;
+    if(size == 2 && line[0] == 'v' && line[1] == 'n')
+      return NORMAL;
+    return is_unsupported_OBJ_keyword(std::string(line, keyword_end)) ? IGNORED : UNKNOWN;
+  };
+
+  Line_chunks<5> chunks(file.data(), file.data() + file.size());
+  chunks.count_lines(classify);
+
+  const std::size_t first_point = points.size();
+  const std::size_t first_polygon = polygons.size();
+  const int nb_points = static_cast<int>(first_point + chunks.number_of_lines(VERTEX));
+  if(chunks.number_of_lines(UNKNOWN) != 0 || nb_points == 0 || first_polygon + chunks.number_of_lines(FACE) == 0)
+    return MAPPED_READING_UNSUPPORTED;
+
+  CGAL::internal::resize(points, nb_points);
+  polygons.resize(first_polygon + chunks.number_of_lines(FACE));
+
+  const bool ok = chunks.parse_lines(classify,
+    [&](std::size_t category, const Line_chunks<5>::Line_indices& indices, const char* line, const char* line_end) -> bool
+    {
+      line = skip_ASCII_blanks(line, line_end) + 1; // keyword
+      if(category == VERTEX)
+      {
+        double x, y, z;
+        if(!parse_ASCII_number(line, line_end, x) ||
+           !parse_ASCII_number(line, line_end, y) ||
+           !parse_ASCII_number(line, line_end, z))
+          return false;
+        fill_point(x, y, z, 1 /*w*/, points[first_point + indices[VERTEX]]);
+      }
+      else if(category == FACE)
+      {
+        std::vector<int> ids;
+        parse_OBJ_face_indices(line, line_end, ids);
+
+        auto& polygon = *std::next(polygons.begin(), first_polygon + indices[FACE]);
+        CGAL::internal::resize(polygon, ids.size());
+        for(std::size_t j = 0; j < ids.size(); ++ j)
+        {
+          const int i = ids[j];
+          if(i > nb_points + 1 || i < - nb_points)
+            return false;
+
+          typedef typename std::remove_reference<decltype(polygon[j])>::type Index;
+          if(i < 1) // negative indices are relative references
+            polygon[j] = static_cast<Index>(static_cast<int>(first_point + indices[VERTEX]) + i);
+          else
+            polygon[j] = static_cast<Index>(i - 1);
+        }
+      }
+      return true;
+    });
+
+  if(!ok)
+  {
+    points.resize(first_point);
+    polygons.resize(first_polygon);
+    return MAPPED_READING_UNSUPPORTED;
+  }
+
+  if(chunks.number_of_lines(NORMAL) != 0 && verbose)
+    std::cout<<"NOTE: normals were found in this file, but were discarded."<<std::endl;
+  if(chunks.number_of_lines(TEXTURE) != 0 && verbose)
+    std::cout<<"NOTE: textures were found in this file, but were discarded."<<std::endl;
+
+  return MAPPED_READING_SUCCESS;
+}
+
+} // namespace internal
+} // namespace IO
+} // namespace CGAL
+
+#endif // CGAL_IO_OBJ_OBJ_MAPPED_READER_H
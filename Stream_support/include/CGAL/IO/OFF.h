@@ -15,6 +15,7 @@
 #include <CGAL/IO/OFF/File_scanner_OFF.h>
 #include <CGAL/IO/OFF/File_writer_OFF.h>
 #include <CGAL/IO/OFF/generic_copy_OFF.h>
+#include <CGAL/IO/OFF/OFF_mapped_reader.h>
 #include <CGAL/IO/helpers.h>
 #include <CGAL/IO/Generic_writer.h>
 
@@ -208,6 +209,9 @@ bool read_OFF(std::istream& is,
  *
  * \brief reads the content of the file `fname` into `points` and `polygons`, using the \ref IOStreamOFF.
  *
+ * \ascii files without colors, normals, or textures are read from a memory mapping of the file,
+ * and their lines are parsed in parallel if the \ref thirdpartyTBB library is available.
+ *
  * \tparam PointRange a model of the concept `RandomAccessContainer` whose value type is the point type
  * \tparam PolygonRange a model of the concepts `SequenceContainer` and `BackInsertionSequence`
  *                      whose `value_type` is itself a model of the concept `SequenceContainer`
@@ -241,6 +245,14 @@ bool read_OFF(const std::string& fname,
 #endif
               )
 {
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  if(internal::read_mapped_ASCII_OFF(fname, points, polygons,
+                                     choose_parameter(get_parameter(np, internal_np::verbose), false))
+       == internal::MAPPED_READING_SUCCESS)
+    return true;
+
   std::ifstream in(fname);
   return read_OFF(in, points, polygons, np);
 }
@@ -0,0 +1,139 @@
+// Copyright (c) 2026  agent <agent@local>.
+//
+// This file is part of CGAL (www.cgal.org);
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent <agent@local>
+
+#ifndef CGAL_IO_OFF_OFF_MAPPED_READER_H
+#define CGAL_IO_OFF_OFF_MAPPED_READER_H
+
+#include <CGAL/IO/OFF/File_scanner_OFF.h>
+#include <CGAL/IO/Mapped_file.h>
+#include <CGAL/IO/Mapped_text_parsing.h>
+#include <CGAL/IO/helpers.h>
+
+#include <CGAL/Container_helper.h>
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+namespace CGAL {
+namespace IO {
+namespace internal {
+
+// Reads an ASCII OFF file without colors, normals, or textures from a memory mapping of the file.
+//
+// As in the stream reader (see `File_scanner_OFF`), each vertex and each facet is given by a line,
+// and comments and blank lines are ignored. The lines are split in chunks, which are parsed in parallel
+// (if TBB is available) once the lines of each chunk have been counted.
+//
+// Returns `MAPPED_READING_UNSUPPORTED` if the file has other attributes or if a line is not
+// read in the same way as by the stream reader, so that the stream reader handles (and reports)
+// the content of the file. Like the stream reader, the ranges are resized to the sizes given in the header.
+template <typename PointRange, typename PolygonRange>
+Mapped_reading_status read_mapped_ASCII_OFF(const std::string& fname,
+                                            PointRange& points,
+                                            PolygonRange& polygons,
+                                            const bool verbose = false)
+{
+  typedef typename std::iterator_traits<
+    typename PolygonRange::iterator>::iterator_category                   Polygon_iterator_category;
+
+  // The polygons are filled concurrently
+  if(!std::is_convertible<Polygon_iterator_category, std::random_access_iterator_tag>::value)
+    return MAPPED_READING_UNSUPPORTED;
+
+  // The header is parsed by the stream scanner
+  std::streamoff header_size = 0;
+  std::size_t nv = 0, nf = 0, offset = 0;
+  {
+    std::ifstream is(fname, std::ios::binary);
+    if(!is)
+      return MAPPED_READING_UNSUPPORTED;
+
+    CGAL::File_scanner_OFF scanner(is);
+    if(!is || scanner.binary() || scanner.skel() || scanner.has_colors() || scanner.has_normals() ||
+       scanner.has_textures() || scanner.is_homogeneous() || scanner.n_dimensional())
+      return MAPPED_READING_UNSUPPORTED;
+
+    header_size = is.tellg();
+    nv = scanner.size_of_vertices();
+    nf = scanner.size_of_facets();
+    offset = scanner.index_offset();
+  }
+
+  Mapped_file file(fname);
+  if(header_size <= 0 || !file.is_open() || file.size() < std::size_t(header_size))
+    return MAPPED_READING_UNSUPPORTED;
+
+  // Comments and blank lines are ignored, and so are the lines after the last facet
+  auto classify = [](const char* line, const char* line_end) -> std::size_t
+  {
+    line = skip_ASCII_blanks(line, line_end);
+    return (line == line_end || *line == '#') ? 1 : 0;
+  };
+
+  Line_chunks<1> chunks(file.data() + header_size, file.data() + file.size());
+  chunks.count_lines(classify);
+  if(chunks.number_of_lines(0) < nv + nf)
+    return MAPPED_READING_UNSUPPORTED;
+
+  if(verbose)
+    std::cout << "Parsing mapped file in " << chunks.number_of_chunks() << " chunk(s)" << std::endl;
+
+  points.resize(nv);
+  polygons.resize(nf);
+
+  const bool ok = chunks.parse_lines(classify,
+    [&](std::size_t, const Line_chunks<1>::Line_indices& indices, const char* line, const char* line_end) -> bool
+    {
+      // the end of a line is commented out
+      const char* comment = static_cast<const char*>(std::memchr(line, '#', line_end - line));
+      if(comment != nullptr)
+        line_end = comment;
+
+      const std::size_t k = indices[0];
+      if(k < nv)
+      {
+        double x, y, z;
+        if(!parse_ASCII_number(line, line_end, x) ||
+           !parse_ASCII_number(line, line_end, y) ||
+           !parse_ASCII_number(line, line_end, z))
+          return false;
+        fill_point(x, y, z, 1 /*w*/, points[k]);
+      }
+      else if(k < nv + nf)
+      {
+        std::size_t size;
+        if(!parse_ASCII_number(line, line_end, size))
+          return false;
+
+        auto& polygon = *std::next(polygons.begin(), k - nv);
+        CGAL::internal::resize(polygon, size);
+        for(std::size_t j = 0; j < size; ++ j)
+        {
+          std::size_t id;
+          if(!parse_ASCII_number(line, line_end, id) || id < offset || id - offset >= nv)
+            return false;
+          polygon[j] = static_cast<typename std::remove_reference<decltype(polygon[j])>::type>(id - offset);
+        }
+      }
+      return true;
+    });
+
+  return ok ? MAPPED_READING_SUCCESS : MAPPED_READING_UNSUPPORTED;
+}
+
+} // namespace internal
+} // namespace IO
+} // namespace CGAL
+
+#endif // CGAL_IO_OFF_OFF_MAPPED_READER_H
@@ -13,6 +13,7 @@
 #define CGAL_IO_PLY_H
 
 #include <CGAL/IO/PLY/PLY_reader.h>
+#include <CGAL/IO/PLY/PLY_mapped_reader.h>
 #include <CGAL/IO/PLY/PLY_writer.h>
 #include <CGAL/IO/helpers.h>
 
@@ -220,6 +221,24 @@ bool read_PLY(std::istream& is,
   return !is.fail();
 }
 
+// Reads the binary file `fname` from a memory mapping of the file, if its content is supported
+template <class PointRange, class PolygonRange, typename CGAL_NP_TEMPLATE_PARAMETERS>
+Mapped_reading_status read_mapped_PLY(const std::string& fname,
+                                      PointRange& points,
+                                      PolygonRange& polygons,
+                                      const CGAL_NP_CLASS& np = parameters::default_values())
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  return read_mapped_binary_PLY(fname, points, polygons,
+                                choose_parameter(get_parameter(np, internal_np::face_color_output_iterator),
+                                                 CGAL::Emptyset_iterator()),
+                                choose_parameter(get_parameter(np, internal_np::vertex_color_output_iterator),
+                                                 CGAL::Emptyset_iterator()),
+                                choose_parameter(get_parameter(np, internal_np::verbose), true));
+}
+
 } // namespace internal
 
 /// \cond SKIP_IN_MANUAL
@@ -333,6 +352,9 @@ bool read_PLY(std::istream& is,
  *
  * \brief reads the content of `fname` into `points` and `polygons`, using the \ref IOStreamPLY.
  *
+ * Binary little endian files are read from a memory mapping of the file, and the points and
+ * polygons are converted in parallel if the \ref thirdpartyTBB library is available.
+ *
  * \attention The polygon soup is not cleared, and the data from the file are appended.
  *
  * \tparam PointRange a model of the concept `RandomAccessContainer` whose value type is the point type.
@@ -376,6 +398,10 @@ bool read_PLY(const std::string& fname,
   const bool binary = parameters::choose_parameter(parameters::get_parameter(np, internal_np::use_binary_mode), true);
   if(binary)
   {
+    const internal::Mapped_reading_status status = internal::read_mapped_PLY(fname, points, polygons, np);
+    if(status != internal::MAPPED_READING_UNSUPPORTED)
+      return (status == internal::MAPPED_READING_SUCCESS);
+
     std::ifstream is(fname, std::ios::binary);
     CGAL::IO::set_mode(is, CGAL::IO::BINARY);
     return read_PLY(is, points, polygons, np);
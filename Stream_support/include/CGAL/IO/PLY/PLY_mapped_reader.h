@@ -0,0 +1,353 @@
+// Copyright (c) 2026  agent <agent@local>.
+//
+// This file is part of CGAL (www.cgal.org);
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: LGPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent <agent@local>
+
+#ifndef CGAL_IO_PLY_PLY_MAPPED_READER_H
+#define CGAL_IO_PLY_PLY_MAPPED_READER_H
+
+#include <CGAL/IO/PLY/PLY_reader.h>
+#include <CGAL/IO/Color.h>
+#include <CGAL/IO/Mapped_file.h>
+#include <CGAL/IO/helpers.h>
+
+#include <CGAL/Container_helper.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+
+#include <boost/cstdint.hpp>
+#include <boost/range/value_type.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace CGAL {
+namespace IO {
+namespace internal {
+
+// Binary layout of the properties of an element
+struct PLY_binary_property
+{
+  std::size_t size;           // 0 for lists
+  std::size_t size_of_size;   // lists only
+  std::size_t size_of_item;   // lists only
+};
+
+inline std::vector<PLY_binary_property> binary_layout(PLY_element& element)
+{
+  std::vector<PLY_binary_property> out;
+  out.reserve(element.number_of_properties());
+  for(std::size_t k = 0; k < element.number_of_properties(); ++ k)
+  {
+    const PLY_read_number* property = element.property(k);
+    out.push_back({ property->binary_size(),
+                    property->binary_size_of_list_size(),
+                    property->binary_size_of_list_item() });
+  }
+  return out;
+}
+
+// Returns the size of the items of an element, or 0 if the element has lists
+inline std::size_t binary_item_size(const std::vector<PLY_binary_property>& layout)
+{
+  std::size_t out = 0;
+  for(const PLY_binary_property& property : layout)
+  {
+    if(property.size == 0)
+      return 0;
+    out += property.size;
+  }
+  return out;
+}
+
+// Returns the smallest possible size of the items of an element, whose lists are empty
+inline std::size_t binary_minimal_item_size(const std::vector<PLY_binary_property>& layout)
+{
+  std::size_t out = 0;
+  for(const PLY_binary_property& property : layout)
+    out += (property.size != 0) ? property.size : property.size_of_size;
+  return out;
+}
+
+// Returns the end of the first `nb_properties` properties of the item starting at `item`,
+// or nullptr if they go past `end`
+inline const char* skip_binary_PLY_properties(const std::vector<PLY_binary_property>& layout,
+                                              const char* item, const char* end,
+                                              const std::size_t nb_properties)
+{
+  for(std::size_t k = 0; k < nb_properties; ++ k)
+  {
+    const PLY_binary_property& property = layout[k];
+    if(property.size != 0)
+    {
+      if(std::size_t(end - item) < property.size)
+        return nullptr;
+      item += property.size;
+    }
+    else
+    {
+      if(std::size_t(end - item) < property.size_of_size)
+        return nullptr;
+      const std::size_t size = read_little_endian_unsigned(item, property.size_of_size);
+      item += property.size_of_size;
+      if(std::size_t(end - item) / property.size_of_item < size)
+        return nullptr;
+      item += size * property.size_of_item;
+    }
+  }
+  return item;
+}
+
+inline std::size_t property_index(PLY_element& element, const char* tag)
+{
+  for(std::size_t k = 0; k < element.number_of_properties(); ++ k)
+    if(element.property(k)->name() == tag)
+      return k;
+  return element.number_of_properties();
+}
+
+// Returns the indices of the color properties of `element`, using the same
+// rules as the stream reader, or an empty vector if there are no colors
+inline std::vector<std::size_t> color_property_indices(PLY_element& element)
+{
+  std::vector<std::size_t> out;
+  if((element.has_property<boost::uint8_t>("red") || element.has_property<boost::uint8_t>("r")) &&
+     (element.has_property<boost::uint8_t>("green") || element.has_property<boost::uint8_t>("g")) &&
+     (element.has_property<boost::uint8_t>("blue") || element.has_property<boost::uint8_t>("b")))
+  {
+    if(element.has_property<boost::uint8_t>("red"))
+      out = { property_index(element, "red"), property_index(element, "green"), property_index(element, "blue") };
+    else
+      out = { property_index(element, "r"), property_index(element, "g"), property_index(element, "b") };
+  }
+  return out;
+}
+
+inline double read_binary_PLY_coordinate(const char* address, const std::size_t size)
+{
+  return (size == sizeof(double)) ? read_little_endian<double>(address)
+                                  : double(read_little_endian<float>(address));
+}
+
+template <typename ColorOutputIterator>
+void read_binary_PLY_colors(const std::vector<const char*>& items,
+                            const std::vector<PLY_binary_property>& layout,
+                            const std::vector<std::size_t>& colors,
+                            const char* end,
+                            ColorOutputIterator out)
+{
+  unsigned char rgb[3];
+  for(const char* item : items)
+  {
+    for(std::size_t c = 0; c < 3; ++ c)
+      rgb[c] = static_cast<unsigned char>(*skip_binary_PLY_properties(layout, item, end, colors[c]));
+    *out++ = CGAL::IO::Color(rgb[0], rgb[1], rgb[2]);
+  }
+}
+
+// Reads a binary little endian PLY file from a memory mapping of the file.
+//
+// The items of the vertex and face elements are first located sequentially
+// (which only requires to read the sizes of the lists), then the points and
+// the polygons are converted in parallel (if TBB is available).
+//
+// Returns `MAPPED_READING_UNSUPPORTED` without modifying the output if the
+// file is not binary little endian or does not have the expected properties.
+template <typename PointRange, typename PolygonRange,
+          typename FaceColorOutputIterator, typename VertexColorOutputIterator>
+Mapped_reading_status read_mapped_binary_PLY(const std::string& fname,
+                                             PointRange& points,
+                                             PolygonRange& polygons,
+                                             FaceColorOutputIterator fc_out,
+                                             VertexColorOutputIterator vc_out,
+                                             const bool verbose = false)
+{
+  typedef typename boost::range_value<PolygonRange>::type                 Polygon;
+  typedef typename std::iterator_traits<
+    typename PolygonRange::iterator>::iterator_category                   Polygon_iterator_category;
+
+  // The polygons are filled concurrently
+  if(!std::is_convertible<Polygon_iterator_category, std::random_access_iterator_tag>::value)
+    return MAPPED_READING_UNSUPPORTED;
+
+  // The header is parsed by the stream reader, errors are reported by the stream reader
+  std::streamoff header_size = 0;
+  PLY_reader reader(false);
+  {
+    std::ifstream is(fname, std::ios::binary);
+    if(!is || !reader.init(is) || reader.format() != 1)
+      return MAPPED_READING_UNSUPPORTED;
+    header_size = is.tellg();
+    if(header_size <= 0)
+      return MAPPED_READING_UNSUPPORTED;
+  }
+
+  // Check that the properties are supported before modifying the output
+  for(std::size_t i = 0; i < reader.number_of_elements(); ++ i)
+  {
+    PLY_element& element = reader.element(i);
+    if(element.name() == "vertex" || element.name() == "vertices")
+    {
+      for(std::size_t k = 0; k < element.number_of_properties(); ++ k)
+        if(element.property(k)->binary_size() == 0)
+          return MAPPED_READING_UNSUPPORTED;
+      if(!element.has_property<double>("x") || !element.has_property<double>("y") || !element.has_property<double>("z"))
+        return MAPPED_READING_UNSUPPORTED;
+    }
+    else if(element.name() == "face" || element.name() == "faces")
+    {
+      if(!element.has_property<std::vector<boost::int32_t> >("vertex_indices") &&
+         !element.has_property<std::vector<boost::uint32_t> >("vertex_indices") &&
+         !element.has_property<std::vector<boost::int32_t> >("vertex_index") &&
+         !element.has_property<std::vector<boost::uint32_t> >("vertex_index"))
+        return MAPPED_READING_UNSUPPORTED;
+    }
+  }
+
+  Mapped_file file(fname);
+  if(!file.is_open() || file.size() < std::size_t(header_size))
+    return MAPPED_READING_UNSUPPORTED;
+
+  const char* current = file.data() + header_size;
+  const char* end = file.data() + file.size();
+
+  for(std::size_t i = 0; i < reader.number_of_elements(); ++ i)
+  {
+    PLY_element& element = reader.element(i);
+    const std::vector<PLY_binary_property> layout = binary_layout(element);
+
+    // the items of an element without properties take no space, and are ignored
+    if(layout.empty())
+      continue;
+
+    // The number of items given by the header is checked before it is used to allocate memory
+    const std::size_t minimal_item_size = binary_minimal_item_size(layout);
+    if(minimal_item_size == 0)
+      return MAPPED_READING_UNSUPPORTED;
+    if(std::size_t(end - current) / minimal_item_size < element.number_of_items())
+    {
+      if(verbose)
+        std::cerr << "Error: premature end of file while reading element " << element.name() << std::endl;
+      return MAPPED_READING_FAILURE;
+    }
+
+    // Locate the items of the element: their addresses are computed directly if they all
+    // have the same size, otherwise the sizes of the lists are read sequentially
+    std::vector<const char*> items(element.number_of_items());
+    const std::size_t item_size = binary_item_size(layout);
+    if(item_size != 0)
+    {
+      if(std::size_t(end - current) / item_size < items.size())
+        current = nullptr;
+      else
+      {
+        for(std::size_t j = 0; j < items.size(); ++ j)
+          items[j] = current + j * item_size;
+        current += items.size() * item_size;
+      }
+    }
+    else
+    {
+      for(std::size_t j = 0; j < items.size() && current != nullptr; ++ j)
+      {
+        items[j] = current;
+        current = skip_binary_PLY_properties(layout, current, end, layout.size());
+      }
+    }
+
+    if(current == nullptr)
+    {
+      if(verbose)
+        std::cerr << "Error: premature end of file while reading element " << element.name() << std::endl;
+      return MAPPED_READING_FAILURE;
+    }
+
+    if(element.name() == "vertex" || element.name() == "vertices")
+    {
+      std::size_t offsets[3], sizes[3];
+      const char* tags[3] = { "x", "y", "z" };
+      for(std::size_t c = 0; c < 3; ++ c)
+      {
+        const std::size_t k = property_index(element, tags[c]);
+        offsets[c] = 0;
+        for(std::size_t l = 0; l < k; ++ l)
+          offsets[c] += layout[l].size;
+        sizes[c] = layout[k].size;
+      }
+
+      const std::size_t first = points.size();
+      CGAL::internal::resize(points, first + items.size());
+
+      CGAL::for_each<Parallel_if_available_tag>
+        (CGAL::make_counting_range<std::size_t>(0, items.size()),
+         [&](const std::size_t j) -> bool
+         {
+           const char* item = items[j];
+           fill_point(read_binary_PLY_coordinate(item + offsets[0], sizes[0]),
+                      read_binary_PLY_coordinate(item + offsets[1], sizes[1]),
+                      read_binary_PLY_coordinate(item + offsets[2], sizes[2]),
+                      1, points[first + j]);
+           return true;
+         });
+
+      const std::vector<std::size_t> colors = color_property_indices(element);
+      if(!colors.empty())
+        read_binary_PLY_colors(items, layout, colors, end, vc_out);
+    }
+    else if(element.name() == "face" || element.name() == "faces")
+    {
+      // same priority as the stream reader
+      const char* tag = (element.has_property<std::vector<boost::int32_t> >("vertex_indices") ||
+                         element.has_property<std::vector<boost::uint32_t> >("vertex_indices"))
+                        ? "vertex_indices" : "vertex_index";
+      const std::size_t indices = property_index(element, tag);
+      const bool is_signed = element.has_property<std::vector<boost::int32_t> >(tag);
+      const std::size_t size_of_size = layout[indices].size_of_size;
+
+      const std::size_t first = polygons.size();
+      CGAL::internal::resize(polygons, first + items.size());
+
+      CGAL::for_each<Parallel_if_available_tag>
+        (CGAL::make_counting_range<std::size_t>(0, items.size()),
+         [&](const std::size_t j) -> bool
+         {
+           const char* list = skip_binary_PLY_properties(layout, items[j], end, indices);
+           const std::size_t size = read_little_endian_unsigned(list, size_of_size);
+           list += size_of_size;
+
+           Polygon& polygon = *std::next(polygons.begin(), first + j);
+           CGAL::internal::resize(polygon, size);
+           for(std::size_t l = 0; l < size; ++ l, list += 4)
+           {
+             if(is_signed)
+               polygon[l] = std::size_t(read_little_endian<boost::int32_t>(list));
+             else
+               polygon[l] = std::size_t(read_little_endian<boost::uint32_t>(list));
+           }
+           return true;
+         });
+
+      const std::vector<std::size_t> colors = color_property_indices(element);
+      if(!colors.empty())
+        read_binary_PLY_colors(items, layout, colors, end, fc_out);
+    }
+  }
+
+  return MAPPED_READING_SUCCESS;
+}
+
+} // namespace internal
+} // namespace IO
+} // namespace CGAL
+
+#endif // CGAL_IO_PLY_PLY_MAPPED_READER_H
@@ -154,6 +154,12 @@ public:
 
   virtual void get(std::istream& stream) const = 0;
 
+  // Number of bytes of the property in a binary file (0 for lists),
+  // and for lists, number of bytes of the size and of each item of the list
+  virtual std::size_t binary_size() const { return 0; }
+  virtual std::size_t binary_size_of_list_size() const { return 0; }
+  virtual std::size_t binary_size_of_list_item() const { return 0; }
+
   // The two following functions prevent the stream to only extract
   // ONE character (= what the types char imply) by requiring
   // explicitely an integer object when reading the stream
@@ -260,6 +266,8 @@ public:
 
   void get(std::istream& stream) const { m_buffer =(this->read<Type>(stream)); }
 
+  std::size_t binary_size() const { return sizeof(Type); }
+
   const Type& buffer() const { return m_buffer; }
 };
 
@@ -277,6 +285,8 @@ public:
 
   virtual void get(std::istream& stream) const = 0;
 
+  std::size_t binary_size_of_list_item() const { return sizeof(Type); }
+
   const std::vector<Type>& buffer() const { return m_buffer; }
 };
 
@@ -296,6 +306,8 @@ public:
     for(std::size_t i = 0; i < size; ++ i)
       this->m_buffer[i] = this->template read<IndexType>(stream);
   }
+
+  std::size_t binary_size_of_list_size() const { return sizeof(SizeType); }
 };
 
 class PLY_element
@@ -432,10 +444,11 @@ class PLY_reader
 {
   std::vector<PLY_element> m_elements;
   std::string m_comments;
+  std::size_t m_format;
   bool m_verbose;
 
 public:
-  PLY_reader(bool verbose) : m_verbose(verbose) { }
+  PLY_reader(bool verbose) : m_format(0), m_verbose(verbose) { }
 
   std::size_t number_of_elements() const { return m_elements.size(); }
   PLY_element& element(std::size_t idx)
@@ -445,6 +458,9 @@ public:
 
   const std::string& comments() const { return m_comments; }
 
+  // 0 for ASCII, 1 for binary little endian, 2 for binary big endian
+  std::size_t format() const { return m_format; }
+
   template <typename Stream>
   bool init(Stream& stream)
   {
@@ -493,6 +509,7 @@ public:
             std::cerr << "Error: unknown file format \"" << format_string << "\" line " << lineNumber << std::endl;
           return false;
         }
+        m_format = format;
       }
 
       // Comments and vertex properties
@@ -158,6 +158,9 @@ bool read_STL(std::istream& is,
  * \brief reads the content of a file named `fname` into `points` and `facets`, using the \ref IOStreamSTL.
  *
  *  If `use_binary_mode` is `true`, but the reading fails, \ascii reading will be automatically tested.
+ *  Binary files are read from a memory mapping of the file, and their points are converted in parallel
+ *  if the \ref thirdpartyTBB library is available.
+ *
  * \attention The polygon soup is not cleared, and the data from the file are appended.
  *
  * \tparam PointRange a model of the concept `RandomAccessContainer` whose value type is the point type.
@@ -202,6 +205,12 @@ bool read_STL(const std::string& fname,
   const bool binary = parameters::choose_parameter(parameters::get_parameter(np, internal_np::use_binary_mode), true);
   if(binary)
   {
+    const internal::Mapped_reading_status status =
+      internal::read_mapped_binary_STL(fname, points, facets,
+                                       choose_parameter(get_parameter(np, internal_np::verbose), false));
+    if(status == internal::MAPPED_READING_SUCCESS)
+      return true;
+
     std::ifstream is(fname, std::ios::binary);
     CGAL::IO::set_mode(is, BINARY);
     if(read_STL(is, points, facets, np))
@@ -14,13 +14,20 @@
 
 #include <CGAL/IO/io.h>
 #include <CGAL/IO/helpers.h>
+#include <CGAL/IO/Mapped_file.h>
+
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 
 #include <boost/cstdint.hpp>
 #include <boost/range/value_type.hpp>
 
+#include <algorithm>
 #include <cctype>
 #include <iostream>
 #include <map>
+#include <numeric>
 #include <string>
 #include <vector>
 
@@ -285,6 +292,98 @@ bool parse_binary_STL(std::istream& is,
   return !is.fail();
 }
 
+// Reads a binary STL file from a memory mapping of the file.
+//
+// The points of the facets are converted in parallel (if TBB is available), and
+// the identical points are merged by sorting them rather than with a map. Ties
+// are broken by position in the file, which gives the same indices as `parse_binary_STL()`.
+//
+// Returns `MAPPED_READING_UNSUPPORTED` without modifying the output if the size of the
+// file does not match the number of facets given in its header. ASCII files almost
+// never match, as the number of facets would then be formed by 4 printable characters.
+template <class PointRange, class TriangleRange>
+Mapped_reading_status read_mapped_binary_STL(const std::string& fname,
+                                             PointRange& points,
+                                             TriangleRange& facets,
+                                             const bool verbose = false)
+{
+  typedef typename boost::range_value<PointRange>::type         Point;
+  typedef typename boost::range_value<TriangleRange>::type      Triangle;
+
+  Mapped_file file(fname);
+  if(!file.is_open() || file.size() < 84)
+    return MAPPED_READING_UNSUPPORTED;
+
+  // 80 chars of header, the number of facets, and 50 bytes per facet
+  const std::size_t N = read_little_endian<boost::uint32_t>(file.data() + 80);
+  if((file.size() - 84) % 50 != 0 || (file.size() - 84) / 50 != N)
+    return MAPPED_READING_UNSUPPORTED;
+
+  if(verbose)
+    std::cout << "Parsing mapped binary file..." << std::endl << N << " facets to read" << std::endl;
+
+  // The normal of a facet is ignored, then come its 3 points
+  std::vector<Point> corners(3 * N);
+  CGAL::for_each<Parallel_if_available_tag>
+    (CGAL::make_counting_range<std::size_t>(0, N),
+     [&](const std::size_t i) -> bool
+     {
+       const char* facet = file.data() + 84 + 50 * i + 12;
+       for(std::size_t j = 0; j < 3; ++ j, facet += 12)
+         fill_point(read_little_endian<float>(facet),
+                    read_little_endian<float>(facet + 4),
+                    read_little_endian<float>(facet + 8), 1 /*w*/, corners[3 * i + j]);
+       return true;
+     });
+
+  std::vector<std::size_t> order(corners.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&](const std::size_t a, const std::size_t b) -> bool
+            {
+              if(corners[a] < corners[b])
+                return true;
+              if(corners[b] < corners[a])
+                return false;
+              return a < b;
+            });
+
+  // the first occurrence of a point represents all the identical points
+  std::vector<std::size_t> first_occurrence(corners.size());
+  for(std::size_t k = 0; k < order.size(); ++ k)
+  {
+    if(k == 0 || corners[order[k-1]] < corners[order[k]])
+      first_occurrence[order[k]] = order[k];
+    else
+      first_occurrence[order[k]] = first_occurrence[order[k-1]];
+  }
+
+  std::vector<std::size_t> indices(corners.size());
+  for(std::size_t k = 0; k < corners.size(); ++ k)
+  {
+    if(first_occurrence[k] == k)
+    {
+      indices[k] = points.size();
+      points.push_back(corners[k]);
+    }
+    else
+    {
+      indices[k] = indices[first_occurrence[k]];
+    }
+  }
+
+  for(std::size_t i = 0; i < N; ++ i)
+  {
+    Triangle ijk;
+    CGAL::internal::resize(ijk, 3);
+    for(std::size_t j = 0; j < 3; ++ j)
+      ijk[j] = indices[3 * i + j];
+    facets.push_back(ijk);
+  }
+
+  return MAPPED_READING_SUCCESS;
+}
+
 } // namespace internal
 } // namespace IO
 } // namespace CGAL
@@ -11,6 +11,55 @@ typedef CGAL::Simple_cartesian<double>                Kernel;
 typedef Kernel::Point_3                               Point;
 typedef std::vector<std::size_t>                      Face;
 
+// Files given by name are read from a memory mapping, which must give the same soup as the stream reader,
+// including when the output already contains points and polygons
+bool compare_mapped_reading(const std::string& fname)
+{
+  std::vector<Point> points(1, Point(1, 2, 3)), mapped_points(points);
+  std::vector<Face> polygons(1, Face{0, 0, 0}), mapped_polygons(polygons);
+
+  std::ifstream is(fname);
+  const bool ok = CGAL::IO::read_OBJ(is, points, polygons);
+  const bool mapped_ok = CGAL::IO::read_OBJ(fname, mapped_points, mapped_polygons);
+  assert(ok == mapped_ok);
+  if(ok)
+  {
+    assert(points == mapped_points);
+    assert(polygons == mapped_polygons);
+  }
+  return ok;
+}
+
+// Relative indices, texture and normal indices, comments, and groups must be handled as by
+// the stream reader, including across the chunks in which a large file is split
+void test_mapped_reading()
+{
+  const std::size_t nv = 100000;
+  {
+    std::ofstream os("tmp_mapped.obj");
+    os << "# comment\nmtllib tmp.mtl\no object\n";
+    for(std::size_t i=0; i<nv; ++i)
+    {
+      os << "v " << 0.1 * i << "  " << -1.5e-3 * i << "\t" << i % 7 << "\n";
+      if(i % 4 == 0)
+        os << "vt 0.5 0.5\nvn 0 0 1\n\n";
+      if(i >= 2 && i % 3 == 0)
+        os << "f " << i-1 << "/1/1 " << i << "/1/1 " << i+1 << "/1/1\n";
+      else if(i >= 2 && i % 3 == 1)
+        os << "f -1 -2 -3\ng group\n";
+      else if(i >= 2)
+        os << "f " << i-1 << "//1 " << i << "//1 " << i+1 << "//1 -1\n";
+    }
+  }
+  assert(compare_mapped_reading("tmp_mapped.obj"));
+
+  {
+    std::ofstream os("tmp_mapped.obj");
+    os << "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 2 9\n";
+  }
+  assert(!compare_mapped_reading("tmp_mapped.obj"));
+}
+
 int main(int argc, char** argv)
 {
   const char* obj_file = (argc > 1) ? argv[1] : "data/90089.obj";
@@ -69,6 +118,8 @@ int main(int argc, char** argv)
     assert(CGAL::squared_distance(points[i], pts_backup[i]) < 1e-6);
   assert(polygons == pls_backup);
 
+  test_mapped_reading();
+
   std::cout << "Done!" << std::endl;
   return EXIT_SUCCESS;
 }
@@ -11,6 +11,67 @@ typedef CGAL::Simple_cartesian<double>                Kernel;
 typedef Kernel::Point_3                               Point;
 typedef std::vector<std::size_t>                      Face;
 
+// Files given by name are read from a memory mapping, which must give the same soup as the stream reader
+bool compare_mapped_reading(const std::string& fname)
+{
+  std::vector<Point> points, mapped_points;
+  std::vector<Face> polygons, mapped_polygons;
+
+  std::ifstream is(fname);
+  const bool ok = CGAL::IO::read_OFF(is, points, polygons);
+  const bool mapped_ok = CGAL::IO::read_OFF(fname, mapped_points, mapped_polygons);
+  assert(ok == mapped_ok);
+  if(ok)
+  {
+    assert(points == mapped_points);
+    assert(polygons == mapped_polygons);
+  }
+  return ok;
+}
+
+// Comments, blank lines, and trailing values must be handled as by the stream reader,
+// including across the chunks in which a large file is split
+void test_mapped_reading()
+{
+  const std::size_t nv = 100000;
+  {
+    std::ofstream os("tmp_mapped.off");
+    os << "OFF\n# comment\n" << nv << " " << nv - 2 << "\n0\n";
+    for(std::size_t i=0; i<nv; ++i)
+    {
+      os << "  " << 0.1 * i << " " << -1.5e-3 * i << "\t" << i % 7;
+      if(i % 5 == 0)
+        os << " # vertex " << i;
+      os << "\n";
+      if(i % 3 == 0)
+        os << "\n# comment\n";
+    }
+    for(std::size_t i=0; i<nv-2; ++i)
+      os << ((i % 2 == 0) ? "3 " : "4 ") << i << " " << i+1 << " " << i+2 << ((i % 2 == 0) ? "\n" : " 0 1.5\n");
+  }
+  assert(compare_mapped_reading("tmp_mapped.off"));
+
+  {
+    std::ofstream os("tmp_mapped.off");
+    os << "OFF\n3 1 0\n0 0 0\n1 0 0\n0 1 0\n3 0 1 3\n";
+  }
+  assert(!compare_mapped_reading("tmp_mapped.off"));
+
+  // non-finite coordinates are rejected by the stream reader
+  for(const char* token : { "inf", "-inf", "nan", "+nan", "infinity", "INF", "NaN" })
+  {
+    {
+      std::ofstream os("tmp_mapped.off");
+      os << "OFF\n3 1 0\n0 0 0\n1 " << token << " 0\n0 1 0\n3 0 1 2\n";
+    }
+    std::vector<Point> points;
+    std::vector<Face> polygons;
+    assert(CGAL::IO::internal::read_mapped_ASCII_OFF("tmp_mapped.off", points, polygons)
+           == CGAL::IO::internal::MAPPED_READING_UNSUPPORTED);
+    assert(!compare_mapped_reading("tmp_mapped.off"));
+  }
+}
+
 int main(int argc, char** argv)
 {
   const std::string off_file = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/cube.off");
@@ -70,6 +131,8 @@ int main(int argc, char** argv)
     assert(CGAL::squared_distance(points[i], pts_backup[i]) < 1e-6);
   assert(polygons == pls_backup);
 
+  test_mapped_reading();
+
   std::cout << "Done!" << std::endl;
   return EXIT_SUCCESS;
 }
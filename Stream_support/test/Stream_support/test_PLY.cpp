@@ -5,6 +5,7 @@
 
 #include <iostream>
 #include <fstream>
+#include <iterator>
 #include <vector>
 
 typedef CGAL::Simple_cartesian<double>                Kernel;
@@ -71,6 +72,97 @@ int main(int argc, char** argv)
     assert(CGAL::squared_distance(points[i], pts_backup[i]) < 1e-6);
   assert(polygons == pls_backup);
 
+  // binary little endian files given by name are read from a memory mapping,
+  // which must give the same soup as the stream reader
+  points.clear();
+  polygons.clear();
+  assert(CGAL::IO::internal::read_mapped_PLY("tmp.ply", points, polygons) == CGAL::IO::internal::MAPPED_READING_SUCCESS);
+  assert(points == pts_backup);
+  assert(polygons == pls_backup);
+
+  // a number of items larger than what the file can contain is rejected before anything is allocated
+  os.open("tmp_truncated.ply", std::ios::binary);
+  os << "ply\nformat binary_little_endian 1.0\n"
+     << "element vertex 4000000000000\n"
+     << "property double x\nproperty double y\nproperty double z\n"
+     << "end_header\n";
+  for(int c=0; c<3; ++c)
+  {
+    const double coordinate = 1.;
+    os.write(reinterpret_cast<const char*>(&coordinate), sizeof(double));
+  }
+  os.close();
+  points.clear();
+  polygons.clear();
+  assert(CGAL::IO::internal::read_mapped_PLY("tmp_truncated.ply", points, polygons) == CGAL::IO::internal::MAPPED_READING_FAILURE);
+
+  if(argc == 1)
+  {
+    // the colors of the vertices and of the faces are read from the memory mapping
+    std::vector<CGAL::IO::Color> vertex_colors, face_colors;
+    points.clear();
+    polygons.clear();
+    is.open(ply_file);
+    ok = CGAL::IO::read_PLY(is, points, polygons,
+                            CGAL::parameters::vertex_color_output_iterator(std::back_inserter(vertex_colors))
+                                             .face_color_output_iterator(std::back_inserter(face_colors)));
+    assert(ok);
+    is.close();
+    assert(vertex_colors.size() == points.size() && face_colors.size() == polygons.size());
+
+    // binary file written in the byte order of the host, as the PLY writer does
+    auto write_binary = [&os](auto value) { os.write(reinterpret_cast<const char*>(&value), sizeof(value)); };
+    os.open("tmp_colored.ply", std::ios::binary);
+    os << "ply\nformat binary_little_endian 1.0\n"
+       << "element vertex " << points.size() << "\n"
+       << "property double x\nproperty double y\nproperty double z\n"
+       << "property uchar red\nproperty uchar green\nproperty uchar blue\n"
+       << "element face " << polygons.size() << "\n"
+       << "property list uchar int vertex_indices\n"
+       << "property uchar red\nproperty uchar green\nproperty uchar blue\n"
+       << "end_header\n";
+    for(std::size_t i=0; i<points.size(); ++i)
+    {
+      for(int c=0; c<3; ++c)
+        write_binary(points[i][c]);
+      os.put(char(vertex_colors[i].red())).put(char(vertex_colors[i].green())).put(char(vertex_colors[i].blue()));
+    }
+    for(std::size_t i=0; i<polygons.size(); ++i)
+    {
+      os.put(char(polygons[i].size()));
+      for(std::size_t v : polygons[i])
+        write_binary(boost::int32_t(v));
+      os.put(char(face_colors[i].red())).put(char(face_colors[i].green())).put(char(face_colors[i].blue()));
+    }
+    os.close();
+
+    std::vector<Point> mapped_points;
+    std::vector<Face> mapped_polygons;
+    std::vector<CGAL::IO::Color> mapped_vertex_colors, mapped_face_colors;
+    assert(CGAL::IO::internal::read_mapped_PLY("tmp_colored.ply", mapped_points, mapped_polygons,
+                                               CGAL::parameters::vertex_color_output_iterator(std::back_inserter(mapped_vertex_colors))
+                                                                .face_color_output_iterator(std::back_inserter(mapped_face_colors)))
+           == CGAL::IO::internal::MAPPED_READING_SUCCESS);
+    assert(mapped_points == points);
+    assert(mapped_polygons == polygons);
+    assert(mapped_vertex_colors == vertex_colors);
+    assert(mapped_face_colors == face_colors);
+
+    // the reader taking a file name uses the memory mapping
+    mapped_points.clear();
+    mapped_polygons.clear();
+    mapped_vertex_colors.clear();
+    mapped_face_colors.clear();
+    ok = CGAL::IO::read_PLY("tmp_colored.ply", mapped_points, mapped_polygons,
+                            CGAL::parameters::vertex_color_output_iterator(std::back_inserter(mapped_vertex_colors))
+                                             .face_color_output_iterator(std::back_inserter(mapped_face_colors)));
+    assert(ok);
+    assert(mapped_points == points);
+    assert(mapped_polygons == polygons);
+    assert(mapped_vertex_colors == vertex_colors);
+    assert(mapped_face_colors == face_colors);
+  }
+
   std::cout << "Done!" << std::endl;
   return EXIT_SUCCESS;
 }
@@ -45,6 +45,26 @@ void read(const char* fname, std::size_t v, std::size_t f,
   }
 }
 
+// Binary files given by name are read from a memory mapping, which must give
+// the same soup as the stream reader
+template <typename Point_type, typename Polygon_type>
+void compare_mapped_reading(const char* fname)
+{
+  std::cout << "Comparing mapped and stream readings of " << fname << std::endl;
+
+  std::vector<Point_type> points, mapped_points;
+  std::vector<Polygon_type> faces, mapped_faces;
+
+  std::ifstream input(fname, std::ios::in | std::ios::binary);
+  bool ok = CGAL::IO::read_STL(input, points, faces, CGAL::parameters::use_binary_mode(true));
+  assert(ok);
+  ok = CGAL::IO::read_STL(std::string(fname), mapped_points, mapped_faces);
+  assert(ok);
+
+  assert(points == mapped_points);
+  assert(faces == mapped_faces);
+}
+
 void further_tests()
 {
   // bunch of types to test
@@ -66,6 +86,11 @@ void further_tests()
   read<Point_type_3, Polygon_type_1>("data/binary-tetrahedron-non-standard-header-3.stl", 4, 4, true);
   read<Point_type_3, Polygon_type_2>("data/binary-tetrahedron-non-standard-header-4.stl", 4, 4, true);
   read<Point_type_3, Polygon_type_3>("data/binary-tetrahedron-non-standard-header-5.stl", 4, 4, true);
+
+  compare_mapped_reading<Point_type_1, Polygon_type_1>("data/cube.stl");
+  compare_mapped_reading<Point_type_2, Polygon_type_2>("data/binary-tetrahedron-nice-header.stl");
+  compare_mapped_reading<Point_type_1, Polygon_type_2>("data/binary-tetrahedron-non-standard-header-1.stl");
+  compare_mapped_reading<Point_type_1, Polygon_type_2>("data/binary-issue-6374.stl");
 }
 
 int main(int argc, char** argv)
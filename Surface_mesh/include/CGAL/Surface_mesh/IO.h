@@ -19,6 +19,7 @@
 #include <CGAL/Surface_mesh/IO/3MF.h>
 #include <CGAL/Surface_mesh/IO/OFF.h>
 #include <CGAL/Surface_mesh/IO/PLY.h>
+#include <CGAL/Surface_mesh/IO/Snapshot.h>
 
 #include <CGAL/boost/graph/io.h>
 
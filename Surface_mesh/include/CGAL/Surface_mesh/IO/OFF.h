@@ -23,6 +23,7 @@
 #include <CGAL/Kernel_traits.h>
 
 #include <iostream>
+#include <string>
 #include <tuple>
 
 namespace CGAL {
@@ -96,7 +97,8 @@ template <typename Point, typename CGAL_NP_TEMPLATE_PARAMETERS>
 bool read_OFF_with_or_without_fcolors(std::istream& is,
                                       Surface_mesh<Point>& sm,
                                       const CGAL::File_scanner_OFF& scanner,
-                                      const CGAL_NP_CLASS& np)
+                                      const CGAL_NP_CLASS& np,
+                                      const std::string& fname)
 {
   typedef Surface_mesh<Point>                                                             Mesh;
   typedef typename Mesh::Face_index                                                       Face_index;
@@ -122,11 +124,11 @@ bool read_OFF_with_or_without_fcolors(std::istream& is,
   if(is_fcm_requested)
   {
     FCM fcolors = choose_parameter(get_parameter(np, internal_np::face_color_map), fcm);
-    return CGAL::IO::internal::read_OFF_BGL(is, sm, np.face_color_map(fcolors));
+    return CGAL::IO::internal::read_OFF_BGL(is, sm, np.face_color_map(fcolors), fname);
   }
   else
   {
-    return CGAL::IO::internal::read_OFF_BGL(is, sm, np);
+    return CGAL::IO::internal::read_OFF_BGL(is, sm, np, fname);
   }
 }
 
@@ -134,7 +136,8 @@ template <typename Point, typename CGAL_NP_TEMPLATE_PARAMETERS>
 bool read_OFF_with_or_without_vtextures(std::istream& is,
                                         Surface_mesh<Point>& sm,
                                         const CGAL::File_scanner_OFF& scanner,
-                                        const CGAL_NP_CLASS& np)
+                                        const CGAL_NP_CLASS& np,
+                                        const std::string& fname)
 {
   typedef Surface_mesh<Point>                                                                Mesh;
   typedef typename Mesh::Vertex_index                                                        Vertex_index;
@@ -161,11 +164,11 @@ bool read_OFF_with_or_without_vtextures(std::istream& is,
   if(is_vtm_requested)
   {
     VTM vtextures = choose_parameter(get_parameter(np, internal_np::vertex_texture_map), vtm);
-    return read_OFF_with_or_without_fcolors(is, sm, scanner, np.vertex_texture_map(vtextures));
+    return read_OFF_with_or_without_fcolors(is, sm, scanner, np.vertex_texture_map(vtextures), fname);
   }
   else
   {
-    return read_OFF_with_or_without_fcolors(is, sm, scanner, np);
+    return read_OFF_with_or_without_fcolors(is, sm, scanner, np, fname);
   }
 }
 
@@ -173,7 +176,8 @@ template <typename Point, typename CGAL_NP_TEMPLATE_PARAMETERS>
 bool read_OFF_with_or_without_vcolors(std::istream& is,
                                       Surface_mesh<Point>& sm,
                                       const CGAL::File_scanner_OFF& scanner,
-                                      const CGAL_NP_CLASS& np)
+                                      const CGAL_NP_CLASS& np,
+                                      const std::string& fname)
 {
   typedef Surface_mesh<Point>                                                            Mesh;
   typedef typename Mesh::Vertex_index                                                    Vertex_index;
@@ -199,11 +203,11 @@ bool read_OFF_with_or_without_vcolors(std::istream& is,
   if(is_vcm_requested)
   {
     VCM vcolors = choose_parameter(get_parameter(np, internal_np::vertex_color_map), vcm);
-    return read_OFF_with_or_without_vtextures(is, sm, scanner, np.vertex_color_map(vcolors));
+    return read_OFF_with_or_without_vtextures(is, sm, scanner, np.vertex_color_map(vcolors), fname);
   }
   else
   {
-    return read_OFF_with_or_without_vtextures(is, sm, scanner, np);
+    return read_OFF_with_or_without_vtextures(is, sm, scanner, np, fname);
   }
 }
 
@@ -211,7 +215,8 @@ template <typename Point, typename CGAL_NP_TEMPLATE_PARAMETERS>
 bool read_OFF_with_or_without_vnormals(std::istream& is,
                                        Surface_mesh<Point>& sm,
                                        const CGAL::File_scanner_OFF& scanner,
-                                       const CGAL_NP_CLASS& np)
+                                       const CGAL_NP_CLASS& np,
+                                       const std::string& fname)
 {
   typedef Surface_mesh<Point>                                                                Mesh;
   typedef typename Mesh::Vertex_index                                                        Vertex_index;
@@ -238,14 +243,33 @@ bool read_OFF_with_or_without_vnormals(std::istream& is,
   if(is_vnm_requested)
   {
     VNM vnormals = choose_parameter(get_parameter(np, internal_np::vertex_normal_map), vnm);
-    return read_OFF_with_or_without_vcolors(is, sm, scanner, np.vertex_normal_map(vnormals));
+    return read_OFF_with_or_without_vcolors(is, sm, scanner, np.vertex_normal_map(vnormals), fname);
   }
   else
   {
-    return read_OFF_with_or_without_vcolors(is, sm, scanner, np);
+    return read_OFF_with_or_without_vcolors(is, sm, scanner, np, fname);
   }
 }
 
+// If `fname` is not empty, it is the name of the file read by `is`,
+// which is then read from a memory mapping when possible
+template <typename Point, typename CGAL_NP_TEMPLATE_PARAMETERS>
+bool read_surface_mesh_OFF(std::istream& is,
+                           Surface_mesh<Point>& sm,
+                           const CGAL_NP_CLASS& np,
+                           const std::string& fname)
+{
+  std::streampos pos = is.tellg();
+  CGAL::File_scanner_OFF scanner(is, false);
+  is.seekg(pos);
+
+  bool res = read_OFF_with_or_without_vnormals(is, sm, scanner, np, fname);
+  if(!res)
+    sm.clear();
+
+  return res;
+}
+
 } // namespace internal
 
 /// \ingroup PkgSurfaceMeshIOFuncOFF
@@ -324,15 +348,7 @@ bool read_OFF(std::istream& is,
               Surface_mesh<Point>& sm,
               const CGAL_NP_CLASS& np = parameters::default_values())
 {
-  std::streampos pos = is.tellg();
-  CGAL::File_scanner_OFF scanner(is, false);
-  is.seekg(pos);
-
-  bool res = internal::read_OFF_with_or_without_vnormals(is, sm, scanner, np);
-  if(!res)
-    sm.clear();
-
-  return res;
+  return internal::read_surface_mesh_OFF(is, sm, np, std::string());
 }
 
 template <typename Point,
@@ -342,7 +358,7 @@ bool read_OFF(const std::string& fname,
               const CGAL_NP_CLASS& np = parameters::default_values())
 {
   std::ifstream in(fname.c_str());
-  return read_OFF(in, sm, np);
+  return internal::read_surface_mesh_OFF(in, sm, np, fname);
 }
 
 } // namespace IO
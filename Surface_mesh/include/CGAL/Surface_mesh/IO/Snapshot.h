@@ -0,0 +1,549 @@
+// Copyright (c) 2026  agent <agent@local>.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : agent <agent@local>
+
+#ifndef CGAL_SURFACE_MESH_IO_SNAPSHOT_H
+#define CGAL_SURFACE_MESH_IO_SNAPSHOT_H
+
+#include <CGAL/license/Surface_mesh.h>
+
+#include <CGAL/Surface_mesh/Surface_mesh_fwd.h>
+#include <CGAL/Surface_mesh/Properties.h>
+
+#include <CGAL/IO/Color.h>
+#include <CGAL/IO/Mapped_file.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+namespace CGAL {
+namespace IO {
+namespace internal {
+
+// Writes and reads the binary snapshots of `Surface_mesh` (a friend of the class).
+//
+// A snapshot is made of a header followed by one block per property array:
+// - the header is the string "CGAL_SM_SNAPSHOT", the version of the format, a byte order mark,
+//   the size of the index type, and the numbers of elements, removed elements, and free lists of the mesh;
+// - a block is the index type of the property (vertex, halfedge, edge, or face), its name, the name
+//   of its value type given by `std::type_info::name()`, the size of a value, the number of values,
+//   and finally the values themselves as raw memory.
+// Numbers are written as 64-bit unsigned integers and strings are preceded by their size.
+template <typename P>
+class Surface_mesh_snapshot
+{
+  typedef CGAL::Surface_mesh<P>                                   Mesh;
+  typedef typename Mesh::size_type                                size_type;
+  typedef typename Mesh::Vertex_index                             Vertex_index;
+  typedef typename Mesh::Halfedge_index                           Halfedge_index;
+  typedef typename Mesh::Edge_index                               Edge_index;
+  typedef typename Mesh::Face_index                               Face_index;
+
+  enum Index_type { VERTEX = 0, HALFEDGE, EDGE, FACE };
+
+  struct Block
+  {
+    std::uint64_t index_type;
+    std::string name;
+    std::string type_name;
+    std::uint64_t value_size;
+    std::uint64_t size;
+    const char* values;
+  };
+
+  template <typename ... T>
+  struct Type_list { };
+
+  // The property maps of a snapshot with these value types are added to the mesh if it does not have them
+  typedef Type_list<bool, char, signed char, unsigned char, short, unsigned short, int, unsigned int,
+                    long, unsigned long, long long, unsigned long long, float, double,
+                    Vertex_index, Halfedge_index, Edge_index, Face_index, P, CGAL::IO::Color> Addable_types;
+
+  static const char* magic() { return "CGAL_SM_SNAPSHOT"; }
+  static std::size_t magic_size() { return 16; }
+  static std::uint64_t version() { return 1; }
+  static std::uint64_t byte_order_mark() { return 0x0102030405060708; }
+
+  static void write_number(std::ostream& os, const std::uint64_t n)
+  {
+    os.write(reinterpret_cast<const char*>(&n), sizeof(std::uint64_t));
+  }
+
+  static void write_string(std::ostream& os, const std::string& s)
+  {
+    write_number(os, s.size());
+    os.write(s.data(), s.size());
+  }
+
+  static bool read_number(const char*& p, const char* end, std::uint64_t& n)
+  {
+    if(std::size_t(end - p) < sizeof(std::uint64_t))
+      return false;
+    std::memcpy(&n, p, sizeof(std::uint64_t));
+    p += sizeof(std::uint64_t);
+    return true;
+  }
+
+  static bool read_string(const char*& p, const char* end, std::string& s)
+  {
+    std::uint64_t size;
+    if(!read_number(p, end, size) || std::uint64_t(end - p) < size)
+      return false;
+    s.assign(p, std::size_t(size));
+    p += size;
+    return true;
+  }
+
+  template <typename Container>
+  static std::size_t number_of_blocks(const Container& container)
+  {
+    std::size_t out = 0;
+    for(std::size_t i=0; i<container.n_properties(); ++i)
+      if(container.property_array(i).binary_size() != 0)
+        ++ out;
+    return out;
+  }
+
+  // Property maps whose values cannot be written as raw memory are not written
+  template <typename Container>
+  static void write_blocks(std::ostream& os, const Container& container, const Index_type index_type)
+  {
+    for(std::size_t i=0; i<container.n_properties(); ++i)
+    {
+      const Properties::Base_property_array& array = container.property_array(i);
+      if(array.binary_size() == 0)
+        continue;
+
+      write_number(os, index_type);
+      write_string(os, array.name());
+      write_string(os, array.type().name());
+      write_number(os, array.binary_size());
+      write_number(os, container.size());
+      array.write_binary(os);
+    }
+  }
+
+  template <typename Container>
+  static Properties::Base_property_array* find_array(Container& container, const Block& block)
+  {
+    for(std::size_t i=0; i<container.n_properties(); ++i)
+    {
+      Properties::Base_property_array& array = container.property_array(i);
+      if(array.name() == block.name && block.type_name == array.type().name() &&
+         array.binary_size() == block.value_size)
+        return &array;
+    }
+    return nullptr;
+  }
+
+  template <typename Container>
+  static bool add_array(Container&, const Block&, Type_list<>)
+  {
+    return false;
+  }
+
+  template <typename Container, typename T, typename ... Ts>
+  static bool add_array(Container& container, const Block& block, Type_list<T, Ts...>)
+  {
+    if(block.type_name == typeid(T).name())
+    {
+      container.template add<T>(block.name);
+      return true;
+    }
+    return add_array(container, block, Type_list<Ts...>());
+  }
+
+  template <typename Container>
+  static void read_block(Container& container, const Block& block, const bool verbose)
+  {
+    Properties::Base_property_array* array = find_array(container, block);
+    if(array == nullptr && add_array(container, block, Addable_types()))
+      array = find_array(container, block);
+
+    if(array == nullptr)
+    {
+      if(verbose)
+        std::cerr << "Warning: property map " << block.name << " of type " << block.type_name
+                  << " was ignored, as the mesh does not have it" << std::endl;
+      return;
+    }
+
+    array->read_binary(block.values, std::size_t(block.size));
+  }
+
+  // Returns the block of the property map `name` of the mesh, or `nullptr` if the snapshot does not have it
+  template <typename Container>
+  static const Block* find_standard_block(Container& container, const std::vector<Block>& blocks,
+                                          const Index_type index_type, const char* name)
+  {
+    for(const Block& block : blocks)
+      if(block.index_type == std::uint64_t(index_type) && block.name == name && find_array(container, block) != nullptr)
+        return &block;
+    return nullptr;
+  }
+
+  template <typename T>
+  static T value(const Block& block, const std::size_t i)
+  {
+    T t;
+    std::memcpy(&t, block.values + i * sizeof(T), sizeof(T));
+    return t;
+  }
+
+  static bool is_valid_index(const size_type i, const std::uint64_t n)
+  {
+    return (i == (std::numeric_limits<size_type>::max)() || i < n);
+  }
+
+  // Checks that the connectivity of the snapshot only refers to elements of the snapshot (or to null elements).
+  // The connectivity of removed elements stores the free lists, that is, the index of the next removed element;
+  // the free list of the edges is stored in their first halfedge, as halfedge indices.
+  // The opposite of a halfedge is implicit.
+  static bool has_valid_connectivity(const std::uint64_t* sizes, const std::uint64_t* freelists,
+                                     const Block& vconn, const Block& vremoved,
+                                     const Block& hconn,
+                                     const Block& fconn, const Block& fremoved)
+  {
+    typedef typename Mesh::Vertex_connectivity                    Vertex_connectivity;
+    typedef typename Mesh::Halfedge_connectivity                  Halfedge_connectivity;
+    typedef typename Mesh::Face_connectivity                      Face_connectivity;
+
+    if(!is_valid_index(size_type(freelists[0]), sizes[VERTEX]) ||
+       !is_valid_index(size_type(freelists[1]), sizes[HALFEDGE]) ||
+       !is_valid_index(size_type(freelists[2]), sizes[FACE]))
+      return false;
+
+    for(std::size_t i=0; i<sizes[VERTEX]; ++i)
+    {
+      const bool removed = (value<unsigned char>(vremoved, i) != 0);
+      const size_type h = size_type(value<Vertex_connectivity>(vconn, i).halfedge_);
+      if(!is_valid_index(h, sizes[removed ? VERTEX : HALFEDGE]))
+        return false;
+    }
+
+    for(std::size_t i=0; i<sizes[HALFEDGE]; ++i)
+    {
+      const Halfedge_connectivity c = value<Halfedge_connectivity>(hconn, i);
+      if(!is_valid_index(size_type(c.face_), sizes[FACE]) ||
+         !is_valid_index(size_type(c.vertex_), sizes[VERTEX]) ||
+         !is_valid_index(size_type(c.next_halfedge_), sizes[HALFEDGE]) ||
+         !is_valid_index(size_type(c.prev_halfedge_), sizes[HALFEDGE]))
+        return false;
+    }
+
+    for(std::size_t i=0; i<sizes[FACE]; ++i)
+    {
+      const bool removed = (value<unsigned char>(fremoved, i) != 0);
+      const size_type h = size_type(value<Face_connectivity>(fconn, i).halfedge_);
+      if(!is_valid_index(h, sizes[removed ? FACE : HALFEDGE]))
+        return false;
+    }
+
+    return true;
+  }
+
+public:
+  static bool write(std::ostream& os, const Mesh& sm)
+  {
+    os.write(magic(), magic_size());
+    write_number(os, version());
+    write_number(os, byte_order_mark());
+    write_number(os, sizeof(size_type));
+
+    write_number(os, sm.vprops_.size());
+    write_number(os, sm.hprops_.size());
+    write_number(os, sm.eprops_.size());
+    write_number(os, sm.fprops_.size());
+    write_number(os, sm.removed_vertices_);
+    write_number(os, sm.removed_edges_);
+    write_number(os, sm.removed_faces_);
+    write_number(os, sm.vertices_freelist_);
+    write_number(os, sm.edges_freelist_);
+    write_number(os, sm.faces_freelist_);
+    write_number(os, sm.garbage_);
+    write_number(os, sm.recycle_);
+    write_number(os, sm.anonymous_property_);
+
+    write_number(os, number_of_blocks(sm.vprops_) + number_of_blocks(sm.hprops_) +
+                     number_of_blocks(sm.eprops_) + number_of_blocks(sm.fprops_));
+    write_blocks(os, sm.vprops_, VERTEX);
+    write_blocks(os, sm.hprops_, HALFEDGE);
+    write_blocks(os, sm.eprops_, EDGE);
+    write_blocks(os, sm.fprops_, FACE);
+
+    return os.good();
+  }
+
+  // The whole snapshot is checked before `sm` is modified
+  static bool read(const char* data, const std::size_t size, Mesh& sm, const bool verbose)
+  {
+    const char* p = data;
+    const char* end = data + size;
+
+    if(size < magic_size() || std::memcmp(data, magic(), magic_size()) != 0)
+    {
+      if(verbose)
+        std::cerr << "Error: not a surface mesh snapshot" << std::endl;
+      return false;
+    }
+    p += magic_size();
+
+    // header
+    std::uint64_t header[17];
+    for(std::uint64_t& n : header)
+    {
+      if(!read_number(p, end, n))
+      {
+        if(verbose)
+          std::cerr << "Error: truncated snapshot header" << std::endl;
+        return false;
+      }
+    }
+
+    if(header[0] != version() || header[1] != byte_order_mark() || header[2] != sizeof(size_type))
+    {
+      if(verbose)
+        std::cerr << "Error: snapshot written with another version, byte order, or index type" << std::endl;
+      return false;
+    }
+
+    const std::uint64_t* sizes = header + 3; // vertices, halfedges, edges, faces
+    const std::uint64_t max_size = (std::numeric_limits<size_type>::max)();
+    for(std::size_t i=0; i<10; ++i) // numbers of elements and removed elements, free lists
+    {
+      if(sizes[i] > max_size)
+      {
+        if(verbose)
+          std::cerr << "Error: invalid number of elements in snapshot" << std::endl;
+        return false;
+      }
+    }
+    if(sizes[HALFEDGE] != 2 * sizes[EDGE])
+    {
+      if(verbose)
+        std::cerr << "Error: invalid number of halfedges in snapshot" << std::endl;
+      return false;
+    }
+
+    // blocks
+    if(header[16] > std::uint64_t(end - p))
+    {
+      if(verbose)
+        std::cerr << "Error: invalid number of property maps in snapshot" << std::endl;
+      return false;
+    }
+
+    std::vector<Block> blocks(static_cast<std::size_t>(header[16]));
+    for(Block& block : blocks)
+    {
+      if(!read_number(p, end, block.index_type) || block.index_type > FACE ||
+         !read_string(p, end, block.name) || !read_string(p, end, block.type_name) ||
+         !read_number(p, end, block.value_size) || block.value_size == 0 ||
+         !read_number(p, end, block.size) || block.size != sizes[block.index_type] ||
+         std::uint64_t(end - p) / block.value_size < block.size)
+      {
+        if(verbose)
+          std::cerr << "Error: truncated or invalid property map in snapshot" << std::endl;
+        return false;
+      }
+      block.values = p;
+      p += block.size * block.value_size;
+    }
+
+    const Block* vconn = find_standard_block(sm.vprops_, blocks, VERTEX, "v:connectivity");
+    const Block* vremoved = find_standard_block(sm.vprops_, blocks, VERTEX, "v:removed");
+    const Block* hconn = find_standard_block(sm.hprops_, blocks, HALFEDGE, "h:connectivity");
+    const Block* fconn = find_standard_block(sm.fprops_, blocks, FACE, "f:connectivity");
+    const Block* fremoved = find_standard_block(sm.fprops_, blocks, FACE, "f:removed");
+    if(vconn == nullptr || vremoved == nullptr || hconn == nullptr || fconn == nullptr || fremoved == nullptr ||
+       find_standard_block(sm.vprops_, blocks, VERTEX, "v:point") == nullptr ||
+       find_standard_block(sm.eprops_, blocks, EDGE, "e:removed") == nullptr)
+    {
+      if(verbose)
+        std::cerr << "Error: snapshot of a surface mesh with another point type" << std::endl;
+      return false;
+    }
+
+    if(sizes[4] > sizes[VERTEX] || sizes[5] > sizes[EDGE] || sizes[6] > sizes[FACE] ||
+       !has_valid_connectivity(sizes, sizes + 7, *vconn, *vremoved, *hconn, *fconn, *fremoved))
+    {
+      if(verbose)
+        std::cerr << "Error: invalid connectivity in snapshot" << std::endl;
+      return false;
+    }
+
+    // The property maps of `sm` are kept (and filled if they are in the snapshot)
+    sm.clear_without_removing_property_maps();
+    sm.vprops_.resize(std::size_t(sizes[VERTEX]));
+    sm.hprops_.resize(std::size_t(sizes[HALFEDGE]));
+    sm.eprops_.resize(std::size_t(sizes[EDGE]));
+    sm.fprops_.resize(std::size_t(sizes[FACE]));
+
+    for(const Block& block : blocks)
+    {
+      switch(block.index_type)
+      {
+        case VERTEX: read_block(sm.vprops_, block, verbose); break;
+        case HALFEDGE: read_block(sm.hprops_, block, verbose); break;
+        case EDGE: read_block(sm.eprops_, block, verbose); break;
+        default: read_block(sm.fprops_, block, verbose);
+      }
+    }
+
+    sm.removed_vertices_ = size_type(header[7]);
+    sm.removed_edges_ = size_type(header[8]);
+    sm.removed_faces_ = size_type(header[9]);
+    sm.vertices_freelist_ = size_type(header[10]);
+    sm.edges_freelist_ = size_type(header[11]);
+    sm.faces_freelist_ = size_type(header[12]);
+    sm.garbage_ = (header[13] != 0);
+    sm.recycle_ = (header[14] != 0);
+    sm.anonymous_property_ = size_type(header[15]);
+
+    return true;
+  }
+};
+
+} // namespace internal
+
+/// \ingroup PkgSurfaceMeshIOFuncSnapshot
+///
+/// \brief writes the surface mesh `sm` in the output stream `os` as a binary snapshot.
+///
+/// A binary snapshot stores the connectivity of `sm`, including its removed elements and free lists,
+/// and all its property maps whose value type is trivially copyable, as raw memory. It is meant to save
+/// and reload intermediate meshes quickly, and not to exchange meshes: a snapshot can only be read
+/// by a program built with the same compiler on the same architecture.
+///
+/// \attention The flag `std::ios::binary` must be set during the creation of the `ofstream`.
+///
+/// \tparam P The type of the \em point property of a vertex. It must be trivially copyable.
+///
+/// \param os the output stream
+/// \param sm the surface mesh to be written
+///
+/// \returns `true` if writing was successful, `false` otherwise.
+///
+/// \sa `read_binary_snapshot()`
+template <typename P>
+bool write_binary_snapshot(std::ostream& os, const Surface_mesh<P>& sm)
+{
+  CGAL_static_assertion_msg(std::is_trivially_copyable<P>::value,
+                            "The point type of the mesh must be trivially copyable");
+  return internal::Surface_mesh_snapshot<P>::write(os, sm);
+}
+
+/// \ingroup PkgSurfaceMeshIOFuncSnapshot
+///
+/// \brief writes the surface mesh `sm` in the file `fname` as a binary snapshot.
+///
+/// See `write_binary_snapshot(std::ostream&, const Surface_mesh<P>&)`.
+template <typename P>
+bool write_binary_snapshot(const std::string& fname, const Surface_mesh<P>& sm)
+{
+  std::ofstream os(fname, std::ios::binary);
+  return write_binary_snapshot(os, sm);
+}
+
+/// \ingroup PkgSurfaceMeshIOFuncSnapshot
+///
+/// \brief reads the binary snapshot of a surface mesh from the file `fname` into the surface mesh `sm`.
+///
+/// The elements of `sm` are replaced by the elements of the snapshot. The file is accessed through a
+/// memory mapping, and the values of each property map are copied at once. The property maps of
+/// the snapshot are restored as follows:
+/// - if `sm` has a property map with the same name, index type, and value type, its values are replaced;
+/// - otherwise, if the value type is `bool`, an arithmetic type, an index type of `sm`, `P`,
+///   or `CGAL::IO::Color`, the property map is added to `sm`;
+/// - otherwise, the property map is ignored. Such property maps can be restored by adding them
+///   to `sm` before reading the snapshot.
+///
+/// The property maps of `sm` which are not in the snapshot are kept, with their default values.
+///
+/// \tparam P The type of the \em point property of a vertex. It must be trivially copyable.
+///
+/// \tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+///
+/// \param fname the path to the input file
+/// \param sm the surface mesh to be filled
+/// \param np optional \ref bgl_namedparameters "Named Parameters" described below
+///
+/// \cgalNamedParamsBegin
+///   \cgalParamNBegin{verbose}
+///     \cgalParamDescription{whether extra information is printed when an incident occurs during reading}
+///     \cgalParamType{Boolean}
+///     \cgalParamDefault{`false`}
+///   \cgalParamNEnd
+/// \cgalNamedParamsEnd
+///
+/// \returns `true` if reading was successful, `false` otherwise, in which case `sm` is not modified.
+///
+/// \sa `write_binary_snapshot()`
+template <typename P, typename CGAL_NP_TEMPLATE_PARAMETERS>
+bool read_binary_snapshot(const std::string& fname, Surface_mesh<P>& sm,
+                          const CGAL_NP_CLASS& np = parameters::default_values())
+{
+  CGAL_static_assertion_msg(std::is_trivially_copyable<P>::value,
+                            "The point type of the mesh must be trivially copyable");
+
+  const bool verbose = parameters::choose_parameter(parameters::get_parameter(np, internal_np::verbose), false);
+
+  internal::Mapped_file file(fname);
+  if(!file.is_open())
+  {
+    if(verbose)
+      std::cerr << "Error: cannot open file " << fname << std::endl;
+    return false;
+  }
+
+  return internal::Surface_mesh_snapshot<P>::read(file.data(), file.size(), sm, verbose);
+}
+
+/// \ingroup PkgSurfaceMeshIOFuncSnapshot
+///
+/// \brief reads the binary snapshot of a surface mesh from the input stream `is` into the surface mesh `sm`.
+///
+/// See `read_binary_snapshot(const std::string&, Surface_mesh<P>&, const NamedParameters&)`, which should
+/// be preferred as it does not copy the content of the file into memory first.
+///
+/// \attention The flag `std::ios::binary` must be set during the creation of the `ifstream`.
+template <typename P, typename CGAL_NP_TEMPLATE_PARAMETERS>
+bool read_binary_snapshot(std::istream& is, Surface_mesh<P>& sm,
+                          const CGAL_NP_CLASS& np = parameters::default_values())
+{
+  CGAL_static_assertion_msg(std::is_trivially_copyable<P>::value,
+                            "The point type of the mesh must be trivially copyable");
+
+  const bool verbose = parameters::choose_parameter(parameters::get_parameter(np, internal_np::verbose), false);
+
+  const std::vector<char> buffer((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+  if(!internal::Surface_mesh_snapshot<P>::read(buffer.data(), buffer.size(), sm, verbose))
+  {
+    is.setstate(std::ios::failbit);
+    return false;
+  }
+  return true;
+}
+
+} // namespace IO
+} // namespace CGAL
+
+#endif // CGAL_SURFACE_MESH_IO_SNAPSHOT_H
@@ -17,11 +17,18 @@
 #ifndef DOXYGEN_RUNNING
 
 #include <CGAL/assertions.h>
+#include <CGAL/for_each.h>
 #include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 
 #include <algorithm>
+#include <cstring>
+#include <iostream>
 #include <string>
+#include <type_traits>
 #include <typeinfo>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace CGAL {
@@ -64,6 +71,14 @@ public:
     /// Let two elements swap their storage place.
     virtual void swap(size_t i0, size_t i1) = 0;
 
+    /// Move elements: for each pair of moves, in this order, the element at the second
+    /// index is moved to the first index. If parallel is true, the moves are independent
+    /// and may be done concurrently.
+    virtual void move(const std::vector<std::pair<std::size_t, std::size_t> >& moves, bool parallel) = 0;
+
+    /// Permute elements: the element at index order[i] gets the index i.
+    virtual void permute(const std::vector<std::size_t>& order) = 0;
+
     /// Return a deep copy of self.
     virtual Base_property_array* clone () const = 0;
 
@@ -73,6 +88,16 @@ public:
     /// Return the type_info of the property
     virtual const std::type_info& type() const = 0;
 
+    /// Return the size in bytes of the binary representation of an element,
+    /// or 0 if the elements cannot be written as raw memory.
+    virtual std::size_t binary_size() const = 0;
+
+    /// Write the binary representation of all elements.
+    virtual void write_binary(std::ostream& os) const = 0;
+
+    /// Replace the elements by the n elements whose binary representation starts at data.
+    virtual bool read_binary(const char* data, std::size_t n) = 0;
+
     /// Return the name of the property
     const std::string& name() const { return name_; }
 
@@ -153,7 +178,8 @@ public: // virtual interface of Base_property_array
 
     virtual void shrink_to_fit()
     {
-        vector_type(data_).swap(data_);
+        if (data_.capacity() != data_.size())
+            vector_type(data_).swap(data_);
     }
 
     virtual void swap(size_t i0, size_t i1)
@@ -163,6 +189,35 @@ public: // virtual interface of Base_property_array
         data_[i1]=d;
     }
 
+    virtual void move(const std::vector<std::pair<std::size_t, std::size_t> >& moves, bool parallel)
+    {
+        // the bits of a std::vector<bool> cannot be written concurrently
+        if (parallel && !std::is_same<T, bool>::value)
+        {
+            CGAL::for_each<Parallel_if_available_tag>
+              (moves, [&](const std::pair<std::size_t, std::size_t>& m) -> bool
+                      {
+                        data_[m.first] = std::move(data_[m.second]);
+                        return true;
+                      });
+        }
+        else
+        {
+            for (const std::pair<std::size_t, std::size_t>& m : moves)
+                data_[m.first] = std::move(data_[m.second]);
+        }
+    }
+
+    virtual void permute(const std::vector<std::size_t>& order)
+    {
+        CGAL_assertion(order.size() == data_.size());
+        vector_type permuted;
+        permuted.reserve(order.size());
+        for (std::size_t i : order)
+            permuted.push_back(std::move(data_[i]));
+        data_.swap(permuted);
+    }
+
     virtual Base_property_array* clone() const
     {
         Property_array<T>* p = new Property_array<T>(this->name_, this->value_);
@@ -178,6 +233,64 @@ public: // virtual interface of Base_property_array
 
     virtual const std::type_info& type() const { return typeid(T); }
 
+    virtual std::size_t binary_size() const
+    {
+        return binary_size(Binary_category());
+    }
+
+    virtual void write_binary(std::ostream& os) const
+    {
+        write_binary(os, Binary_category());
+    }
+
+    virtual bool read_binary(const char* data, std::size_t n)
+    {
+        return read_binary(data, n, Binary_category());
+    }
+
+private:
+
+    // Trivially copyable elements are copied as raw memory, and Booleans
+    // (packed in a std::vector<bool>) are converted to and from bytes
+    typedef std::integral_constant<int, std::is_same<T, bool>::value ? 2
+                                      : (std::is_trivially_copyable<T>::value ? 1 : 0)> Binary_category;
+
+    std::size_t binary_size(std::integral_constant<int, 0>) const { return 0; }
+    std::size_t binary_size(std::integral_constant<int, 1>) const { return sizeof(T); }
+    std::size_t binary_size(std::integral_constant<int, 2>) const { return 1; }
+
+    void write_binary(std::ostream&, std::integral_constant<int, 0>) const { }
+
+    void write_binary(std::ostream& os, std::integral_constant<int, 1>) const
+    {
+        if (!data_.empty())
+            os.write(reinterpret_cast<const char*>(data_.data()), data_.size() * sizeof(T));
+    }
+
+    void write_binary(std::ostream& os, std::integral_constant<int, 2>) const
+    {
+        std::vector<char> bytes(data_.begin(), data_.end());
+        if (!bytes.empty())
+            os.write(bytes.data(), bytes.size());
+    }
+
+    bool read_binary(const char*, std::size_t, std::integral_constant<int, 0>) { return false; }
+
+    bool read_binary(const char* data, std::size_t n, std::integral_constant<int, 1>)
+    {
+        data_.resize(n);
+        if (n != 0)
+            std::memcpy(static_cast<void*>(data_.data()), data, n * sizeof(T));
+        return true;
+    }
+
+    bool read_binary(const char* data, std::size_t n, std::integral_constant<int, 2>)
+    {
+        data_.resize(n);
+        for (std::size_t i=0; i<n; ++i)
+            data_[i] = (data[i] != 0);
+        return true;
+    }
 
 public:
 
@@ -257,7 +370,10 @@ public:
             size_ = _rhs.size();
             capacity_ = _rhs.capacity();
             for (std::size_t i=0; i<parrays_.size(); ++i)
+            {
                 parrays_[i] = _rhs.parrays_[i]->clone();
+                index_[parrays_[i]->name()].push_back(parrays_[i]);
+            }
         }
         return *this;
     }
@@ -273,12 +389,8 @@ public:
     void transfer(const Property_container& _rhs)
     {
       for(std::size_t i=0; i<parrays_.size(); ++i){
-        for (std::size_t j=0; j<_rhs.parrays_.size(); ++j){
-          if(parrays_[i]->is_same (*(_rhs.parrays_[j]))){
-            parrays_[i]->transfer(* _rhs.parrays_[j]);
-            break;
-          }
-        }
+        if(Base_property_array* other = _rhs.find(*parrays_[i]))
+          parrays_[i]->transfer(*other);
       }
     }
 
@@ -287,18 +399,10 @@ public:
     {
       for (std::size_t i = 0; i < _rhs.parrays_.size(); ++ i)
       {
-        bool property_already_exists = false;
-        for (std::size_t j = 0; j < parrays_.size(); ++ j)
-          if (_rhs.parrays_[i]->is_same (*(parrays_[j])))
-          {
-            property_already_exists = true;
-            break;
-          }
-
-        if (property_already_exists)
+        if (find(*(_rhs.parrays_[i])) != nullptr)
           continue;
 
-        parrays_.push_back (_rhs.parrays_[i]->empty_clone());
+        insert (_rhs.parrays_[i]->empty_clone());
         parrays_.back()->reserve(capacity_);
         parrays_.back()->resize(size_);
       }
@@ -324,6 +428,19 @@ public:
     // returns the number of property arrays
     size_t n_properties() const { return parrays_.size(); }
 
+    // returns the i-th property array
+    Base_property_array& property_array(std::size_t i)
+    {
+        CGAL_assertion(i < parrays_.size());
+        return *parrays_[i];
+    }
+
+    const Base_property_array& property_array(std::size_t i) const
+    {
+        CGAL_assertion(i < parrays_.size());
+        return *parrays_[i];
+    }
+
     // returns a vector of all property names
     std::vector<std::string> properties() const
     {
@@ -357,36 +474,35 @@ public:
     add(const std::string& name, const T t=T())
     {
         typedef typename Ref_class::template Get_property_map<Key, T>::type Pmap;
-        for (std::size_t i=0; i<parrays_.size(); ++i)
-        {
-            std::pair<Pmap, bool> out = get<T>(name, i);
-            if (out.second)
-              {
-                out.second = false;
-                return out;
-              }
-        }
+        std::pair<Pmap, bool> out = get<T>(name);
+        if (out.second)
+          {
+            out.second = false;
+            return out;
+          }
 
         // otherwise add the property
         Property_array<T>* p = new Property_array<T>(name, t);
         p->reserve(capacity_);
         p->resize(size_);
-        parrays_.push_back(p);
+        insert(p);
         return std::make_pair(Pmap(p), true);
     }
 
 
     // get a property by its name. returns invalid property if it does not exist.
+    // The arrays are indexed by name, so that the cost does not depend on the number of properties.
     template <class T>
     std::pair<typename Get_pmap_type<T>::type, bool>
     get(const std::string& name) const
     {
         typedef typename Ref_class::template Get_property_map<Key, T>::type Pmap;
-        for (std::size_t i=0; i<parrays_.size(); ++i)
+        typename Index::const_iterator it = index_.find(name);
+        if (it != index_.end())
           {
-            std::pair<Pmap, bool> out = get<T>(name, i);
-            if (out.second)
-              return out;
+            for (Base_property_array* parray : it->second)
+              if (Property_array<T>* array = dynamic_cast<Property_array<T>*>(parray))
+                return std::make_pair(Pmap(array), true);
           }
         return std::make_pair(Pmap(), false);
     }
@@ -406,12 +522,13 @@ public:
 
 
     // get the type of property by its name. returns typeid(void) if it does not exist.
+    // If several properties have this name, returns the type of the first one added.
     const std::type_info&
     get_type(const std::string& name) const
     {
-        for (std::size_t i=0; i<parrays_.size(); ++i)
-            if (parrays_[i]->name() == name)
-                return parrays_[i]->type();
+        typename Index::const_iterator it = index_.find(name);
+        if (it != index_.end())
+            return it->second.front()->type();
         return typeid(void);
     }
 
@@ -421,18 +538,15 @@ public:
     bool
     remove(typename Get_pmap_type<T>::type& h)
     {
-        typename std::vector<Base_property_array*>::iterator it=parrays_.begin(), end=parrays_.end();
-        for (; it!=end; ++it)
-        {
-            if (*it == h.parray_)
-            {
-                delete *it;
-                parrays_.erase(it);
-                h.reset();
-                return true;
-            }
-        }
-        return false;
+        if (h.parray_ == nullptr || !erase_from_index(h.parray_))
+            return false;
+
+        typename std::vector<Base_property_array*>::iterator it = std::find(parrays_.begin(), parrays_.end(), h.parray_);
+        CGAL_assertion(it != parrays_.end());
+        delete *it;
+        parrays_.erase(it);
+        h.reset();
+        return true;
     }
 
 
@@ -442,6 +556,7 @@ public:
         for (std::size_t i=0; i<parrays_.size(); ++i)
             delete parrays_[i];
         parrays_.clear();
+        index_.clear();
         size_ = 0;
     }
 
@@ -468,7 +583,10 @@ public:
         if (parrays_.size()<=n)
           return;
         for (std::size_t i=n; i<parrays_.size(); ++i)
+        {
+            erase_from_index(parrays_[i]);
             delete parrays_[i];
+        }
         parrays_.resize(n);
     }
 
@@ -507,12 +625,48 @@ public:
     void swap (Property_container& other)
     {
       this->parrays_.swap (other.parrays_);
+      this->index_.swap (other.index_);
       std::swap(this->size_, other.size_);
       std::swap(this->capacity_, other.capacity_);
     }
 
 private:
+    // the arrays of a given name, in the order in which they were added
+    typedef std::unordered_map<std::string, std::vector<Base_property_array*> > Index;
+
+    // returns the array with the same name and type as `array`, if any
+    Base_property_array* find(const Base_property_array& array) const
+    {
+        typename Index::const_iterator it = index_.find(array.name());
+        if (it != index_.end())
+            for (Base_property_array* parray : it->second)
+                if (parray->type() == array.type())
+                    return parray;
+        return nullptr;
+    }
+
+    void insert(Base_property_array* array)
+    {
+        parrays_.push_back(array);
+        index_[array->name()].push_back(array);
+    }
+
+    bool erase_from_index(Base_property_array* array)
+    {
+        typename Index::iterator it = index_.find(array->name());
+        if (it == index_.end())
+            return false;
+        typename std::vector<Base_property_array*>::iterator pos = std::find(it->second.begin(), it->second.end(), array);
+        if (pos == it->second.end())
+            return false;
+        it->second.erase(pos);
+        if (it->second.empty())
+            index_.erase(it);
+        return true;
+    }
+
     std::vector<Base_property_array*>  parrays_;
+    Index  index_; // arrays by name (several arrays may have the same name and different types)
     size_t  size_ = 0;
     size_t  capacity_ = 0;
 };
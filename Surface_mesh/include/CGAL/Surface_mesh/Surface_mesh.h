@@ -28,9 +28,11 @@
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/circulator.h>
+#include <CGAL/for_each.h>
 #include <CGAL/Handle_hash_function.h>
 #include <CGAL/Iterator_range.h>
 #include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 
 #include <boost/cstdint.hpp>
 #include <boost/array.hpp>
@@ -41,8 +43,10 @@
 #include <functional>
 #include <iterator>
 #include <iostream>
+#include <limits>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <typeinfo>
 #include <utility>
 #include <vector>
@@ -935,6 +939,7 @@ public:
       , faces_freelist_(std::exchange(sm.faces_freelist_,(std::numeric_limits<size_type>::max)()))
       , garbage_(std::exchange(sm.garbage_, false))
       , recycle_(std::exchange(sm.recycle_, true))
+      , preserve_order_(std::exchange(sm.preserve_order_, false))
       , anonymous_property_(std::exchange(sm.anonymous_property_, 0))
     {}
 
@@ -963,6 +968,7 @@ public:
       faces_freelist_ = std::exchange(sm.faces_freelist_,(std::numeric_limits<size_type>::max)());
       garbage_ = std::exchange(sm.garbage_, false);
       recycle_ = std::exchange(sm.recycle_, true);
+      preserve_order_ = std::exchange(sm.preserve_order_, false);
       anonymous_property_ = std::exchange(sm.anonymous_property_, 0);
       return *this;
     }
@@ -1393,19 +1399,73 @@ public:
     /// refering to the right elements.
     void collect_garbage();
 
+    /// really removes vertices, halfedges, edges, and faces which are marked removed.
+    ///
+    /// The new indices of the elements are computed once, then the elements of all property maps
+    /// are moved in place and the connectivity is updated, in parallel if `ConcurrencyTag` is `CGAL::Parallel_tag`.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+    ///                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    ///
+    /// \sa `collect_garbage()`
+    template <typename ConcurrencyTag>
+    void collect_garbage();
+
     //undocumented convenience function that allows to get old-index->new-index information
     template <typename Visitor>
     void collect_garbage(Visitor& visitor);
 
+    template <typename ConcurrencyTag, typename Visitor>
+    void collect_garbage(Visitor& visitor);
+
     /// controls the recycling or not of simplices previously marked as removed
     /// upon addition of new elements.
     /// When set to `true` (default value), new elements are first picked in the garbage (if any)
     /// while if set to `false` only new elements are created.
+    /// The most recently removed elements are picked first: as they were removed by the last modifications
+    /// of the mesh, their property values are likely to be still in the cache, and their neighbors in the
+    /// mesh are likely to have close indices.
     void set_recycle_garbage(bool b);
 
     /// Getter
     bool does_recycle_garbage() const;
 
+    /// controls the order of the elements after garbage collection.
+    /// When set to `false` (default value), the last elements are moved to the places of the removed elements,
+    /// which moves as few elements as possible.
+    /// When set to `true`, the elements keep their relative order, so that an ordering for which elements that
+    /// are close in the mesh have close indices is preserved, at the price of moving all the elements
+    /// that follow the first removed element.
+    /// \sa `collect_garbage()`
+    void set_garbage_collection_preserves_order(bool b);
+
+    /// Getter
+    bool does_garbage_collection_preserve_order() const;
+
+    /// permutes the vertices, halfedges, edges, and faces of the mesh, together with all their property maps:
+    /// the vertex `vertex_order[i]` gets the index `i`, and similarly for edges and faces.
+    /// The two halfedges of the edge with index `i` get the indices `2i` and `2i+1`, in the same order as before.
+    ///
+    /// \pre `has_garbage()` is `false`.
+    /// \pre `vertex_order`, `edge_order`, and `face_order` are permutations of the vertices, edges, and faces of the mesh.
+    ///
+    /// \attention By reordering, elements get new indices, as with `collect_garbage()`.
+    ///
+    /// \sa `reorder_for_locality()`
+    void reorder(const std::vector<Vertex_index>& vertex_order,
+                 const std::vector<Edge_index>& edge_order,
+                 const std::vector<Face_index>& face_order);
+
+    /// same as above, with the property maps permuted and the connectivity updated
+    /// in parallel if `ConcurrencyTag` is `CGAL::Parallel_tag`.
+    ///
+    /// \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+    ///                        Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+    template <typename ConcurrencyTag>
+    void reorder(const std::vector<Vertex_index>& vertex_order,
+                 const std::vector<Edge_index>& edge_order,
+                 const std::vector<Face_index>& face_order);
+
     /// @cond CGAL_DOCUMENT_INTERNALS
     /// removes unused memory from vectors. This shrinks the storage
     /// of all properties to the minimal required size.
@@ -2012,6 +2072,9 @@ private: //--------------------------------------------------- property handling
  A `Properties::Property_map<I,T>` allows to associate properties of type `T` to a vertex, halfdge, edge, or face index type I.
  Properties can be added, and looked up with a string, and they can be removed at runtime.
  The \em point property of type `P` is associated to the string "v:point".
+ Looking up a property with a string takes constant time on average, whatever the number of properties.
+ A property map is a handle which remains valid until the property is removed, even if other
+ properties are added or removed, and it can thus be looked up once and kept, for example outside of a loop.
 
     */
     ///@{
@@ -2173,6 +2236,13 @@ private: //--------------------------------------------------- property handling
 
 private: //--------------------------------------------------- helper functions
 
+    /// computes the new indices of the elements which are not removed, and the moves
+    /// (destination, source) which compact the property arrays. Returns the new number of elements.
+    template <typename Index>
+    size_type garbage_collection_moves(const Property_map<Index, bool>& removed, size_type n,
+                                       std::vector<size_type>& new_indices,
+                                       std::vector<std::pair<std::size_t, std::size_t> >& moves) const;
+
 
     /// make sure that the incoming halfedge of vertex v is a border halfedge
     /// if `v` is a border vertex.
@@ -2203,8 +2273,11 @@ private: //------------------------------------------------------- private data
     size_type faces_freelist_;
     bool garbage_;
     bool recycle_;
+    bool preserve_order_;
 
     size_type anonymous_property_;
+
+    friend class IO::internal::Surface_mesh_snapshot<P>;
 };
 
   /*! \addtogroup PkgSurface_mesh
@@ -2269,6 +2342,7 @@ Surface_mesh()
     vertices_freelist_ = edges_freelist_ = faces_freelist_ = (std::numeric_limits<size_type>::max)();
     garbage_ = false;
     recycle_ = true;
+    preserve_order_ = false;
     anonymous_property_ = 0;
 }
 
@@ -2305,6 +2379,7 @@ operator=(const Surface_mesh<P>& rhs)
         faces_freelist_    = rhs.faces_freelist_;
         garbage_           = rhs.garbage_;
         recycle_           = rhs.recycle_;
+        preserve_order_    = rhs.preserve_order_;
         anonymous_property_ = rhs.anonymous_property_;
     }
 
@@ -2359,6 +2434,7 @@ assign(const Surface_mesh<P>& rhs)
         faces_freelist_    = rhs.faces_freelist_;
         garbage_           = rhs.garbage_;
         recycle_           = rhs.recycle_;
+        preserve_order_    = rhs.preserve_order_;
         anonymous_property_ = rhs.anonymous_property_;
     }
 
@@ -2394,6 +2470,7 @@ clear_without_removing_property_maps()
   vertices_freelist_ = edges_freelist_ = faces_freelist_ = (std::numeric_limits<size_type>::max)();
   garbage_ = false;
   recycle_ = true;
+  preserve_order_ = false;
   anonymous_property_ = 0;
 }
 
@@ -2541,184 +2618,350 @@ degree(Face_index f) const
     return count;
 }
 
-template <typename P> template< typename Visitor>
-void
+namespace collect_garbage_internal {
+struct Dummy_visitor{
+  template<typename A, typename B, typename C>
+  void operator()(const A&, const B&, const C&)
+  {}
+};
+
+}
+
+template <typename P>
+template <typename Index>
+typename Surface_mesh<P>::size_type
 Surface_mesh<P>::
-collect_garbage(Visitor &visitor)
+garbage_collection_moves(const Property_map<Index, bool>& removed, size_type n,
+                         std::vector<size_type>& new_indices,
+                         std::vector<std::pair<std::size_t, std::size_t> >& moves) const
 {
-    if (!has_garbage())
+    // removed elements have no new index
+    new_indices.assign(n, (std::numeric_limits<size_type>::max)());
+
+    if (preserve_order_)
     {
-      return;
+        size_type next = 0;
+        for (size_type i=0; i<n; ++i)
+        {
+            if (removed[Index(i)])
+                continue;
+            if (next != i)
+                moves.emplace_back(next, i);
+            new_indices[i] = next++;
+        }
+        return next;
     }
 
-    int  i, i0, i1,
-    nV(num_vertices()),
-    nE(num_edges()),
-    nH(num_halfedges()),
-    nF(num_faces());
-
-    Vertex_index    v;
-    Halfedge_index  h;
-    Face_index      f;
-
-
-    // setup index mapping%
-    Property_map<Vertex_index, Vertex_index>      vmap = add_property_map<Vertex_index, Vertex_index>("v:garbage-collection").first;
-    Property_map<Halfedge_index, Halfedge_index>  hmap = add_property_map<Halfedge_index, Halfedge_index>("h:garbage-collection").first;
-    Property_map<Face_index, Face_index>          fmap = add_property_map<Face_index, Face_index>("f:garbage-collection").first;
-    for (i=0; i<nV; ++i)
-        vmap[Vertex_index(i)] = Vertex_index(i);
-    for (i=0; i<nH; ++i)
-        hmap[Halfedge_index(i)] = Halfedge_index(i);
-    for (i=0; i<nF; ++i)
-        fmap[Face_index(i)] = Face_index(i);
-
+    // fill the first removed places with the last elements
+    size_type i0 = 0, i1 = n;
+    for (;;)
+    {
+        for (; i0 < i1 && !removed[Index(i0)]; ++i0)
+            new_indices[i0] = i0;
+        while (i0 < i1 && removed[Index(i1-1)])
+            --i1;
+        if (i0 >= i1)
+            break;
 
+        --i1;
+        moves.emplace_back(i0, i1);
+        new_indices[i1] = i0;
+        ++i0;
+    }
+    return i0;
+}
 
-    // really remove vertices
-    if (nV > 0)
+template <typename P> template <typename ConcurrencyTag, typename Visitor>
+void
+Surface_mesh<P>::
+collect_garbage(Visitor &visitor)
+{
+    if (!has_garbage())
     {
-        i0=0;  i1=nV-1;
-
-        while (1)
-        {
-            // find first removed and last un-removed
-            while (!vremoved_[Vertex_index(i0)] && i0 < i1)  ++i0;
-            while ( vremoved_[Vertex_index(i1)] && i0 < i1)  --i1;
-            if (i0 >= i1) break;
+      return;
+    }
 
-            // swap
-            vprops_.swap(i0, i1);
-        };
+    typedef std::vector<std::pair<std::size_t, std::size_t> > Moves;
+
+    const size_type nV(num_vertices()), nE(num_edges()), nH(num_halfedges()), nF(num_faces());
+
+    // compute the new indices, and the moves which compact the property arrays
+    std::vector<size_type> vindices, eindices, findices;
+    Moves vmoves, emoves, hmoves, fmoves;
+    const size_type new_nV = garbage_collection_moves(vremoved_, nV, vindices, vmoves);
+    const size_type new_nE = garbage_collection_moves(eremoved_, nE, eindices, emoves);
+    const size_type new_nF = garbage_collection_moves(fremoved_, nF, findices, fmoves);
+    const size_type new_nH = 2 * new_nE;
+
+    hmoves.reserve(2 * emoves.size());
+    for (const std::pair<std::size_t, std::size_t>& m : emoves)
+    {
+        hmoves.emplace_back(2*m.first, 2*m.second);
+        hmoves.emplace_back(2*m.first+1, 2*m.second+1);
+    }
+
+    // move the elements of all property arrays concurrently, and then shrink them;
+    // the moves within an array are independent if the order of the elements is not preserved
+    std::vector<std::pair<Properties::Base_property_array*, std::pair<const Moves*, size_type> > > arrays;
+    for (std::size_t i=0; i<vprops_.n_properties(); ++i)
+        arrays.emplace_back(&vprops_.property_array(i), std::make_pair(&vmoves, new_nV));
+    for (std::size_t i=0; i<hprops_.n_properties(); ++i)
+        arrays.emplace_back(&hprops_.property_array(i), std::make_pair(&hmoves, new_nH));
+    for (std::size_t i=0; i<eprops_.n_properties(); ++i)
+        arrays.emplace_back(&eprops_.property_array(i), std::make_pair(&emoves, new_nE));
+    for (std::size_t i=0; i<fprops_.n_properties(); ++i)
+        arrays.emplace_back(&fprops_.property_array(i), std::make_pair(&fmoves, new_nF));
+
+    const bool parallel_moves = !preserve_order_ &&
+                                std::is_convertible<ConcurrencyTag, Parallel_tag>::value;
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t>(0, arrays.size()),
+       [&](const std::size_t i) -> bool
+       {
+         Properties::Base_property_array* array = arrays[i].first;
+         array->move(*(arrays[i].second.first), parallel_moves);
+         array->resize(arrays[i].second.second);
+         array->shrink_to_fit();
+         return true;
+       });
+
+    vprops_.resize(new_nV); vprops_.shrink_to_fit();
+    hprops_.resize(new_nH); hprops_.shrink_to_fit();
+    eprops_.resize(new_nE); eprops_.shrink_to_fit();
+    fprops_.resize(new_nF); fprops_.shrink_to_fit();
+
+    // update the connectivity
+    auto new_halfedge = [&](const Halfedge_index h) -> Halfedge_index
+    {
+      return Halfedge_index(2 * eindices[size_type(h) >> 1] + (size_type(h) & 1));
+    };
 
-        // remember new size
-        nV = vremoved_[Vertex_index(i0)] ? i0 : i0+1;
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t>(0, new_nV),
+       [&](const std::size_t i) -> bool
+       {
+         Vertex_connectivity& c = vconn_[Vertex_index(size_type(i))];
+         if (c.halfedge_.is_valid()) // not isolated
+           c.halfedge_ = new_halfedge(c.halfedge_);
+         return true;
+       });
+
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t>(0, new_nH),
+       [&](const std::size_t i) -> bool
+       {
+         Halfedge_connectivity& c = hconn_[Halfedge_index(size_type(i))];
+         c.vertex_ = Vertex_index(vindices[size_type(c.vertex_)]);
+         c.next_halfedge_ = new_halfedge(c.next_halfedge_);
+         if (c.prev_halfedge_.is_valid())
+           c.prev_halfedge_ = new_halfedge(c.prev_halfedge_);
+         if (c.face_.is_valid()) // not border
+           c.face_ = Face_index(findices[size_type(c.face_)]);
+         return true;
+       });
+
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t>(0, new_nF),
+       [&](const std::size_t i) -> bool
+       {
+         Face_connectivity& c = fconn_[Face_index(size_type(i))];
+         c.halfedge_ = new_halfedge(c.halfedge_);
+         return true;
+       });
+
+    // give the old-index->new-index maps to the visitor
+    if (!std::is_same<Visitor, collect_garbage_internal::Dummy_visitor>::value)
+    {
+      // these temporary arrays have the sizes before garbage collection
+      Properties::Property_container<Self, Vertex_index> vcontainer;
+      Properties::Property_container<Self, Halfedge_index> hcontainer;
+      Properties::Property_container<Self, Face_index> fcontainer;
+      vcontainer.resize(nV);
+      hcontainer.resize(nH);
+      fcontainer.resize(nF);
+      Property_map<Vertex_index, Vertex_index>      vmap = vcontainer.template add<Vertex_index>("v:garbage-collection").first;
+      Property_map<Halfedge_index, Halfedge_index>  hmap = hcontainer.template add<Halfedge_index>("h:garbage-collection").first;
+      Property_map<Face_index, Face_index>          fmap = fcontainer.template add<Face_index>("f:garbage-collection").first;
+      for (size_type i=0; i<nV; ++i)
+          vmap[Vertex_index(i)] = Vertex_index(vindices[i]);
+      for (size_type i=0; i<nH; ++i)
+          hmap[Halfedge_index(i)] = eindices[i >> 1] == (std::numeric_limits<size_type>::max)()
+                                  ? Halfedge_index() : new_halfedge(Halfedge_index(i));
+      for (size_type i=0; i<nF; ++i)
+          fmap[Face_index(i)] = Face_index(findices[i]);
+
+      visitor(vmap, hmap, fmap);
     }
 
-    // really remove edges
-    if (nE > 0)
-    {
-        i0=0;  i1=nE-1;
+    removed_vertices_ = removed_edges_ = removed_faces_ = 0;
+    vertices_freelist_ = edges_freelist_ = faces_freelist_ = -1;
+    garbage_ = false;
+}
 
-        while (1)
-        {
-            // find first removed and last un-removed
-            while (!eremoved_[Edge_index(i0)] && i0 < i1) ++i0;
-            while ( eremoved_[Edge_index(i1)] && i0 < i1) --i1;
-            if (i0 >= i1) break;
+template <typename P> template< typename Visitor>
+void
+Surface_mesh<P>::
+collect_garbage(Visitor &visitor)
+{
+  collect_garbage<Sequential_tag>(visitor);
+}
 
-            // swap
-            eprops_.swap(i0, i1);
-            hprops_.swap(2*i0,   2*i1);
-            hprops_.swap(2*i0+1, 2*i1+1);
-        };
+template <typename P> template <typename ConcurrencyTag>
+void
+Surface_mesh<P>::
+collect_garbage()
+{
+  collect_garbage_internal::Dummy_visitor visitor;
+  collect_garbage<ConcurrencyTag>(visitor);
+}
 
-        // remember new size
-        nE = eremoved_[Edge_index(i0)] ? i0 : i0+1;
-        nH = 2*nE;
-    }
+template <typename P>
+void
+Surface_mesh<P>::
+collect_garbage()
+{
+  collect_garbage<Sequential_tag>();
+}
 
 
-    // really remove faces
-    if (nF > 0)
-    {
-        i0=0;  i1=nF-1;
+template <typename P>
+void
+Surface_mesh<P>::
+set_recycle_garbage(bool b)
+{
+  recycle_ = b;
+}
 
-        while (1)
-        {
-            // find 1st removed and last un-removed
-            while (!fremoved_[Face_index(i0)] && i0 < i1)  ++i0;
-            while ( fremoved_[Face_index(i1)] && i0 < i1)  --i1;
-            if (i0 >= i1) break;
 
-            // swap
-            fprops_.swap(i0, i1);
-        };
+template <typename P>
+bool
+Surface_mesh<P>::
+does_recycle_garbage() const
+{
+  return recycle_;
+}
 
-        // remember new size
-        nF = fremoved_[Face_index(i0)] ? i0 : i0+1;
-    }
 
+template <typename P> template <typename ConcurrencyTag>
+void
+Surface_mesh<P>::
+reorder(const std::vector<Vertex_index>& vertex_order,
+        const std::vector<Edge_index>& edge_order,
+        const std::vector<Face_index>& face_order)
+{
+    CGAL_precondition(!has_garbage());
+    CGAL_precondition(vertex_order.size() == num_vertices());
+    CGAL_precondition(edge_order.size() == num_edges());
+    CGAL_precondition(face_order.size() == num_faces());
+
+    const size_type nV(num_vertices()), nE(num_edges()), nH(num_halfedges()), nF(num_faces());
 
-    // update vertex connectivity
-    for (i=0; i<nV; ++i)
+    // the old index of each new index, and the new index of each old index
+    std::vector<std::size_t> vorder(nV), eorder(nE), horder(nH), forder(nF);
+    std::vector<size_type> vindices(nV), eindices(nE), findices(nF);
+    for (size_type i=0; i<nV; ++i)
     {
-        v = Vertex_index(i);
-        if (!is_isolated(v))
-            set_halfedge(v, hmap[halfedge(v)]);
+        vorder[i] = vertex_order[i];
+        vindices[vertex_order[i]] = i;
     }
-
-
-    // update halfedge connectivity
-    for (i=0; i<nH; ++i)
+    for (size_type i=0; i<nE; ++i)
     {
-        h = Halfedge_index(i);
-        set_target(h, vmap[target(h)]);
-        set_next(h, hmap[next(h)]);
-        if (!is_border(h))
-            set_face(h, fmap[face(h)]);
+        eorder[i] = edge_order[i];
+        eindices[edge_order[i]] = i;
+        horder[2*i] = 2*eorder[i];
+        horder[2*i+1] = 2*eorder[i]+1;
     }
-
-
-    // update indices of faces
-    for (i=0; i<nF; ++i)
+    for (size_type i=0; i<nF; ++i)
     {
-        f = Face_index(i);
-        set_halfedge(f, hmap[halfedge(f)]);
+        forder[i] = face_order[i];
+        findices[face_order[i]] = i;
     }
 
-    //apply visitor before invalidating the maps
-    visitor(vmap, hmap, fmap);
-    // remove index maps
-    remove_property_map<Vertex_index>(vmap);
-    remove_property_map<Halfedge_index>(hmap);
-    remove_property_map<Face_index>(fmap);
+    // permute the elements of all property arrays concurrently
+    std::vector<std::pair<Properties::Base_property_array*, const std::vector<std::size_t>*> > arrays;
+    for (std::size_t i=0; i<vprops_.n_properties(); ++i)
+        arrays.emplace_back(&vprops_.property_array(i), &vorder);
+    for (std::size_t i=0; i<hprops_.n_properties(); ++i)
+        arrays.emplace_back(&hprops_.property_array(i), &horder);
+    for (std::size_t i=0; i<eprops_.n_properties(); ++i)
+        arrays.emplace_back(&eprops_.property_array(i), &eorder);
+    for (std::size_t i=0; i<fprops_.n_properties(); ++i)
+        arrays.emplace_back(&fprops_.property_array(i), &forder);
 
-    // finally resize arrays
-    vprops_.resize(nV); vprops_.shrink_to_fit();
-    hprops_.resize(nH); hprops_.shrink_to_fit();
-    eprops_.resize(nE); eprops_.shrink_to_fit();
-    fprops_.resize(nF); fprops_.shrink_to_fit();
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t>(0, arrays.size()),
+       [&](const std::size_t i) -> bool
+       {
+         arrays[i].first->permute(*(arrays[i].second));
+         return true;
+       });
 
-    removed_vertices_ = removed_edges_ = removed_faces_ = 0;
-    vertices_freelist_ = edges_freelist_ = faces_freelist_ = -1;
-    garbage_ = false;
-}
-
-namespace collect_garbage_internal {
-struct Dummy_visitor{
-  template<typename A, typename B, typename C>
-  void operator()(const A&, const B&, const C&)
-  {}
-};
+    // update the connectivity
+    auto new_halfedge = [&](const Halfedge_index h) -> Halfedge_index
+    {
+      return Halfedge_index(2 * eindices[size_type(h) >> 1] + (size_type(h) & 1));
+    };
 
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t>(0, nV),
+       [&](const std::size_t i) -> bool
+       {
+         Vertex_connectivity& c = vconn_[Vertex_index(size_type(i))];
+         if (c.halfedge_.is_valid()) // not isolated
+           c.halfedge_ = new_halfedge(c.halfedge_);
+         return true;
+       });
+
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t>(0, nH),
+       [&](const std::size_t i) -> bool
+       {
+         Halfedge_connectivity& c = hconn_[Halfedge_index(size_type(i))];
+         c.vertex_ = Vertex_index(vindices[size_type(c.vertex_)]);
+         c.next_halfedge_ = new_halfedge(c.next_halfedge_);
+         if (c.prev_halfedge_.is_valid())
+           c.prev_halfedge_ = new_halfedge(c.prev_halfedge_);
+         if (c.face_.is_valid()) // not border
+           c.face_ = Face_index(findices[size_type(c.face_)]);
+         return true;
+       });
+
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t>(0, nF),
+       [&](const std::size_t i) -> bool
+       {
+         Face_connectivity& c = fconn_[Face_index(size_type(i))];
+         c.halfedge_ = new_halfedge(c.halfedge_);
+         return true;
+       });
 }
 
 template <typename P>
 void
 Surface_mesh<P>::
-collect_garbage()
+reorder(const std::vector<Vertex_index>& vertex_order,
+        const std::vector<Edge_index>& edge_order,
+        const std::vector<Face_index>& face_order)
 {
-  collect_garbage_internal::Dummy_visitor visitor;
-  collect_garbage(visitor);
+  reorder<Sequential_tag>(vertex_order, edge_order, face_order);
 }
 
 
 template <typename P>
 void
 Surface_mesh<P>::
-set_recycle_garbage(bool b)
+set_garbage_collection_preserves_order(bool b)
 {
-  recycle_ = b;
+  preserve_order_ = b;
 }
 
 
 template <typename P>
 bool
 Surface_mesh<P>::
-does_recycle_garbage() const
+does_garbage_collection_preserve_order() const
 {
-  return recycle_;
+  return preserve_order_;
 }
 
 
@@ -0,0 +1,194 @@
+// Copyright (c) 2026  agent <agent@local>.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : agent <agent@local>
+
+#ifndef CGAL_SURFACE_MESH_REORDER_FOR_LOCALITY_H
+#define CGAL_SURFACE_MESH_REORDER_FOR_LOCALITY_H
+
+#include <CGAL/license/Surface_mesh.h>
+
+#include <CGAL/Surface_mesh/Surface_mesh.h>
+
+#include <CGAL/boost/graph/iterator.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/hilbert_sort.h>
+#include <CGAL/Spatial_sort_traits_adapter_3.h>
+#include <CGAL/tags.h>
+
+#include <queue>
+#include <vector>
+
+namespace CGAL {
+
+namespace Surface_mesh_internal {
+
+// orders the vertices of `sm` in breadth-first order, starting from the first vertex
+// of each connected component
+template <typename P>
+void breadth_first_order(const Surface_mesh<P>& sm,
+                         std::vector<typename Surface_mesh<P>::Vertex_index>& vertices)
+{
+  typedef typename Surface_mesh<P>::Vertex_index Vertex_index;
+
+  std::vector<bool> visited(sm.num_vertices(), false);
+  std::queue<Vertex_index> queue;
+  vertices.clear();
+  vertices.reserve(sm.number_of_vertices());
+
+  for(Vertex_index v : sm.vertices())
+  {
+    if(visited[v])
+      continue;
+    visited[v] = true;
+    queue.push(v);
+    while(!queue.empty())
+    {
+      const Vertex_index w = queue.front();
+      queue.pop();
+      vertices.push_back(w);
+      if(sm.is_isolated(w))
+        continue;
+      for(Vertex_index n : vertices_around_target(sm.halfedge(w), sm))
+      {
+        if(!visited[n])
+        {
+          visited[n] = true;
+          queue.push(n);
+        }
+      }
+    }
+  }
+}
+
+} // namespace Surface_mesh_internal
+
+/// \ingroup PkgSurfaceMeshReordering
+///
+/// permutes the vertices, halfedges, edges, and faces of `sm`, together with all their property maps,
+/// so that elements which are close in the mesh have close indices.
+/// Traversals of the mesh then access memory in a more coherent order, which makes them faster
+/// when the initial order of the elements is arbitrary, for example for scanned data.
+///
+/// The vertices are sorted along a Hilbert curve (see `CGAL::hilbert_sort()`), or in breadth-first order.
+/// The faces and the edges are then ordered as they are first met when going around the vertices
+/// in their new order.
+///
+/// If `sm` has garbage, `collect_garbage()` is called first.
+///
+/// \tparam P the point type of the surface mesh
+/// \tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+///
+/// \param sm the surface mesh to be reordered
+/// \param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+///
+/// \cgalNamedParamsBegin
+///   \cgalParamNBegin{use_breadth_first_order}
+///     \cgalParamDescription{if `true`, the vertices are sorted in breadth-first order instead of along a Hilbert curve}
+///     \cgalParamType{Boolean}
+///     \cgalParamDefault{`false`}
+///   \cgalParamNEnd
+///
+///   \cgalParamNBegin{concurrency_tag}
+///     \cgalParamDescription{a tag indicating if the Hilbert sort, the permutation of the property maps,
+///                           and the update of the connectivity should be done in parallel}
+///     \cgalParamType{`CGAL::Sequential_tag`, `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+///     \cgalParamDefault{`CGAL::Sequential_tag`}
+///   \cgalParamNEnd
+///
+///   \cgalParamNBegin{vertex_point_map}
+///     \cgalParamDescription{a property map associating points to the vertices of `sm`}
+///     \cgalParamType{a class model of `ReadablePropertyMap` with `Surface_mesh::Vertex_index`
+///                    as key type and `%Point_3` as value type}
+///     \cgalParamDefault{`boost::get(CGAL::vertex_point, sm)`}
+///   \cgalParamNEnd
+///
+///   \cgalParamNBegin{geom_traits}
+///     \cgalParamDescription{an instance of a geometric traits class}
+///     \cgalParamType{a class model of `SpatialSortingTraits_3`}
+///     \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+///   \cgalParamNEnd
+/// \cgalNamedParamsEnd
+///
+/// \attention By reordering, elements get new indices.
+///
+/// \sa `Surface_mesh::reorder()`
+template <typename P, typename NamedParameters = parameters::Default_named_parameters>
+void reorder_for_locality(Surface_mesh<P>& sm,
+                          const NamedParameters& np = parameters::default_values())
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef Surface_mesh<P>                                              Mesh;
+  typedef typename Mesh::Vertex_index                                  Vertex_index;
+  typedef typename Mesh::Halfedge_index                                Halfedge_index;
+  typedef typename Mesh::Edge_index                                    Edge_index;
+  typedef typename Mesh::Face_index                                    Face_index;
+
+  typedef typename GetGeomTraits<Mesh, NamedParameters>::type          Geom_traits;
+  typedef typename GetVertexPointMap<Mesh, NamedParameters>::const_type VPM;
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t, NamedParameters, Sequential_tag> ::type  Concurrency_tag;
+
+  const bool use_bfs = choose_parameter(get_parameter(np, internal_np::use_breadth_first_order), false);
+  const Geom_traits gt = choose_parameter<Geom_traits>(get_parameter(np, internal_np::geom_traits));
+  const VPM vpm = choose_parameter(get_parameter(np, internal_np::vertex_point),
+                                   get_const_property_map(vertex_point, sm));
+
+  if(sm.has_garbage())
+    sm.template collect_garbage<Concurrency_tag>();
+
+  std::vector<Vertex_index> vertex_order;
+  if(use_bfs)
+  {
+    Surface_mesh_internal::breadth_first_order(sm, vertex_order);
+  }
+  else
+  {
+    vertex_order.assign(sm.vertices().begin(), sm.vertices().end());
+    hilbert_sort<Concurrency_tag>(vertex_order.begin(), vertex_order.end(),
+                                  Spatial_sort_traits_adapter_3<Geom_traits, VPM>(vpm, gt));
+  }
+
+  // faces and edges come in the order in which they are met around the sorted vertices
+  std::vector<Edge_index> edge_order;
+  std::vector<Face_index> face_order;
+  edge_order.reserve(sm.number_of_edges());
+  face_order.reserve(sm.number_of_faces());
+  std::vector<bool> edge_met(sm.num_edges(), false), face_met(sm.num_faces(), false);
+  for(Vertex_index v : vertex_order)
+  {
+    if(sm.is_isolated(v))
+      continue;
+    for(Halfedge_index h : halfedges_around_target(sm.halfedge(v), sm))
+    {
+      const Edge_index e = sm.edge(h);
+      if(!edge_met[e])
+      {
+        edge_met[e] = true;
+        edge_order.push_back(e);
+      }
+      const Face_index f = sm.face(h);
+      if(f != sm.null_face() && !face_met[f])
+      {
+        face_met[f] = true;
+        face_order.push_back(f);
+      }
+    }
+  }
+
+  sm.template reorder<Concurrency_tag>(vertex_order, edge_order, face_order);
+}
+
+} // namespace CGAL
+
+#endif // CGAL_SURFACE_MESH_REORDER_FOR_LOCALITY_H
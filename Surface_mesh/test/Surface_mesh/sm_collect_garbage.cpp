@@ -0,0 +1,166 @@
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Simple_cartesian.h>
+
+#include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/tags.h>
+
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Simple_cartesian<double> K;
+typedef K::Point_3 Point_3;
+typedef CGAL::Surface_mesh<Point_3> Sm;
+typedef Sm::Vertex_index Vertex_index;
+typedef Sm::Halfedge_index Halfedge_index;
+typedef Sm::Edge_index Edge_index;
+typedef Sm::Face_index Face_index;
+
+struct Index_maps_visitor
+{
+  std::vector<Vertex_index>& vmap;
+  std::vector<Halfedge_index>& hmap;
+  std::vector<Face_index>& fmap;
+
+  template <typename VMap, typename HMap, typename FMap>
+  void operator()(const VMap& v, const HMap& h, const FMap& f)
+  {
+    for(std::size_t i=0; i<vmap.size(); ++i)
+      vmap[i] = v[Vertex_index(Sm::size_type(i))];
+    for(std::size_t i=0; i<hmap.size(); ++i)
+      hmap[i] = h[Halfedge_index(Sm::size_type(i))];
+    for(std::size_t i=0; i<fmap.size(); ++i)
+      fmap[i] = f[Face_index(Sm::size_type(i))];
+  }
+};
+
+// removes some faces and vertices, and records the old indices of the elements
+void make_garbage(Sm& m)
+{
+  Sm::Property_map<Vertex_index, std::size_t> vid = m.add_property_map<Vertex_index, std::size_t>("v:id").first;
+  Sm::Property_map<Halfedge_index, std::size_t> hid = m.add_property_map<Halfedge_index, std::size_t>("h:id").first;
+  Sm::Property_map<Face_index, std::size_t> fid = m.add_property_map<Face_index, std::size_t>("f:id").first;
+  Sm::Property_map<Edge_index, bool> eodd = m.add_property_map<Edge_index, bool>("e:odd").first;
+  for(Vertex_index v : m.vertices())
+    vid[v] = v;
+  for(Halfedge_index h : m.halfedges())
+    hid[h] = h;
+  for(Face_index f : m.faces())
+    fid[f] = f;
+  for(Edge_index e : m.edges())
+    eodd[e] = (e % 2 == 1);
+
+  for(std::size_t i=0; i<m.num_faces(); i+=7)
+    if(!m.is_removed(Face_index(Sm::size_type(i))))
+      CGAL::Euler::remove_face(m.halfedge(Face_index(Sm::size_type(i))), m);
+  for(Vertex_index v : m.vertices())
+    if(m.is_isolated(v))
+      m.remove_vertex(v);
+  Vertex_index v = m.add_vertex(Point_3(1, 2, 3)); // isolated, recycled vertex
+  vid[v] = v;
+  assert(m.has_garbage());
+}
+
+void check(const Sm& before, const Sm& after, bool preserved_order,
+           const std::vector<Vertex_index>& vmap,
+           const std::vector<Halfedge_index>& hmap,
+           const std::vector<Face_index>& fmap)
+{
+  assert(after.is_valid(false));
+  assert(!after.has_garbage());
+  assert(after.num_vertices() == before.number_of_vertices());
+  assert(after.num_halfedges() == before.number_of_halfedges());
+  assert(after.num_faces() == before.number_of_faces());
+
+  Sm::Property_map<Vertex_index, std::size_t> vid = after.property_map<Vertex_index, std::size_t>("v:id").first;
+  Sm::Property_map<Halfedge_index, std::size_t> hid = after.property_map<Halfedge_index, std::size_t>("h:id").first;
+  Sm::Property_map<Face_index, std::size_t> fid = after.property_map<Face_index, std::size_t>("f:id").first;
+  Sm::Property_map<Edge_index, bool> eodd = after.property_map<Edge_index, bool>("e:odd").first;
+
+  // the elements which are not removed and their properties are kept, with the same connectivity
+  for(Vertex_index v : after.vertices())
+  {
+    const Vertex_index old(Sm::size_type(vid[v]));
+    assert(!before.is_removed(old));
+    assert(after.point(v) == before.point(old));
+    assert(vmap[old] == v);
+    if(preserved_order && v != Vertex_index(0))
+      assert(vid[Vertex_index(v - 1)] < vid[v]);
+    if(!after.is_isolated(v))
+      assert(hid[after.halfedge(v)] == std::size_t(before.halfedge(old)));
+  }
+  for(Halfedge_index h : after.halfedges())
+  {
+    const Halfedge_index old(Sm::size_type(hid[h]));
+    assert(hmap[old] == h);
+    assert(hid[after.next(h)] == std::size_t(before.next(old)));
+    assert(hid[after.prev(h)] == std::size_t(before.prev(old)));
+    assert(vid[after.target(h)] == std::size_t(before.target(old)));
+    assert(after.is_border(h) == before.is_border(old));
+    if(!after.is_border(h))
+      assert(fid[after.face(h)] == std::size_t(before.face(old)));
+    assert(eodd[after.edge(h)] == (before.edge(old) % 2 == 1));
+  }
+  for(Face_index f : after.faces())
+  {
+    const Face_index old(Sm::size_type(fid[f]));
+    assert(fmap[old] == f);
+    assert(hid[after.halfedge(f)] == std::size_t(before.halfedge(old)));
+  }
+}
+
+template <typename ConcurrencyTag>
+void test(const Sm& m, bool preserve_order)
+{
+  Sm after = m;
+  after.set_garbage_collection_preserves_order(preserve_order);
+  assert(after.does_garbage_collection_preserve_order() == preserve_order);
+
+  std::vector<Vertex_index> vmap(m.num_vertices());
+  std::vector<Halfedge_index> hmap(m.num_halfedges());
+  std::vector<Face_index> fmap(m.num_faces());
+  Index_maps_visitor visitor{vmap, hmap, fmap};
+  after.collect_garbage<ConcurrencyTag>(visitor);
+
+  check(m, after, preserve_order, vmap, hmap, fmap);
+
+  // the elements are moved at the places of the removed elements, so
+  // that the first elements which are not removed keep their index
+  if(!preserve_order)
+    for(Vertex_index v : m.vertices())
+      if(Sm::size_type(v) < after.num_vertices())
+        assert(vmap[v] == v);
+
+  Sm other = m;
+  other.set_garbage_collection_preserves_order(preserve_order);
+  other.collect_garbage<ConcurrencyTag>();
+  assert(other.num_halfedges() == after.num_halfedges());
+  for(Halfedge_index h : other.halfedges())
+    assert(other.next(h) == after.next(h) && other.target(h) == after.target(h));
+}
+
+int main()
+{
+  Sm m;
+  std::ifstream in(CGAL::data_file_path("meshes/elephant.off"));
+  assert(CGAL::IO::read_OFF(in, m));
+  make_garbage(m);
+
+  test<CGAL::Sequential_tag>(m, false);
+  test<CGAL::Sequential_tag>(m, true);
+  test<CGAL::Parallel_if_available_tag>(m, false);
+  test<CGAL::Parallel_if_available_tag>(m, true);
+
+  // the default garbage collection is unchanged
+  Sm after = m;
+  std::vector<Vertex_index> vmap(m.num_vertices());
+  std::vector<Halfedge_index> hmap(m.num_halfedges());
+  std::vector<Face_index> fmap(m.num_faces());
+  Index_maps_visitor visitor{vmap, hmap, fmap};
+  after.collect_garbage(visitor);
+  check(m, after, false, vmap, hmap, fmap);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
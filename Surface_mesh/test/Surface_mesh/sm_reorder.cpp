@@ -0,0 +1,143 @@
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Surface_mesh/reorder_for_locality.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+typedef CGAL::Surface_mesh<Point_3> Sm;
+typedef Sm::Vertex_index Vertex_index;
+typedef Sm::Halfedge_index Halfedge_index;
+typedef Sm::Edge_index Edge_index;
+typedef Sm::Face_index Face_index;
+
+// records the old indices of the elements in property maps
+void add_ids(Sm& m)
+{
+  Sm::Property_map<Vertex_index, std::size_t> vid = m.add_property_map<Vertex_index, std::size_t>("v:id").first;
+  Sm::Property_map<Halfedge_index, std::size_t> hid = m.add_property_map<Halfedge_index, std::size_t>("h:id").first;
+  Sm::Property_map<Face_index, std::size_t> fid = m.add_property_map<Face_index, std::size_t>("f:id").first;
+  Sm::Property_map<Edge_index, bool> eodd = m.add_property_map<Edge_index, bool>("e:odd").first;
+  for(Vertex_index v : m.vertices())
+    vid[v] = v;
+  for(Halfedge_index h : m.halfedges())
+    hid[h] = h;
+  for(Face_index f : m.faces())
+    fid[f] = f;
+  for(Edge_index e : m.edges())
+    eodd[e] = (e % 2 == 1);
+}
+
+// the elements and their properties are kept, with the same connectivity
+void check(const Sm& before, const Sm& after)
+{
+  assert(after.is_valid(false));
+  assert(!after.has_garbage());
+  assert(after.num_vertices() == before.number_of_vertices());
+  assert(after.num_halfedges() == before.number_of_halfedges());
+  assert(after.num_faces() == before.number_of_faces());
+
+  Sm::Property_map<Vertex_index, std::size_t> vid = after.property_map<Vertex_index, std::size_t>("v:id").first;
+  Sm::Property_map<Halfedge_index, std::size_t> hid = after.property_map<Halfedge_index, std::size_t>("h:id").first;
+  Sm::Property_map<Face_index, std::size_t> fid = after.property_map<Face_index, std::size_t>("f:id").first;
+  Sm::Property_map<Edge_index, bool> eodd = after.property_map<Edge_index, bool>("e:odd").first;
+
+  std::vector<bool> vmet(before.num_vertices(), false);
+  for(Vertex_index v : after.vertices())
+  {
+    const Vertex_index old(Sm::size_type(vid[v]));
+    assert(!before.is_removed(old) && !vmet[old]);
+    vmet[old] = true;
+    assert(after.point(v) == before.point(old));
+    if(!after.is_isolated(v))
+      assert(hid[after.halfedge(v)] == std::size_t(before.halfedge(old)));
+  }
+  for(Halfedge_index h : after.halfedges())
+  {
+    const Halfedge_index old(Sm::size_type(hid[h]));
+    assert(hid[after.opposite(h)] == std::size_t(before.opposite(old)));
+    assert(hid[after.next(h)] == std::size_t(before.next(old)));
+    assert(hid[after.prev(h)] == std::size_t(before.prev(old)));
+    assert(vid[after.target(h)] == std::size_t(before.target(old)));
+    assert(after.is_border(h) == before.is_border(old));
+    if(!after.is_border(h))
+      assert(fid[after.face(h)] == std::size_t(before.face(old)));
+    assert(eodd[after.edge(h)] == (before.edge(old) % 2 == 1));
+  }
+  for(Face_index f : after.faces())
+  {
+    const Face_index old(Sm::size_type(fid[f]));
+    assert(hid[after.halfedge(f)] == std::size_t(before.halfedge(old)));
+  }
+}
+
+// the sum of the index differences between the endpoints of the edges
+std::size_t spread(const Sm& m)
+{
+  std::size_t res = 0;
+  for(Edge_index e : m.edges())
+  {
+    const std::size_t s = m.source(m.halfedge(e)), t = m.target(m.halfedge(e));
+    res += (std::max)(s, t) - (std::min)(s, t);
+  }
+  return res;
+}
+
+int main()
+{
+  Sm m;
+  std::ifstream in(CGAL::data_file_path("meshes/elephant.off"));
+  assert(CGAL::IO::read_OFF(in, m));
+  add_ids(m);
+
+  // shuffle the vertices, edges, and faces
+  std::vector<Vertex_index> vertices(m.vertices().begin(), m.vertices().end());
+  std::vector<Edge_index> edges(m.edges().begin(), m.edges().end());
+  std::vector<Face_index> faces(m.faces().begin(), m.faces().end());
+  std::reverse(vertices.begin(), vertices.end());
+  std::rotate(edges.begin(), edges.begin() + edges.size() / 3, edges.end());
+  std::reverse(faces.begin(), faces.end());
+  Sm shuffled = m;
+  shuffled.reorder(vertices, edges, faces);
+  check(m, shuffled);
+  assert(shuffled.point(Vertex_index(0)) == m.point(vertices.front()));
+
+  Sm hilbert = shuffled;
+  CGAL::reorder_for_locality(hilbert);
+  check(m, hilbert);
+  assert(spread(hilbert) < spread(shuffled));
+
+  Sm bfs = shuffled;
+  CGAL::reorder_for_locality(bfs, CGAL::parameters::use_breadth_first_order(true)
+                                                    .concurrency_tag(CGAL::Parallel_if_available_tag()));
+  check(m, bfs);
+  assert(spread(bfs) < spread(shuffled));
+
+  // the garbage is collected first
+  Sm with_garbage = shuffled;
+  CGAL::Euler::remove_face(with_garbage.halfedge(Face_index(0)), with_garbage);
+  Sm collected = with_garbage;
+  collected.collect_garbage();
+  CGAL::reorder_for_locality(with_garbage);
+  assert(with_garbage.is_valid(false));
+  assert(!with_garbage.has_garbage());
+  assert(with_garbage.num_halfedges() == collected.num_halfedges());
+  assert(with_garbage.num_faces() == collected.num_faces());
+  Sm::Property_map<Vertex_index, std::size_t> vid = with_garbage.property_map<Vertex_index, std::size_t>("v:id").first;
+  Sm::Property_map<Vertex_index, std::size_t> cvid = collected.property_map<Vertex_index, std::size_t>("v:id").first;
+  std::vector<std::size_t> ids(vid.begin(), vid.end()), cids(cvid.begin(), cvid.end());
+  std::sort(ids.begin(), ids.end());
+  std::sort(cids.begin(), cids.end());
+  assert(ids == cids);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
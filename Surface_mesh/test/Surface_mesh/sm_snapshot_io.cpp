@@ -0,0 +1,165 @@
+#include <CGAL/Surface_mesh/Surface_mesh.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Simple_cartesian.h>
+
+#include <cassert>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel   Kernel;
+typedef Kernel::Point_3                                       Point;
+typedef Kernel::Vector_3                                      Vector;
+
+typedef CGAL::Surface_mesh<Point>                             SMesh;
+typedef SMesh::Vertex_index                                   Vertex_index;
+typedef SMesh::Halfedge_index                                 Halfedge_index;
+typedef SMesh::Edge_index                                     Edge_index;
+typedef SMesh::Face_index                                     Face_index;
+
+void compare(const SMesh& mesh, const SMesh& other)
+{
+  assert(other.is_valid(false));
+  assert(other.num_vertices() == mesh.num_vertices());
+  assert(other.num_halfedges() == mesh.num_halfedges());
+  assert(other.num_faces() == mesh.num_faces());
+  assert(other.number_of_removed_vertices() == mesh.number_of_removed_vertices());
+  assert(other.number_of_removed_edges() == mesh.number_of_removed_edges());
+  assert(other.number_of_removed_faces() == mesh.number_of_removed_faces());
+  assert(other.has_garbage() == mesh.has_garbage());
+
+  for(Vertex_index v : mesh.vertices())
+  {
+    assert(!other.is_removed(v));
+    assert(other.point(v) == mesh.point(v));
+    assert(other.halfedge(v) == mesh.halfedge(v));
+  }
+  for(Halfedge_index h : mesh.halfedges())
+  {
+    assert(other.next(h) == mesh.next(h));
+    assert(other.target(h) == mesh.target(h));
+    assert(other.face(h) == mesh.face(h));
+  }
+  for(Face_index f : mesh.faces())
+    assert(other.halfedge(f) == mesh.halfedge(f));
+}
+
+int main()
+{
+  SMesh mesh;
+  std::ifstream in(CGAL::data_file_path("meshes/elephant.off"));
+  assert(CGAL::IO::read_OFF(in, mesh));
+
+  SMesh::Property_map<Vertex_index, double> vdouble = mesh.add_property_map<Vertex_index, double>("v:double", 1.5).first;
+  SMesh::Property_map<Vertex_index, Vector> vnormal = mesh.add_property_map<Vertex_index, Vector>("v:normal").first;
+  SMesh::Property_map<Edge_index, bool> ebool = mesh.add_property_map<Edge_index, bool>("e:bool").first;
+  SMesh::Property_map<Face_index, CGAL::IO::Color> fcolor = mesh.add_property_map<Face_index, CGAL::IO::Color>("f:color").first;
+  SMesh::Property_map<Halfedge_index, Vertex_index> hvertex = mesh.add_property_map<Halfedge_index, Vertex_index>("h:vertex").first;
+  mesh.add_property_map<Face_index, std::string>("f:string", "not written");
+
+  for(Vertex_index v : mesh.vertices())
+  {
+    vdouble[v] = 0.5 * v;
+    vnormal[v] = Vector(1, 2, v);
+  }
+  for(Edge_index e : mesh.edges())
+    ebool[e] = (e % 3 == 0);
+  for(Face_index f : mesh.faces())
+    fcolor[f] = CGAL::IO::Color(f % 256, 0, 255);
+  for(Halfedge_index h : mesh.halfedges())
+    hvertex[h] = mesh.target(h);
+
+  // removed elements and free lists are written too
+  CGAL::Euler::remove_face(mesh.halfedge(Face_index(3)), mesh);
+  CGAL::Euler::remove_face(mesh.halfedge(Face_index(5)), mesh);
+  mesh.remove_vertex(mesh.add_vertex(Point(0, 0, 0)));
+  mesh.remove_vertex(mesh.add_vertex(Point(1, 0, 0)));
+  assert(mesh.has_garbage());
+
+  assert(CGAL::IO::write_binary_snapshot("tmp.sms", mesh));
+
+  // Property maps of unsupported types must be added before reading
+  SMesh other;
+  SMesh::Property_map<Vertex_index, Vector> other_vnormal = other.add_property_map<Vertex_index, Vector>("v:normal").first;
+  assert(CGAL::IO::read_binary_snapshot("tmp.sms", other));
+  compare(mesh, other);
+
+  SMesh::Property_map<Vertex_index, double> other_vdouble;
+  SMesh::Property_map<Edge_index, bool> other_ebool;
+  SMesh::Property_map<Face_index, CGAL::IO::Color> other_fcolor;
+  SMesh::Property_map<Halfedge_index, Vertex_index> other_hvertex;
+  bool found;
+  std::tie(other_vdouble, found) = other.property_map<Vertex_index, double>("v:double");
+  assert(found);
+  std::tie(other_ebool, found) = other.property_map<Edge_index, bool>("e:bool");
+  assert(found);
+  std::tie(other_fcolor, found) = other.property_map<Face_index, CGAL::IO::Color>("f:color");
+  assert(found);
+  std::tie(other_hvertex, found) = other.property_map<Halfedge_index, Vertex_index>("h:vertex");
+  assert(found);
+  assert((!other.property_map<Face_index, std::string>("f:string").second));
+
+  for(Vertex_index v : mesh.vertices())
+  {
+    assert(other_vdouble[v] == vdouble[v]);
+    assert(other_vnormal[v] == vnormal[v]);
+  }
+  for(Edge_index e : mesh.edges())
+    assert(other_ebool[e] == ebool[e]);
+  for(Face_index f : mesh.faces())
+    assert(other_fcolor[f] == fcolor[f]);
+  for(Halfedge_index h : mesh.halfedges())
+    assert(other_hvertex[h] == hvertex[h]);
+
+  // the free lists are restored
+  Face_index f = other.add_face();
+  assert(f == Face_index(5) || f == Face_index(3));
+  other.remove_face(f);
+
+  // once collected, both meshes are the same
+  mesh.collect_garbage();
+  other.collect_garbage();
+  compare(mesh, other);
+
+  // stream version
+  std::ostringstream oss;
+  assert(CGAL::IO::write_binary_snapshot(oss, mesh));
+  std::istringstream iss(oss.str());
+  SMesh third;
+  assert(CGAL::IO::read_binary_snapshot(iss, third));
+  compare(mesh, third);
+
+  // snapshots of meshes with another point type or truncated snapshots are rejected
+  CGAL::Surface_mesh<CGAL::Simple_cartesian<float>::Point_3> float_mesh;
+  assert(!CGAL::IO::read_binary_snapshot("tmp.sms", float_mesh));
+
+  const std::string truncated = oss.str().substr(0, oss.str().size() - 1);
+  std::istringstream truncated_iss(truncated);
+  assert(!CGAL::IO::read_binary_snapshot(truncated_iss, third, CGAL::parameters::verbose(true)));
+  compare(mesh, third);
+
+  // snapshots whose connectivity refers to elements that do not exist are rejected
+  const Halfedge_index h(7);
+  const Face_index f0(0);
+  for(int i=0; i<5; ++i)
+  {
+    SMesh corrupted = mesh;
+    switch(i)
+    {
+      case 0: corrupted.set_target(h, Vertex_index(corrupted.num_vertices())); break;
+      case 1: corrupted.set_next_only(h, Halfedge_index(corrupted.num_halfedges() + 2)); break;
+      case 2: corrupted.set_face(h, Face_index(corrupted.num_faces())); break;
+      case 3: corrupted.set_halfedge(corrupted.target(h), Halfedge_index(corrupted.num_halfedges())); break;
+      default: corrupted.set_halfedge(f0, Halfedge_index(corrupted.num_halfedges() + 1));
+    }
+    std::ostringstream corrupted_oss;
+    assert(CGAL::IO::write_binary_snapshot(corrupted_oss, corrupted));
+    std::istringstream corrupted_iss(corrupted_oss.str());
+    assert(!CGAL::IO::read_binary_snapshot(corrupted_iss, third));
+    compare(mesh, third);
+  }
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
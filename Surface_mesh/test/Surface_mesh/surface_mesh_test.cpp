@@ -228,6 +228,55 @@ void properties () {
 
   boost::tie(prop, created)= f.m.add_property_map<Sm::Vertex_index, int>("illuminatiproperty");
   assert(created == false);
+
+  // properties with the same name and different types
+  Sm::Property_map<Sm::Vertex_index, double> dprop;
+  boost::tie(dprop, created) = f.m.add_property_map<Sm::Vertex_index, double>("illuminatiproperty", 1.5);
+  assert(created == true);
+  assert((f.m.property_map<Sm::Vertex_index, int>("illuminatiproperty").first[f.x] == 23));
+  assert((f.m.property_map<Sm::Vertex_index, double>("illuminatiproperty").first[f.x] == 1.5));
+
+  // the type of a name is the type of the first property added with this name
+  for(int i=0; i<10; ++i)
+    f.m.add_property_map<Sm::Vertex_index, char>("illuminatiproperty" + std::string(i, 'x'));
+  f.m.add_property_map<Sm::Vertex_index, float>("illuminatiproperty");
+  assert(f.m.property_type<Sm::Vertex_index>("illuminatiproperty") == typeid(int));
+  {
+    Sm copy = f.m;
+    assert(copy.property_type<Sm::Vertex_index>("illuminatiproperty") == typeid(int));
+    Sm::Property_map<Sm::Vertex_index, int> iprop = copy.property_map<Sm::Vertex_index, int>("illuminatiproperty").first;
+    copy.remove_property_map(iprop);
+    assert(copy.property_type<Sm::Vertex_index>("illuminatiproperty") == typeid(double));
+  }
+
+  // lookups, additions, and removals among many properties; handles stay valid
+  std::vector<Sm::Property_map<Sm::Face_index, int> > fprops;
+  for(int i=0; i<100; ++i)
+    fprops.push_back(f.m.add_property_map<Sm::Face_index, int>("f:" + std::to_string(i), i).first);
+  for(int i=0; i<100; i+=2)
+    f.m.remove_property_map(fprops[i]);
+  for(int i=0; i<100; ++i)
+  {
+    Sm::Property_map<Sm::Face_index, int> fprop;
+    boost::tie(fprop, created) = f.m.property_map<Sm::Face_index, int>("f:" + std::to_string(i));
+    assert(created == (i % 2 == 1));
+    if(created)
+    {
+      assert(fprop == fprops[i]);
+      assert(fprop[*faces(f.m).begin()] == i);
+    }
+  }
+  assert(f.m.property_type<Sm::Face_index>("f:1") == typeid(int));
+  assert(f.m.property_type<Sm::Face_index>("f:0") == typeid(void));
+
+  // copies and removals of all the added properties update the index
+  Sm copy = f.m;
+  assert((copy.property_map<Sm::Face_index, int>("f:99").second));
+  copy.remove_property_maps<Sm::Face_index>();
+  assert((!copy.property_map<Sm::Face_index, int>("f:99").second));
+  assert((copy.property_map<Sm::Face_index, bool>("f:removed").second));
+  boost::tie(dprop, created) = copy.add_property_map<Sm::Vertex_index, double>("illuminatiproperty");
+  assert(created == false);
 }
 
 void move () {
@@ -96,6 +96,19 @@ the number of edges effectively removed.
                      However, the ordering of the priority queue is no longer strict and there is a possibility
                      that some elements that ought to have been collapsed are not actually collapsed.}
    \cgalParamNEnd
+
+  \cgalParamNBegin{concurrency_tag}
+     \cgalParamDescription{a tag indicating if the simplification should be run sequentially or in parallel}
+     \cgalParamType{Either `CGAL::Sequential_tag`, `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+     \cgalParamDefault{`CGAL::Sequential_tag()`}
+     \cgalParamExtra{In parallel, the edges are popped from the priority queue in batches of edges whose
+                     endpoints have disjoint one-rings. The costs, the placements, and the validity of the collapses
+                     of a batch are computed concurrently, while the collapses themselves are performed sequentially.
+                     The `get_cost` and `get_placement` policies must thus be safe to call concurrently, which is the case
+                     for all the policies provided by \cgal. Since the edges are not collapsed in the exact order
+                     of their costs, the output differs from the one of the sequential version.}
+     \cgalParamExtra{Parallel mode requires the \ref thirdpartyTBB library.}
+   \cgalParamNEnd
 \cgalNamedParamsEnd
 
 \cgalHeading{Semantics}
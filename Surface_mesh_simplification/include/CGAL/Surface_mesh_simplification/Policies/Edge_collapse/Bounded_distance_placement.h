@@ -20,10 +20,12 @@
 #include <CGAL/assertions.h>
 #include <CGAL/Default.h>
 #include <CGAL/intersections.h>
+#include <CGAL/mutex.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 
 #include <boost/optional.hpp>
 
+#include <atomic>
 #include <vector>
 #include <type_traits>
 
@@ -72,9 +74,28 @@ private:
                                        get(profile.vertex_point_map(), target(next(h, tm), tm))));
     }
 
-    m_tree_ptr = new AABB_tree(m_input_triangles.begin(), m_input_triangles.end());
-    const_cast<AABB_tree*>(m_tree_ptr)->build();
-    const_cast<AABB_tree*>(m_tree_ptr)->accelerate_distance_queries();
+    AABB_tree* tree_ptr = new AABB_tree(m_input_triangles.begin(), m_input_triangles.end());
+    tree_ptr->build();
+    tree_ptr->accelerate_distance_queries();
+    m_tree_ptr = tree_ptr;
+  }
+
+  // The tree is built at the first call, which might happen concurrently
+  // when the simplification is run in parallel
+  template <typename Profile>
+  const AABB_tree* tree(const Profile& profile) const
+  {
+    const AABB_tree* tree_ptr = m_tree_ptr;
+    if(tree_ptr == nullptr)
+    {
+#ifdef CGAL_HAS_THREADS
+      CGAL_SCOPED_LOCK(m_tree_mutex);
+#endif
+      if(m_tree_ptr == nullptr)
+        initialize_tree(profile);
+      tree_ptr = m_tree_ptr;
+    }
+    return tree_ptr;
   }
 
 public:
@@ -86,6 +107,14 @@ public:
       m_base_placement(placement)
   { }
 
+  // the tree is not shared: it is built again by the copy if needed
+  Bounded_distance_placement(const Bounded_distance_placement& other)
+    :
+      m_sq_threshold_dist(other.m_sq_threshold_dist),
+      m_tree_ptr(nullptr),
+      m_base_placement(other.m_base_placement)
+  { }
+
   ~Bounded_distance_placement()
   {
     if(m_tree_ptr != nullptr)
@@ -101,15 +130,14 @@ public:
     boost::optional<typename Profile::Point> op = m_base_placement(profile);
     if(op)
     {
-      if(m_tree_ptr == nullptr)
-        initialize_tree(profile);
+      const AABB_tree* tree_ptr = tree(profile);
 
-      CGAL_assertion(m_tree_ptr != nullptr);
-      CGAL_assertion(!m_tree_ptr->empty());
+      CGAL_assertion(tree_ptr != nullptr);
+      CGAL_assertion(!tree_ptr->empty());
 
       const Point& p = *op;
 
-      const Point& cp = m_tree_ptr->best_hint(p).first;
+      const Point& cp = tree_ptr->best_hint(p).first;
 
       // We could do better by having access to the internal kd-tree
       // and call search_any_point with a fuzzy_sphere.
@@ -118,7 +146,7 @@ public:
       // any face closer than the threshold is intersected by
       // the sphere (avoid the inclusion of the mesh into the threshold sphere)
       if(CGAL::compare_squared_distance(p, cp, m_sq_threshold_dist) != LARGER ||
-         m_tree_ptr->do_intersect(CGAL::Sphere_3<Geom_traits>(p, m_sq_threshold_dist)))
+         tree_ptr->do_intersect(CGAL::Sphere_3<Geom_traits>(p, m_sq_threshold_dist)))
         return op;
 
       return boost::optional<Point>();
@@ -129,8 +157,11 @@ public:
 
 private:
   const FT m_sq_threshold_dist;
-  mutable const AABB_tree* m_tree_ptr;
+  mutable std::atomic<const AABB_tree*> m_tree_ptr;
   mutable std::vector<Triangle> m_input_triangles;
+#ifdef CGAL_HAS_THREADS
+  mutable CGAL_MUTEX m_tree_mutex;
+#endif
 
   const BasePlacement m_base_placement;
 };
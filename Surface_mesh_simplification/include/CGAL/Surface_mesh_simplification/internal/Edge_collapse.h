@@ -19,10 +19,16 @@
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/boost/graph/helpers.h>
 #include <CGAL/Modifiable_priority_queue.h>
+#include <CGAL/for_each.h>
+#include <CGAL/tags.h>
 #include <CGAL/use.h>
 
 #include <boost/scoped_array.hpp>
 
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
 namespace CGAL {
 namespace Surface_mesh_simplification {
 namespace internal {
@@ -91,7 +97,8 @@ template<class TM_,
          class GetPlacement_,
          class ShouldIgnore_,
          class VisitorT_,
-         bool use_relaxed_heap>
+         bool use_relaxed_heap,
+         class ConcurrencyTag_ = Sequential_tag>
 class EdgeCollapse
 {
   typedef EdgeCollapse                                                    Self;
@@ -108,6 +115,7 @@ public:
   typedef GetPlacement_                                                   Get_placement;
   typedef ShouldStop_                                                     Should_stop;
   typedef VisitorT_                                                       Visitor;
+  typedef ConcurrencyTag_                                                 Concurrency_tag;
 
   typedef Edge_profile<Triangle_mesh, Vertex_point_map, Geom_traits>      Profile;
 
@@ -223,13 +231,15 @@ public:
 private:
   void collect();
   void loop();
+  void loop_in_batches();
 
   bool is_collapse_topologically_valid(const Profile& profile);
   bool is_tetrahedron(const halfedge_descriptor h);
   bool is_open_triangle(const halfedge_descriptor h1);
   bool is_collapse_geometrically_valid(const Profile& profile, Placement_type placement);
-  void collapse(const Profile& profile, Placement_type placement);
+  vertex_descriptor collapse(const Profile& profile, Placement_type placement);
   void update_neighbors(const vertex_descriptor v_kept);
+  void update_neighbors(const std::vector<vertex_descriptor>& kept_vertices);
 
   Profile create_profile(const halfedge_descriptor h) {
     return Profile(h, m_tm, m_traits, m_vim, m_vpm, m_him, m_has_border);
@@ -403,8 +413,8 @@ private:
   CGAL_SMS_DEBUG_CODE(unsigned m_step;)
 };
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 EdgeCollapse(Triangle_mesh& tmesh,
              const Geom_traits& traits,
              const Should_stop& should_stop,
@@ -445,9 +455,9 @@ EdgeCollapse(Triangle_mesh& tmesh,
 #endif
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 int
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 run()
 {
   CGAL_expensive_precondition(is_valid_polygon_mesh(m_tm) && CGAL::is_triangle_mesh(m_tm));
@@ -461,7 +471,10 @@ run()
   collect();
 
   // Then proceed to collapse each edge in turn
-  loop();
+  if(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+    loop_in_batches();
+  else
+    loop();
 
   CGAL_SMS_TRACE(0, "Finished: " << (m_initial_edge_count - m_current_edge_count) << " edges removed.");
 
@@ -472,9 +485,9 @@ run()
   return r;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 collect()
 {
   CGAL_SMS_TRACE(0, "collecting edges...");
@@ -492,6 +505,25 @@ collect()
 
   std::set<halfedge_descriptor> zero_length_edges;
 
+  // In parallel, the costs are computed beforehand, and the edges are
+  // inserted in the PQ in the same order as in the sequential version
+  const bool costs_are_computed = std::is_convertible<Concurrency_tag, Parallel_tag>::value;
+  if(costs_are_computed)
+  {
+    std::vector<halfedge_descriptor> candidates;
+    for(edge_descriptor e : edges(m_tm))
+      if(!is_constrained(halfedge(e, m_tm)))
+        candidates.push_back(halfedge(e, m_tm));
+
+    CGAL::for_each<Concurrency_tag>(candidates, [&](const halfedge_descriptor h) -> bool
+    {
+      const Profile profile = create_profile(h);
+      if(!m_traits.equal_3_object()(profile.p0(), profile.p1()))
+        get_data(h).cost() = cost(profile);
+      return true;
+    });
+  }
+
   for(edge_descriptor e : edges(m_tm))
   {
     const halfedge_descriptor h = halfedge(e, m_tm);
@@ -507,7 +539,8 @@ collect()
     {
       Edge_data& data = get_data(h);
 
-      data.cost() = cost(profile);
+      if(!costs_are_computed)
+        data.cost() = cost(profile);
       insert_in_PQ(h, data);
 
       m_visitor.OnCollected(profile, data.cost());
@@ -581,9 +614,9 @@ collect()
   CGAL_SMS_TRACE(0, "Initial edge count: " << m_initial_edge_count);
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 loop()
 {
   CGAL_SMS_TRACE(0, "Collapsing edges...");
@@ -631,7 +664,7 @@ loop()
                                        << " " << get(m_vpm, target(*h, m_tm)) << "\n";
 #endif
           if(m_should_ignore(profile, placement)!= boost::none){
-            collapse(profile, placement);
+            update_neighbors(collapse(profile, placement));
           }
           else
           {
@@ -670,9 +703,170 @@ loop()
   }
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+// Parallel version of `loop()`: batches of edges are popped from the PQ such that
+// the one-rings of the endpoints of the edges of a batch are pairwise disjoint.
+// The validity and the placement of the collapses of a batch are computed in parallel,
+// the collapses are performed sequentially in the order of the PQ, and the costs of the
+// edges around the kept vertices are updated in parallel once the whole batch is collapsed.
+//
+// A collapse only modifies the one-rings of its endpoints, and its validity only depends
+// on these one-rings and on the triangles adjacent to them: the collapses of a batch do not
+// interfere with each other.
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+loop_in_batches()
+{
+  CGAL_SMS_TRACE(0, "Collapsing edges in batches...");
+
+  struct Candidate
+  {
+    Candidate(const halfedge_descriptor h) : h(h) { }
+
+    halfedge_descriptor h;
+    boost::optional<Profile> profile;
+    Placement_type placement;
+    bool is_topologically_valid = false;
+    bool is_geometrically_valid = false;
+  };
+
+  // a vertex is marked with the index of the last batch whose one-rings contain it
+  std::vector<std::size_t> vertex_marks(num_vertices(m_tm), 0);
+  std::size_t batch_index = 0;
+
+  auto is_one_ring_free = [&](const halfedge_descriptor h) -> bool
+  {
+    for(vertex_descriptor v : { source(h, m_tm), target(h, m_tm) })
+    {
+      if(vertex_marks[get(m_vim, v)] == batch_index)
+        return false;
+      for(halfedge_descriptor hv : halfedges_around_target(v, m_tm))
+        if(vertex_marks[get(m_vim, source(hv, m_tm))] == batch_index)
+          return false;
+    }
+    return true;
+  };
+
+  auto mark_one_ring = [&](const halfedge_descriptor h)
+  {
+    for(vertex_descriptor v : { source(h, m_tm), target(h, m_tm) })
+    {
+      vertex_marks[get(m_vim, v)] = batch_index;
+      for(halfedge_descriptor hv : halfedges_around_target(v, m_tm))
+        vertex_marks[get(m_vim, source(hv, m_tm))] = batch_index;
+    }
+  };
+
+  std::vector<Candidate> candidates;
+  std::vector<halfedge_descriptor> postponed;
+  std::vector<vertex_descriptor> kept_vertices;
+
+  for(;;)
+  {
+    ++batch_index;
+
+    // Larger batches expose more parallelism, but depart further from the order of the PQ
+    const std::size_t batch_size = (std::max)(std::size_t(64), std::size_t(m_current_edge_count / 100));
+
+    candidates.clear();
+    postponed.clear();
+
+    boost::optional<halfedge_descriptor> opt_h;
+    while(candidates.size() < batch_size && postponed.size() < batch_size && (opt_h = pop_from_PQ()))
+    {
+      CGAL_SMS_TRACE(1, "Popped " << edge_to_string(*opt_h));
+      CGAL_assertion(!is_constrained(*opt_h));
+
+      if(!get_data(*opt_h).cost())
+      {
+        m_visitor.OnSelected(create_profile(*opt_h), get_data(*opt_h).cost(),
+                             m_initial_edge_count, m_current_edge_count);
+        CGAL_SMS_TRACE(1, edge_to_string(*opt_h) << " uncomputable cost." );
+        continue;
+      }
+
+      if(is_one_ring_free(*opt_h))
+      {
+        mark_one_ring(*opt_h);
+        candidates.emplace_back(*opt_h);
+      }
+      else
+      {
+        postponed.push_back(*opt_h);
+      }
+    }
+
+    if(candidates.empty())
+      break;
+
+    // The postponed edges are put back in the PQ before the collapses,
+    // so that their costs are updated if they are next to a kept vertex
+    for(halfedge_descriptor h : postponed)
+      insert_in_PQ(h, get_data(h));
+
+    CGAL::for_each<Concurrency_tag>(candidates, [&](Candidate& c) -> bool
+    {
+      c.profile.emplace(create_profile(c.h));
+      c.is_topologically_valid = is_collapse_topologically_valid(*c.profile);
+      if(c.is_topologically_valid)
+      {
+        c.placement = get_placement(*c.profile);
+        c.is_geometrically_valid = is_collapse_geometrically_valid(*c.profile, c.placement);
+      }
+      return true;
+    });
+
+    kept_vertices.clear();
+    bool stop = false;
+    for(const Candidate& c : candidates)
+    {
+      const Profile& profile = *c.profile;
+      Cost_type cost = get_data(c.h).cost();
+
+      m_visitor.OnSelected(profile, cost, m_initial_edge_count, m_current_edge_count);
+
+      if(m_should_stop(*cost, profile, m_initial_edge_count, m_current_edge_count))
+      {
+        m_visitor.OnStopConditionReached(profile);
+
+        CGAL_SMS_TRACE(0, "Stop condition reached with initial edge count=" << m_initial_edge_count
+                            << " current edge count=" << m_current_edge_count
+                            << " current edge: " << edge_to_string(c.h));
+        stop = true;
+        break;
+      }
+
+      if(!c.is_topologically_valid)
+      {
+        m_visitor.OnNonCollapsable(profile);
+
+        CGAL_SMS_TRACE(1, edge_to_string(c.h) << " NOT Collapsable" );
+      }
+      else if(c.is_geometrically_valid)
+      {
+        if(m_should_ignore(profile, c.placement) != boost::none)
+        {
+          kept_vertices.push_back(collapse(profile, c.placement));
+        }
+        else
+        {
+          m_visitor.OnNonCollapsable(profile);
+
+          CGAL_SMS_TRACE(1, edge_to_string(c.h) << " NOT Collapsable" );
+        }
+      }
+    }
+
+    if(stop)
+      break;
+
+    update_neighbors(kept_vertices);
+  }
+}
+
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_border_or_constrained(const vertex_descriptor v) const
 {
   for(halfedge_descriptor h : halfedges_around_target(v, m_tm))
@@ -684,9 +878,9 @@ is_border_or_constrained(const vertex_descriptor v) const
   return false;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_constrained(const vertex_descriptor v) const
 {
   for(halfedge_descriptor h : halfedges_around_target(v, m_tm))
@@ -705,9 +899,9 @@ is_constrained(const vertex_descriptor v) const
 // The link condition is as follows: for every vertex 'k' adjacent to both 'p and 'q',
 // "p,k,q" is a facet of the mesh.
 //
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-  EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+  EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_collapse_topologically_valid(const Profile& profile)
 {
   bool res = true;
@@ -873,17 +1067,17 @@ is_collapse_topologically_valid(const Profile& profile)
   return res;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_tetrahedron(const halfedge_descriptor h)
 {
   return CGAL::is_tetrahedron(h, m_tm);
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_open_triangle(const halfedge_descriptor h1)
 {
   bool res = false;
@@ -912,9 +1106,9 @@ is_open_triangle(const halfedge_descriptor h1)
 // respective areas is no greater than a max value and the internal
 // dihedral angle formed by their supporting planes is no greater than
 // a given threshold
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 are_shared_triangles_valid(const Point& p0, const Point& p1, const Point& p2, const Point& p3) const
 {
   bool res = false;
@@ -964,9 +1158,9 @@ are_shared_triangles_valid(const Point& p0, const Point& p1, const Point& p2, co
 }
 
 // Returns the directed halfedge connecting v0 to v1, if exists.
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::halfedge_descriptor
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::halfedge_descriptor
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 find_connection(const vertex_descriptor v0,
                 const vertex_descriptor v1) const
 {
@@ -981,9 +1175,9 @@ find_connection(const vertex_descriptor v0,
 
 // Given the edge 'e' around the link for the collapsinge edge "v0-v1", finds the vertex that makes a triangle adjacent to 'e' but exterior to the link (i.e not containing v0 nor v1)
 // If 'e' is a null handle OR 'e' is a border edge, there is no such triangle and a null handle is returned.
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::vertex_descriptor
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::vertex_descriptor
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 find_exterior_link_triangle_3rd_vertex(const halfedge_descriptor e,
                                        const vertex_descriptor v0,
                                        const vertex_descriptor v1) const
@@ -1017,9 +1211,9 @@ find_exterior_link_triangle_3rd_vertex(const halfedge_descriptor e,
 // A collapse is geometrically valid if, in the resulting local mesh no two adjacent triangles form an internal dihedral angle
 // greater than a fixed threshold (i.e. triangles do not "fold" into each other)
 //
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 bool
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 is_collapse_geometrically_valid(const Profile& profile, Placement_type k0)
 {
   bool res = false;
@@ -1116,9 +1310,9 @@ is_collapse_geometrically_valid(const Profile& profile, Placement_type k0)
   return res;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
-void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+typename EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::vertex_descriptor
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 collapse(const Profile& profile,
          Placement_type placement)
 {
@@ -1214,14 +1408,14 @@ collapse(const Profile& profile,
   m_visitor.OnCollapsed(profile, v_res);
   internal::After_collapse_oracles_updater<Self>(*this)(profile, v_res);
 
-  update_neighbors(v_res);
-
   CGAL_SMS_DEBUG_CODE(++m_step;)
+
+  return v_res;
 }
 
-template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH>
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
 void
-EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH>::
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
 update_neighbors(const vertex_descriptor v_kept)
 {
   CGAL_SMS_TRACE(3,"Updating cost of neighboring edges...");
@@ -1284,6 +1478,74 @@ update_neighbors(const vertex_descriptor v_kept)
   }
 }
 
+// Updates the costs of the edges around the vertices kept by the collapses of a batch:
+// the costs are computed in parallel, then assigned and updated in the PQ sequentially.
+template<class TM, class GT, class SP, class VIM, class VPM,class HIM, class ECM, class CF, class PF, class SI, class V, bool URH, class CT>
+void
+EdgeCollapse<TM,GT,SP,VIM,VPM,HIM,ECM,CF,PF,SI,V,URH,CT>::
+update_neighbors(const std::vector<vertex_descriptor>& kept_vertices)
+{
+  CGAL_SMS_TRACE(3,"Updating cost of neighboring edges of " << kept_vertices.size() << " vertices...");
+
+  // (A) collect all edges to update their cost: all those around each vertex adjacent to a vertex kept
+  typedef std::set<halfedge_descriptor, Compare_id>                       Edge_set;
+
+  Edge_set edges_to_update(Compare_id(this));
+  Edge_set edges_to_insert(Compare_id(this));
+
+  for(vertex_descriptor v_kept : kept_vertices)
+  {
+    for(halfedge_descriptor h : halfedges_around_target(v_kept, m_tm))
+    {
+      vertex_descriptor v_adj = source(h, m_tm);
+
+      for(halfedge_descriptor h2 : halfedges_around_target(v_adj, m_tm))
+      {
+        h2 = primary_edge(h2);
+
+        if(get_data(h2).is_in_PQ())
+          edges_to_update.insert(h2);
+        else if(!is_constrained(h2)) //do not insert constrained edges
+          edges_to_insert.insert(h2);
+      }
+    }
+  }
+
+  // (B) compute the costs aside: the PQ only supports the change of the cost
+  // of one edge at a time, immediately followed by the update of this edge
+  std::vector<std::pair<halfedge_descriptor, Cost_type> > new_costs;
+  new_costs.reserve(edges_to_update.size() + edges_to_insert.size());
+  for(halfedge_descriptor h : edges_to_update)
+    new_costs.emplace_back(h, Cost_type());
+  for(halfedge_descriptor h : edges_to_insert)
+    new_costs.emplace_back(h, Cost_type());
+
+  CGAL::for_each<Concurrency_tag>(new_costs, [&](std::pair<halfedge_descriptor, Cost_type>& c) -> bool
+  {
+    c.second = cost(create_profile(c.first));
+    return true;
+  });
+
+  // (C) update the PQ
+  for(std::size_t i=0; i<new_costs.size(); ++i)
+  {
+    const halfedge_descriptor h = new_costs[i].first;
+    Edge_data& data = get_data(h);
+    data.cost() = new_costs[i].second;
+
+    if(i < edges_to_update.size())
+    {
+      CGAL_SMS_TRACE(3, edge_to_string(h) << " updated in the PQ");
+      update_in_PQ(h, data);
+    }
+    else
+    {
+      CGAL_SMS_TRACE(3, edge_to_string(h) << " re-inserted in the PQ");
+      insert_in_PQ(h, data);
+    }
+  }
+}
+
 } // namespace Surface_mesh_simplification
 } // namespace CGAL
 
@@ -0,0 +1,202 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Polyhedron_3.h>
+
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/IO/polygon_mesh_io.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+
+#include <CGAL/Surface_mesh_simplification/edge_collapse.h>
+#include <CGAL/Surface_mesh_simplification/Edge_collapse_visitor_base.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Count_stop_predicate.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Edge_length_cost.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Midpoint_placement.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/LindstromTurk.h>
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/Bounded_distance_placement.h>
+#ifdef CGAL_EIGEN3_ENABLED
+#include <CGAL/Surface_mesh_simplification/Policies/Edge_collapse/GarlandHeckbert_plane_policies.h>
+#endif
+
+#include <atomic>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <cassert>
+
+namespace SMS = CGAL::Surface_mesh_simplification;
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3                                     Point_3;
+
+template <typename Mesh>
+bool read(const std::string& filename, Mesh& mesh)
+{
+  if(!CGAL::IO::read_polygon_mesh(filename, mesh) || !CGAL::is_triangle_mesh(mesh))
+  {
+    std::cerr << "Error: cannot read " << filename << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// The parallel simplification collapses edges in batches, so the result differs from the
+// sequential one, but it must be a valid triangle mesh that reaches the same stop condition
+template <typename Mesh, typename NamedParameters>
+void test(const Mesh& input, const NamedParameters& np)
+{
+  const std::size_t target = num_edges(input) / 10;
+  SMS::Count_stop_predicate<Mesh> stop(target);
+
+  Mesh seq_mesh = input, par_mesh = input;
+  const int seq_removed = SMS::edge_collapse(seq_mesh, stop, np);
+  const int par_removed = SMS::edge_collapse(par_mesh, stop,
+                                             np.concurrency_tag(CGAL::Parallel_if_available_tag()));
+
+  std::cout << "  " << seq_removed << " (sequential) vs " << par_removed
+            << " (parallel) edges removed" << std::endl;
+
+  assert(CGAL::is_valid_polygon_mesh(par_mesh));
+  assert(CGAL::is_triangle_mesh(par_mesh));
+
+  // some placements may forbid collapses before the stop condition is reached
+  if(edges(seq_mesh).size() < target)
+  {
+    assert(edges(par_mesh).size() < target);
+    assert(edges(par_mesh).size() + 3 >= target); // a collapse removes at most 3 edges
+  }
+}
+
+// Counts the computations of the costs, which may be concurrent
+template <typename Cost>
+struct Counting_cost
+{
+  Cost cost;
+  std::atomic<std::size_t>* nb_computations;
+
+  template <typename Profile, typename T>
+  boost::optional<typename Profile::FT> operator()(const Profile& profile, const T& placement) const
+  {
+    ++(*nb_computations);
+    return cost(profile, placement);
+  }
+};
+
+// Checks that the edges are selected by increasing costs when the priority queue has not been updated
+// in between. The PQ is updated once a collapse is followed by the computation of the new costs.
+// In the parallel version, a batch without any collapse is not followed by an update, and
+// the next batch may start with an edge that was postponed: the order is only checked once
+// an edge has been collapsed since the last update.
+template <typename Mesh>
+struct Cost_order_visitor
+  : SMS::Edge_collapse_visitor_base<Mesh>
+{
+  typedef typename SMS::Edge_collapse_visitor_base<Mesh>::FT FT;
+
+  const std::atomic<std::size_t>* nb_computations;
+  boost::optional<FT>* last_cost;
+  std::size_t* last_nb_computations;
+  bool* has_collapsed;
+
+  template <typename Profile>
+  void OnSelected(const Profile&, const boost::optional<FT>& cost, std::size_t, std::size_t)
+  {
+    if(!cost)
+      return;
+    if(*last_nb_computations != *nb_computations)
+      *has_collapsed = false;
+    if(*last_cost && *has_collapsed)
+      assert(**last_cost <= *cost);
+    *last_cost = cost;
+    *last_nb_computations = *nb_computations;
+  }
+
+  template <typename Profile, typename Vertex>
+  void OnCollapsed(const Profile&, const Vertex&)
+  {
+    *has_collapsed = true;
+  }
+};
+
+template <typename Mesh, typename ConcurrencyTag>
+void test_cost_order(const Mesh& input)
+{
+  typedef typename Kernel::FT FT;
+
+  std::atomic<std::size_t> nb_computations(0);
+  boost::optional<FT> last_cost;
+  std::size_t last_nb_computations = 0;
+  bool has_collapsed = false;
+
+  Counting_cost<SMS::Edge_length_cost<Mesh> > cost;
+  cost.nb_computations = &nb_computations;
+  Cost_order_visitor<Mesh> visitor;
+  visitor.nb_computations = &nb_computations;
+  visitor.last_cost = &last_cost;
+  visitor.last_nb_computations = &last_nb_computations;
+  visitor.has_collapsed = &has_collapsed;
+
+  Mesh mesh = input;
+  SMS::Count_stop_predicate<Mesh> stop(num_edges(mesh) / 10);
+  SMS::edge_collapse(mesh, stop, CGAL::parameters::get_cost(cost)
+                                                  .get_placement(SMS::Midpoint_placement<Mesh>())
+                                                  .visitor(visitor)
+                                                  .concurrency_tag(ConcurrencyTag()));
+  assert(last_cost);
+}
+
+template <typename Mesh>
+void test(const std::string& filename)
+{
+  std::cout << "Test " << filename << std::endl;
+
+  Mesh mesh;
+  if(!read(filename, mesh))
+  {
+    assert(false);
+    return;
+  }
+
+  std::cout << " Lindstrom-Turk" << std::endl;
+  test(mesh, CGAL::parameters::default_values());
+
+  std::cout << " Order of the costs" << std::endl;
+  test_cost_order<Mesh, CGAL::Sequential_tag>(mesh);
+  test_cost_order<Mesh, CGAL::Parallel_if_available_tag>(mesh);
+
+  std::cout << " Edge length" << std::endl;
+  test(mesh, CGAL::parameters::get_cost(SMS::Edge_length_cost<Mesh>())
+                              .get_placement(SMS::Midpoint_placement<Mesh>()));
+
+  // the AABB tree is lazily built by the first thread that needs it
+  std::cout << " Bounded distance" << std::endl;
+  const CGAL::Bbox_3 bbox = CGAL::Polygon_mesh_processing::bbox(mesh);
+  const double diag = std::sqrt(CGAL::square(bbox.xmax() - bbox.xmin()) +
+                                CGAL::square(bbox.ymax() - bbox.ymin()) +
+                                CGAL::square(bbox.zmax() - bbox.zmin()));
+  SMS::Bounded_distance_placement<SMS::LindstromTurk_placement<Mesh>, Kernel> placement(0.01 * diag);
+  test(mesh, CGAL::parameters::get_placement(placement));
+
+#ifdef CGAL_EIGEN3_ENABLED
+  std::cout << " Garland-Heckbert" << std::endl;
+  SMS::GarlandHeckbert_plane_policies<Mesh, Kernel> gh_policies(mesh);
+  test(mesh, CGAL::parameters::get_cost(gh_policies.get_cost())
+                              .get_placement(gh_policies.get_placement()));
+#endif
+}
+
+int main(int argc, char** argv)
+{
+  if(argc > 1)
+  {
+    test<CGAL::Surface_mesh<Point_3> >(argv[1]);
+    return EXIT_SUCCESS;
+  }
+
+  test<CGAL::Surface_mesh<Point_3> >("data/helmet.off");
+  test<CGAL::Polyhedron_3<Kernel> >("data/helmet.off");
+  test<CGAL::Surface_mesh<Point_3> >(CGAL::data_file_path("meshes/elephant.off"));
+  test<CGAL::Polyhedron_3<Kernel> >(CGAL::data_file_path("meshes/elephant.off"));
+
+  std::cout << "Done!" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -18,6 +18,15 @@ additional template parameters.
 
 \tparam FaceBase  must be a model of `TriangulationDSFaceBase_2`. The default is `Triangulation_ds_face_base_2<TDS>`.
 
+\tparam ConcurrencyTag enables the use of a concurrent
+container to store vertices and faces. It can be `Sequential_tag` (use of a
+`Compact_container` to store vertices and faces) or `Parallel_tag`
+(use of a `Concurrent_compact_container`). If it is
+`Parallel_tag`, the following functions can be called concurrently:
+`create_vertex()`, `create_face()`, `delete_vertex()`, and `delete_face()`,
+and `Delaunay_triangulation_2::insert(first, last)` inserts the points in parallel.
+`Sequential_tag` is the default value.
+
 \cgalModels `TriangulationDataStructure_2`
 
 \cgalHeading{Modifiers}
@@ -37,14 +46,17 @@ guarantee the combinatorial validity of the resulting data structure.
 \image html tds-insert_degree_2.png "Insertion and removal of degree 2 vertices. "
 \image latex tds-insert_degree_2.png "Insertion and removal of degree 2 vertices. "
 */
-template< typename VertexBase, typename FaceBase >
+template< typename VertexBase, typename FaceBase, typename ConcurrencyTag >
 class Triangulation_data_structure_2 {
 public:
 /// \name Types
 
 /// @{
 
-  typedef Triangulation_data_structure_2<VertexBase,FaceBase>  Tds;
+  typedef Triangulation_data_structure_2<VertexBase,FaceBase,ConcurrencyTag>  Tds;
+
+  /// The concurrency tag.
+  typedef ConcurrencyTag Concurrency_tag;
 
   /// The vertex type.
   ///
@@ -30,6 +30,7 @@
 #include <CGAL/triangulation_assertions.h>
 #include <CGAL/Triangulation_utils_2.h>
 
+#include <CGAL/Concurrent_compact_container.h>
 #include <CGAL/Compact_container.h>
 
 #include <CGAL/Triangulation_ds_face_base_2.h>
@@ -37,15 +38,23 @@
 #include <CGAL/Triangulation_ds_iterators_2.h>
 #include <CGAL/Triangulation_ds_circulators_2.h>
 #include <CGAL/IO/io.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#  include <tbb/scalable_allocator.h>
+#endif
+
+#include <type_traits>
 
 namespace CGAL {
 
 template < class Vb = Triangulation_ds_vertex_base_2<>,
-           class Fb = Triangulation_ds_face_base_2<> >
+           class Fb = Triangulation_ds_face_base_2<>,
+           class Concurrency_tag_ = Sequential_tag >
 class Triangulation_data_structure_2
   :public Triangulation_cw_ccw_2
 {
-  typedef Triangulation_data_structure_2<Vb,Fb>  Tds;
+  typedef Triangulation_data_structure_2<Vb,Fb,Concurrency_tag_>  Tds;
 
   typedef typename Vb::template Rebind_TDS<Tds>::Other  Vertex_base;
   typedef typename Fb::template Rebind_TDS<Tds>::Other  Face_base;
@@ -56,15 +65,17 @@ class Triangulation_data_structure_2
   friend class Triangulation_ds_vertex_circulator_2<Tds>;
 
 public:
+  typedef Concurrency_tag_                           Concurrency_tag;
+
   // Tools to change the Vertex and Face types of the TDS.
   template < typename Vb2 >
   struct Rebind_vertex {
-    typedef Triangulation_data_structure_2<Vb2, Fb>  Other;
+    typedef Triangulation_data_structure_2<Vb2, Fb, Concurrency_tag>  Other;
   };
 
   template < typename Fb2 >
   struct Rebind_face {
-    typedef Triangulation_data_structure_2<Vb, Fb2>  Other;
+    typedef Triangulation_data_structure_2<Vb, Fb2, Concurrency_tag>  Other;
   };
 
   class Face_data {
@@ -86,8 +97,30 @@ public:
   typedef Vertex_base                                Vertex;
   typedef Face_base                                  Face;
 
+  // With `Parallel_tag`, faces and vertices can be created and erased concurrently,
+  // as done by the parallel insertion of `Delaunay_triangulation_2`.
+  // N.B.: Concurrent_compact_container requires TBB
+#ifdef CGAL_LINKED_WITH_TBB
+  typedef typename std::conditional
+  <
+    std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+    Concurrent_compact_container<Face, tbb::scalable_allocator<Face> >,
+    Compact_container<Face>
+  >::type                                            Face_range;
+  typedef typename std::conditional
+  <
+    std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+    Concurrent_compact_container<Vertex, tbb::scalable_allocator<Vertex> >,
+    Compact_container<Vertex>
+  >::type                                            Vertex_range;
+#else
+  CGAL_static_assertion_msg
+    (!(std::is_convertible<Concurrency_tag, Parallel_tag>::value),
+     "In CGAL triangulations, `Parallel_tag` can only be used with the Intel TBB library. "
+     "Make TBB available in the build system and then define the macro `CGAL_LINKED_WITH_TBB`.");
   typedef Compact_container<Face>                    Face_range;
   typedef Compact_container<Vertex>                  Vertex_range;
+#endif
 
   typedef typename Face_range::size_type             size_type;
   typedef typename Face_range::difference_type       difference_type;
@@ -673,21 +706,21 @@ public:
 };
 
 
-template < class Vb, class Fb>
-Triangulation_data_structure_2<Vb,Fb> ::
+template < class Vb, class Fb, class Ct>
+Triangulation_data_structure_2<Vb,Fb,Ct> ::
 Triangulation_data_structure_2()
   : _dimension(-2)
 { }
 
-template < class Vb, class Fb>
-Triangulation_data_structure_2<Vb,Fb> ::
+template < class Vb, class Fb, class Ct>
+Triangulation_data_structure_2<Vb,Fb,Ct> ::
 Triangulation_data_structure_2(const Tds &tds)
 {
   copy_tds(tds);
 }
 
-template < class Vb, class Fb>
-Triangulation_data_structure_2<Vb,Fb> ::
+template < class Vb, class Fb, class Ct>
+Triangulation_data_structure_2<Vb,Fb,Ct> ::
 Triangulation_data_structure_2(Tds &&tds)
     noexcept(noexcept(Face_range(std::move(tds._faces))) &&
              noexcept(Vertex_range(std::move(tds._vertices))))
@@ -697,17 +730,17 @@ Triangulation_data_structure_2(Tds &&tds)
 {
 }
 
-template < class Vb, class Fb>
-Triangulation_data_structure_2<Vb,Fb> ::
+template < class Vb, class Fb, class Ct>
+Triangulation_data_structure_2<Vb,Fb,Ct> ::
 ~Triangulation_data_structure_2()
 {
   clear();
 }
 
 //copy-assignment
-template < class Vb, class Fb>
-Triangulation_data_structure_2<Vb,Fb>&
-Triangulation_data_structure_2<Vb,Fb> ::
+template < class Vb, class Fb, class Ct>
+Triangulation_data_structure_2<Vb,Fb,Ct>&
+Triangulation_data_structure_2<Vb,Fb,Ct> ::
 operator= (const Tds &tds)
 {
   copy_tds(tds);
@@ -715,9 +748,9 @@ operator= (const Tds &tds)
 }
 
 //move-assignment
-template < class Vb, class Fb>
-Triangulation_data_structure_2<Vb,Fb>&
-Triangulation_data_structure_2<Vb,Fb> ::
+template < class Vb, class Fb, class Ct>
+Triangulation_data_structure_2<Vb,Fb,Ct>&
+Triangulation_data_structure_2<Vb,Fb,Ct> ::
 operator= (Tds &&tds) noexcept(noexcept(Tds(std::move(tds))))
 {
   _faces = std::move(tds._faces);
@@ -726,9 +759,9 @@ operator= (Tds &&tds) noexcept(noexcept(Tds(std::move(tds))))
   return *this;
 }
 
-template <  class Vb, class Fb>
+template <  class Vb, class Fb, class Ct>
 void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 clear()
 {
   faces().clear();
@@ -737,9 +770,9 @@ clear()
   return;
 }
 
-template <  class Vb, class Fb>
+template <  class Vb, class Fb, class Ct>
 void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 swap(Tds &tds)
 {
   CGAL_triangulation_expensive_precondition(tds.is_valid() && is_valid());
@@ -750,20 +783,20 @@ swap(Tds &tds)
 }
 
 //ACCESS FUNCTIONS
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 inline
-typename Triangulation_data_structure_2<Vb,Fb>::size_type
-Triangulation_data_structure_2<Vb,Fb> ::
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::size_type
+Triangulation_data_structure_2<Vb,Fb,Ct> ::
 number_of_faces() const
 {
   if (dimension() < 2) return 0;
   return faces().size();
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 inline
-typename Triangulation_data_structure_2<Vb,Fb>::size_type
-Triangulation_data_structure_2<Vb,Fb>::
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::size_type
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 number_of_edges() const
 {
   switch (dimension()) {
@@ -773,17 +806,17 @@ number_of_edges() const
   }
 }
 
-template <class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::size_type
-Triangulation_data_structure_2<Vb,Fb>::
+template <class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::size_type
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 number_of_full_dim_faces() const
 {
   return faces().size();
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 inline bool
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 is_vertex(Vertex_handle v) const
 {
   Vertex_iterator vit = vertices_begin();
@@ -792,9 +825,9 @@ is_vertex(Vertex_handle v) const
   return v == vit;
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 inline bool
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 is_edge(Face_handle fh, int i) const
 {
   if ( dimension() == 0 )  return false;
@@ -805,9 +838,9 @@ is_edge(Face_handle fh, int i) const
   return fh == fit;
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 bool
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 is_edge(Vertex_handle va, Vertex_handle vb) const
 // returns true (false) if the line segment ab is (is not) an edge of t
 //It is assumed that va is a vertex of t
@@ -821,9 +854,9 @@ is_edge(Vertex_handle va, Vertex_handle vb) const
 }
 
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 bool
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 is_edge(Vertex_handle va, Vertex_handle vb,
         Face_handle &fr,  int & i) const
 // assume va is a vertex of t
@@ -848,9 +881,9 @@ is_edge(Vertex_handle va, Vertex_handle vb,
   return false;
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 inline bool
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 is_face(Face_handle fh) const
 {
   if (dimension() < 2)  return false;
@@ -859,9 +892,9 @@ is_face(Face_handle fh) const
   return fh == fit;
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 inline bool
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 is_face(Vertex_handle v1,
         Vertex_handle v2,
         Vertex_handle v3) const
@@ -870,9 +903,9 @@ is_face(Vertex_handle v1,
   return is_face(v1,v2,v3,f);
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 bool
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 is_face(Vertex_handle v1,
         Vertex_handle v2,
         Vertex_handle v3,
@@ -890,9 +923,9 @@ is_face(Vertex_handle v1,
   return false;
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 flip(Face_handle f, int i)
 {
   CGAL_triangulation_precondition( dimension()==2);
@@ -925,9 +958,9 @@ flip(Face_handle f, int i)
   }
 }
 
-template < class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template < class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 insert_first( )
 {
   CGAL_triangulation_precondition( number_of_vertices() == 0 &&
@@ -935,9 +968,9 @@ insert_first( )
   return insert_dim_up();
 }
 
-template < class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template < class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 insert_second()
 {
   CGAL_triangulation_precondition( number_of_vertices() == 1 &&
@@ -947,9 +980,9 @@ insert_second()
 }
 
 
-template <  class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template <  class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 insert_in_face(Face_handle f)
   // New vertex will replace f->vertex(0) in face f
 {
@@ -986,9 +1019,9 @@ insert_in_face(Face_handle f)
 }
 
 
-template <  class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template <  class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 insert_in_edge(Face_handle f, int i)
   //insert in the edge opposite to vertex i of face f
 {
@@ -1020,9 +1053,9 @@ insert_in_edge(Face_handle f, int i)
 }
 
 
-template <  class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template <  class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 insert_dim_up(Vertex_handle w,  bool orient)
 {
   // the following function insert
@@ -1124,9 +1157,9 @@ insert_dim_up(Vertex_handle w,  bool orient)
 }
 
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 remove_degree_3(Vertex_handle v, Face_handle f)
 // remove a vertex of degree 3
 {
@@ -1172,9 +1205,9 @@ remove_degree_3(Vertex_handle v, Face_handle f)
   delete_vertex(v);
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 dim_down(Face_handle f, int i)
 {
   CGAL_triangulation_expensive_precondition( is_valid() );
@@ -1219,9 +1252,9 @@ dim_down(Face_handle f, int i)
   v->set_face(f);
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 remove_dim_down(Vertex_handle v)
 {
   Face_handle f;
@@ -1277,9 +1310,9 @@ remove_dim_down(Vertex_handle v)
   return;
 }
 
-template <  class Vb, class Fb>
+template <  class Vb, class Fb, class Ct>
 void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 remove_1D(Vertex_handle v)
 {
   CGAL_triangulation_precondition( dimension() == 1 &&
@@ -1299,9 +1332,9 @@ remove_1D(Vertex_handle v)
 
 
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 inline void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 remove_second(Vertex_handle v)
 {
   CGAL_triangulation_precondition(number_of_vertices()== 2 &&
@@ -1311,9 +1344,9 @@ remove_second(Vertex_handle v)
 }
 
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 inline void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 remove_first(Vertex_handle v)
 {
   CGAL_triangulation_precondition(number_of_vertices()== 1 &&
@@ -1322,10 +1355,10 @@ remove_first(Vertex_handle v)
   return;
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 inline
-typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle
-Triangulation_data_structure_2<Vb,Fb>::
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 star_hole(List_edges& hole)
 {
   Vertex_handle newv = create_vertex();
@@ -1333,9 +1366,9 @@ star_hole(List_edges& hole)
   return newv;
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 star_hole(Vertex_handle newv, List_edges& hole)
   // star the hole represented by hole around newv
   // the triangulation is assumed to have dim=2
@@ -1346,9 +1379,9 @@ star_hole(Vertex_handle newv, List_edges& hole)
   return;
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 make_hole(Vertex_handle v, List_edges& hole)
   // delete the faces incident to v and v
   // and return the dscription of the hole in hole
@@ -1385,61 +1418,61 @@ make_hole(Vertex_handle v, List_edges& hole)
   return;
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 inline
-typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle
-Triangulation_data_structure_2<Vb,Fb>::
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 create_vertex()
 {
   return vertices().emplace();
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 inline
-typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle
-Triangulation_data_structure_2<Vb,Fb>::
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 create_vertex(const Vertex &v)
 {
   return vertices().insert(v);
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 inline
-typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle
-Triangulation_data_structure_2<Vb,Fb>::
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 create_vertex(Vertex_handle vh)
 {
   return vertices().insert(*vh);
 }
 
-template <class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Face_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template <class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Face_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 create_face()
 {
   return faces().emplace();
 }
 
-template <class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Face_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template <class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Face_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 create_face(const Face& f)
 {
   return faces().insert(f);
 }
 
-template <class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Face_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template <class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Face_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 create_face( Face_handle fh)
 {
   return create_face(*fh);
 }
 
 
-template <class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Face_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template <class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Face_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 create_face(Face_handle f1, int i1,
             Face_handle f2, int i2,
             Face_handle f3, int i3)
@@ -1454,9 +1487,9 @@ create_face(Face_handle f1, int i1,
   return newf;
 }
 
-template <class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Face_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template <class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Face_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 create_face(Face_handle f1, int i1, Face_handle f2, int i2)
 {
   Face_handle newf = faces().emplace(f1->vertex(cw(i1)),
@@ -1468,9 +1501,9 @@ create_face(Face_handle f1, int i1, Face_handle f2, int i2)
   return newf;
 }
 
-template <class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Face_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template <class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Face_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 create_face(Face_handle f1, int i1, Vertex_handle v)
 {
   Face_handle newf = create_face();
@@ -1481,18 +1514,18 @@ create_face(Face_handle f1, int i1, Vertex_handle v)
 }
 
 
-template <class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Face_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template <class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Face_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 create_face(Vertex_handle v1, Vertex_handle v2, Vertex_handle v3)
 {
   Face_handle newf = faces().emplace(v1, v2, v3);
   return newf;
 }
 
-template <class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Face_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template <class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Face_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 create_face(Vertex_handle v1, Vertex_handle v2, Vertex_handle v3,
             Face_handle f1, Face_handle f2, Face_handle f3)
 {
@@ -1501,9 +1534,9 @@ create_face(Vertex_handle v1, Vertex_handle v2, Vertex_handle v3,
   return(newf);
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 inline void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 set_adjacency(Face_handle f0, int i0, Face_handle f1, int i1) const
 {
   CGAL_triangulation_assertion(i0 >= 0 && i0 <= dimension());
@@ -1513,9 +1546,9 @@ set_adjacency(Face_handle f0, int i0, Face_handle f1, int i1) const
   f1->set_neighbor(i1,f0);
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 inline void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 delete_face(Face_handle f)
 {
   CGAL_triangulation_expensive_precondition( dimension() != 2 || is_face(f));
@@ -1525,9 +1558,9 @@ delete_face(Face_handle f)
   faces().erase(f);
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 inline void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 delete_vertex(Vertex_handle v)
 {
   CGAL_triangulation_expensive_precondition( is_vertex(v) );
@@ -1536,9 +1569,9 @@ delete_vertex(Vertex_handle v)
 
 // split and join operations
 
-template <class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Fourtuple
-Triangulation_data_structure_2<Vb,Fb>::
+template <class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Fourtuple
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 split_vertex(Vertex_handle v, Face_handle f1, Face_handle g1)
 {
   /*
@@ -1663,9 +1696,9 @@ split_vertex(Vertex_handle v, Face_handle f1, Face_handle g1)
   return Fourtuple(v1, v2, f, g);
 }
 
-template <class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template <class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 join_vertices(Face_handle f, int i, Vertex_handle v)
 {
   CGAL_triangulation_expensive_precondition( is_valid() );
@@ -1810,9 +1843,9 @@ join_vertices(Face_handle f, int i, Vertex_handle v)
 }
 
 // insert_degree_2 and remove_degree_2 operations
-template <class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template <class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 insert_degree_2(Face_handle f, int i)
 {
   /*
@@ -1863,9 +1896,9 @@ insert_degree_2(Face_handle f, int i)
   return v;
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 remove_degree_2(Vertex_handle v)
 {
   CGAL_precondition( degree(v) == 2 );
@@ -1901,9 +1934,9 @@ remove_degree_2(Vertex_handle v)
 }
 
 // CHECKING
-template <  class Vb, class Fb>
+template <  class Vb, class Fb, class Ct>
 bool
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 is_valid(bool verbose, int level) const
 {
   if(number_of_vertices() == 0){
@@ -1982,10 +2015,10 @@ is_valid(bool verbose, int level) const
   return result;
 }
 
-template <class Vb, class Fb>
+template <class Vb, class Fb, class Ct>
 template <class TDS_src,class ConvertVertex,class ConvertFace>
-typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle
-Triangulation_data_structure_2<Vb,Fb>::
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 copy_tds(const TDS_src& tds_src,
         typename TDS_src::Vertex_handle vert,
         const ConvertVertex& convert_vertex,
@@ -2089,10 +2122,10 @@ namespace internal { namespace TDS_2{
   };
 } } //namespace internal::TDS_2
 
-template <  class Vb, class Fb>
+template <  class Vb, class Fb, class Ct>
 template < class TDS_src>
-typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle
-Triangulation_data_structure_2<Vb,Fb>::
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 copy_tds(const TDS_src &src, typename TDS_src::Vertex_handle vh)
   // return the vertex corresponding to vh in the new tds
 {
@@ -2102,9 +2135,9 @@ copy_tds(const TDS_src &src, typename TDS_src::Vertex_handle vh)
   return copy_tds(src,vh,setv,setf);
 }
 
-template < class Vb, class Fb>
+template < class Vb, class Fb, class Ct>
 void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 file_output( std::ostream& os, Vertex_handle v, bool skip_first) const
 {
   // ouput to a file
@@ -2173,9 +2206,9 @@ file_output( std::ostream& os, Vertex_handle v, bool skip_first) const
 }
 
 
-template < class Vb, class Fb>
-typename Triangulation_data_structure_2<Vb,Fb>::Vertex_handle
-Triangulation_data_structure_2<Vb,Fb>::
+template < class Vb, class Fb, class Ct>
+typename Triangulation_data_structure_2<Vb,Fb,Ct>::Vertex_handle
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 file_input( std::istream& is, bool skip_first)
 {
   //input from file
@@ -2238,9 +2271,9 @@ file_input( std::istream& is, bool skip_first)
 }
 
 
-template < class Vb, class Fb>
+template < class Vb, class Fb, class Ct>
 void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 vrml_output( std::ostream& os, Vertex_handle v, bool skip_infinite) const
 {
   // ouput to a vrml file style
@@ -2295,9 +2328,9 @@ vrml_output( std::ostream& os, Vertex_handle v, bool skip_infinite) const
    return;
 }
 
-template < class Vb, class Fb>
+template < class Vb, class Fb, class Ct>
 void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 set_adjacency(Face_handle fh,
               int ih,
               std::map< Vh_pair, Edge>& edge_map)
@@ -2322,9 +2355,9 @@ set_adjacency(Face_handle fh,
 
 
 
-template < class Vb, class Fb>
+template < class Vb, class Fb, class Ct>
 void
-Triangulation_data_structure_2<Vb,Fb>::
+Triangulation_data_structure_2<Vb,Fb,Ct>::
 reorient_faces()
 {
   // reorient the faces of a triangulation
@@ -2361,20 +2394,20 @@ reorient_faces()
 }
 
 
-template <  class Vb, class Fb>
+template <  class Vb, class Fb, class Ct>
 std::istream&
 operator>>(std::istream& is,
-           Triangulation_data_structure_2<Vb,Fb>& tds)
+           Triangulation_data_structure_2<Vb,Fb,Ct>& tds)
 {
   tds.file_input(is);
   return is;
 }
 
 
-template <  class Vb, class Fb>
+template <  class Vb, class Fb, class Ct>
 std::ostream&
 operator<<(std::ostream& os,
-           const Triangulation_data_structure_2<Vb,Fb>  &tds)
+           const Triangulation_data_structure_2<Vb,Fb,Ct>  &tds)
 {
    tds.file_output(os);
    return os;
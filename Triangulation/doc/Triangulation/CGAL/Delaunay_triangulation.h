@@ -94,6 +94,9 @@ Inserts the points found in range `[s,e)` in the Delaunay triangulation
 and ensures that the empty-ball property is preserved.
 Returns the number of vertices actually inserted. (If more than one vertex share
 the same position in space, only one insertion is counted.)
+If the triangulation data structure has the `Parallel_tag` as `Concurrency_tag`
+and \ref thirdpartyTBB is available, the points are inserted in parallel,
+once sequentially inserted ones span the full dimension.
 \tparam ForwardIterator must be an input iterator with the value type `Point`.
 */
 template< typename ForwardIterator >
@@ -34,6 +34,14 @@ third parameter be specified. It also accepts the tag `CGAL::Default` as
 third parameter. In both cases, `TriangulationDSFullCell_` defaults to
 `CGAL::Triangulation_ds_full_cell<>`.
 
+\tparam ConcurrencyTag enables the use of a concurrent
+container to store vertices and full cells. It can be `Sequential_tag` (use of a
+`Compact_container` to store vertices and full cells) or `Parallel_tag`
+(use of a `Concurrent_compact_container`). If it is
+`Parallel_tag`, the points inserted with `Delaunay_triangulation::insert(s, e)`
+are inserted in parallel. `Parallel_tag` requires \ref thirdpartyTBB.
+The default value is `Sequential_tag`.
+
 \cgalModels `TriangulationDataStructure`. In addition, the class
 `Triangulation_data_structure` provides the following types and
 methods.
@@ -41,7 +49,7 @@ methods.
 \sa `Triangulation_ds_vertex`
 \sa `Triangulation_ds_full_cell`
 */
-template< typename Dimensionality, typename TriangulationDSVertex_, typename TriangulationDSFullCell_ >
+template< typename Dimensionality, typename TriangulationDSVertex_, typename TriangulationDSFullCell_, typename ConcurrencyTag >
 class Triangulation_data_structure {
 public:
 
@@ -99,6 +107,11 @@ as full cell type.
 template <typename Fcb2>
 using Rebind_full_cell = unspecified_type;
 
+/*!
+The concurrency tag, that is, `ConcurrencyTag`.
+*/
+typedef ConcurrencyTag Concurrency_tag;
+
 /// @}
 
 /// \name Vertex insertion
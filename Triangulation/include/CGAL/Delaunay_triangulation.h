@@ -18,6 +18,7 @@
 
 #include <CGAL/tss.h>
 #include <CGAL/Triangulation.h>
+#include <CGAL/Triangulation/internal/Parallel_insertion.h>
 #include <CGAL/Dimension.h>
 #include <CGAL/Default.h>
 
@@ -81,6 +82,9 @@ public: // PUBLIC NESTED TYPES
 
     typedef typename Base::Locate_type              Locate_type;
 
+    typedef typename internal::Triangulation::
+              Tds_concurrency_tag<TDS>::type        Concurrency_tag;
+
   //Tag to distinguish triangulations with weighted_points
   typedef Tag_false                                 Weighted_tag;
 
@@ -218,7 +222,11 @@ public:
     {
         size_type n = number_of_vertices();
         std::vector<Point> points(start, end);
-        spatial_sort(points.begin(), points.end(), geom_traits());
+        spatial_sort<Concurrency_tag>(points.begin(), points.end(), geom_traits());
+#ifdef CGAL_LINKED_WITH_TBB
+        if( internal::Triangulation::insert_in_parallel(*this, points, Concurrency_tag()) )
+            return number_of_vertices() - n;
+#endif
         Full_cell_handle hint;
         for( typename std::vector<Point>::const_iterator p = points.begin(); p != points.end(); ++p )
         {
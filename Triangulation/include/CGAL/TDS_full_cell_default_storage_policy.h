@@ -78,7 +78,9 @@ struct TFC_data< Vertex_handle, Full_cell_handle, Dimen, TDS_full_cell_default_s
         Vertex_handle mirror;
         typedef typename Vertex_handle::pointer pointer;
         // mirror.set_pointer(reinterpret_cast<pointer>(opp_vertex));
-        mirror = Compact_container<typename Vertex_handle::value_type>
+        // the container of the vertices is a `Compact_container` or a
+        // `Concurrent_compact_container`, depending on the TDS
+        mirror = Vertex_handle::CC
             ::s_iterator_to(*(reinterpret_cast<pointer>(opp_vertex)));
         return mirror;
     }
@@ -0,0 +1,330 @@
+// Copyright (c) 2026  agent <agent@local>.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent <agent@local>
+
+#ifndef CGAL_TRIANGULATION_INTERNAL_PARALLEL_INSERTION_H
+#define CGAL_TRIANGULATION_INTERNAL_PARALLEL_INSERTION_H
+
+#include <CGAL/license/Triangulation.h>
+
+#include <CGAL/tags.h>
+
+#include <boost/mpl/has_xxx.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <CGAL/Bbox_3.h>
+# include <CGAL/Spatial_lock_grid_3.h>
+# include <CGAL/Triangulation.h>
+# include <boost/iterator/transform_iterator.hpp>
+# include <tbb/blocked_range.h>
+# include <tbb/enumerable_thread_specific.h>
+# include <tbb/parallel_for.h>
+# include <algorithm>
+# include <cmath>
+# include <vector>
+#endif
+
+namespace CGAL {
+
+namespace internal {
+namespace Triangulation {
+
+// The concurrency tag of a model of `TriangulationDataStructure`,
+// which is `Sequential_tag` when it does not define one.
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(Has_concurrency_tag, Concurrency_tag, false)
+
+template <class Tds, bool = Has_concurrency_tag<Tds>::value>
+struct Tds_concurrency_tag
+{
+  typedef Sequential_tag type;
+};
+
+template <class Tds>
+struct Tds_concurrency_tag<Tds, true>
+{
+  typedef typename Tds::Concurrency_tag type;
+};
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+// The concurrent insertion of points in a `Delaunay_triangulation` `Tr` of full
+// dimension, whose data structure has the `Parallel_tag`.
+//
+// A vertex is locked with the cell of a `Spatial_lock_grid_3` that contains its first
+// three coordinates. The vertices of a full cell never change, and a full cell is only
+// created, erased, or marked as visited once its vertices are locked. The neighbor across
+// a facet is only modified once the vertices of the facet are locked. Hence, the vertices
+// of a full cell can be read once one of its vertices is locked, and the neighbor across
+// a facet once the vertices of the facet are locked.
+template <class Tr>
+class Parallel_insertion
+{
+public:
+  typedef typename Tr::Geom_traits                      Geom_traits;
+  typedef typename Tr::Point                            Point;
+  typedef typename Tr::Vertex_handle                    Vertex_handle;
+  typedef typename Tr::Full_cell_handle                 Full_cell_handle;
+  typedef typename Tr::Facet                            Facet;
+
+  typedef Spatial_lock_grid_3<Tag_priority_blocking>    Lock_data_structure;
+
+  // The first three coordinates of a point, completed with zeros.
+  struct Lock_point
+  {
+    double coords[3];
+
+    Lock_point(const Tr& tr, const Point& p)
+    {
+      typename Geom_traits::Compute_coordinate_d coord =
+        tr.geom_traits().compute_coordinate_d_object();
+      const int d = (std::min)(3, tr.maximal_dimension());
+      for(int i=0; i<3; ++i)
+        coords[i] = (i < d) ? CGAL::to_double(coord(p, i)) : 0.;
+    }
+
+    double x() const { return coords[0]; }
+    double y() const { return coords[1]; }
+    double z() const { return coords[2]; }
+  };
+
+  // The infinite vertex has no point, and locks the first cell of the grid.
+  static bool try_lock_vertex(const Tr& tr, Vertex_handle v, Lock_data_structure& locks)
+  {
+    return tr.is_infinite(v) ? locks.try_lock(0) : locks.try_lock(Lock_point(tr, v->point()));
+  }
+
+  static bool try_lock_full_cell(const Tr& tr, Full_cell_handle c, Lock_data_structure& locks)
+  {
+    for(int i=0; i<=tr.current_dimension(); ++i)
+      if(! try_lock_vertex(tr, c->vertex(i), locks))
+        return false;
+    return true;
+  }
+
+  // The grid must not be flat, even if the points are.
+  static Bbox_3 bbox(const Tr& tr, const std::vector<Point>& points)
+  {
+    Bbox_3 bbox;
+    for(const Point& p : points) {
+      const Lock_point lp(tr, p);
+      bbox += Bbox_3(lp.x(), lp.y(), lp.z(), lp.x(), lp.y(), lp.z());
+    }
+    return Bbox_3(bbox.xmin(), bbox.ymin(), bbox.zmin(),
+                  (std::max)(bbox.xmax(), bbox.xmin() + 1),
+                  (std::max)(bbox.ymax(), bbox.ymin() + 1),
+                  (std::max)(bbox.zmax(), bbox.zmin() + 1));
+  }
+
+  // about 16 points per cell of the grid, when the triangulation is 3-dimensional
+  static int num_grid_cells_per_axis(std::size_t num_points)
+  {
+    return (std::max)(8, (std::min)(64, static_cast<int>(std::cbrt(num_points / 16.))));
+  }
+
+  // Inserts `p` with the Bowyer-Watson algorithm, that is, by starring the boundary of its
+  // conflict zone, in a triangulation of full dimension that is modified concurrently by
+  // other threads. The vertices of all the full cells of the walk from `hint` to `p`,
+  // of the conflict zone, and of its boundary are locked, so that, when a full cell is
+  // entered through a facet, only its opposite vertex has to be locked. If a vertex cannot
+  // be locked, the triangulation is not modified, and `could_lock_zone` is set to `false`.
+  static Vertex_handle insert_in_locked_zone(Tr& tr,
+                                             const Point& p,
+                                             Vertex_handle hint,
+                                             Lock_data_structure& locks,
+                                             std::vector<Full_cell_handle>& cells,
+                                             bool& could_lock_zone)
+  {
+    CGAL_precondition(tr.current_dimension() == tr.maximal_dimension());
+    const int cur_dim = tr.current_dimension();
+    could_lock_zone = false;
+
+    if(! try_lock_vertex(tr, hint, locks))
+      return Vertex_handle();
+    Full_cell_handle c = hint->full_cell();
+    if(! try_lock_full_cell(tr, c, locks))
+      return Vertex_handle();
+    if(tr.is_infinite(c)) {
+      c = c->neighbor(c->index(tr.infinite_vertex()));
+      if(! try_lock_full_cell(tr, c, locks))
+        return Vertex_handle();
+    }
+
+    // Walk to a full cell that contains `p`, or to an infinite full cell when `p` is
+    // outside the convex hull. The visibility walk terminates in a Delaunay triangulation.
+    typename Geom_traits::Orientation_d orientation = tr.geom_traits().orientation_d_object();
+    while(! tr.is_infinite(c)) {
+      int i = 0;
+      for( ; i<=cur_dim; ++i) {
+        Substitute_point_in_vertex_iterator<
+          typename Tr::Full_cell::Vertex_handle_const_iterator> spivi(c->vertex(i), &p);
+        if(orientation(boost::make_transform_iterator(c->vertices_begin(), spivi),
+                       boost::make_transform_iterator(c->vertices_begin() + cur_dim + 1, spivi))
+           == NEGATIVE)
+          break;
+      }
+      if(i > cur_dim)
+        break;
+      // the vertices of the common facet are already locked
+      if(! try_lock_vertex(tr, c->mirror_vertex(i, cur_dim), locks))
+        return Vertex_handle();
+      c = c->neighbor(i);
+    }
+    if(! tr.is_infinite(c)) {
+      typename Geom_traits::Compare_lexicographically_d compare =
+        tr.geom_traits().compare_lexicographically_d_object();
+      for(int i=0; i<=cur_dim; ++i)
+        if(compare(p, c->vertex(i)->point()) == EQUAL) {
+          could_lock_zone = true;
+          return c->vertex(i);
+        }
+    }
+    CGAL_assertion(tr.is_in_conflict(p, c));
+
+    // Breadth-first traversal of the conflict zone, whose full cells are marked as visited.
+    cells.clear();
+    cells.push_back(c);
+    c->tds_data().mark_visited();
+    Facet boundary_facet;
+    for(std::size_t k=0; k<cells.size(); ++k) {
+      Full_cell_handle s = cells[k];
+      for(int i=0; i<=cur_dim; ++i) {
+        Full_cell_handle n = s->neighbor(i);
+        if(n->tds_data().is_visited())
+          continue;
+        if(! try_lock_vertex(tr, s->mirror_vertex(i, cur_dim), locks)) {
+          for(Full_cell_handle cc : cells)
+            cc->tds_data().clear_visited();
+          return Vertex_handle();
+        }
+        if(tr.is_in_conflict(p, n)) {
+          n->tds_data().mark_visited();
+          cells.push_back(n);
+        } else {
+          boundary_facet = Facet(s, i);
+        }
+      }
+    }
+
+    could_lock_zone = true;
+    Vertex_handle v = tr.tds().insert_in_hole(cells.begin(), cells.end(), boundary_facet);
+    v->set_point(p);
+    return v;
+  }
+
+  typedef tbb::enumerable_thread_specific<std::vector<std::size_t> >  Deferred_points;
+
+  // Functor for the parallel insertion of a range of points. The walk to the first point
+  // of a range starts from the sample vertex that precedes it in the spatial sort.
+  // As the conflict zones grow with the dimension, so do the conflicts between the
+  // threads: a point whose zone cannot be locked after a few attempts is deferred.
+  class Insert_point
+  {
+    Tr& m_tr;
+    const std::vector<Point>& m_points;
+    const std::vector<Vertex_handle>& m_sample;
+    Lock_data_structure& m_locks;
+    Deferred_points& m_deferred;
+
+  public:
+    Insert_point(Tr& tr,
+                 const std::vector<Point>& points,
+                 const std::vector<Vertex_handle>& sample,
+                 Lock_data_structure& locks,
+                 Deferred_points& deferred)
+      : m_tr(tr), m_points(points), m_sample(sample), m_locks(locks), m_deferred(deferred)
+    {}
+
+    void operator()(const tbb::blocked_range<std::size_t>& r) const
+    {
+      Vertex_handle hint = m_sample[r.begin() * m_sample.size() / m_points.size()];
+      std::vector<Full_cell_handle> cells;
+      for(std::size_t i_point = r.begin() ; i_point != r.end() ; ++i_point)
+      {
+        bool could_lock_zone = false;
+        for(int attempt = 0; ! could_lock_zone; ++attempt)
+        {
+          if(attempt == 8) {
+            m_deferred.local().push_back(i_point);
+            break;
+          }
+          Vertex_handle v = insert_in_locked_zone(m_tr, m_points[i_point], hint, m_locks,
+                                                  cells, could_lock_zone);
+          m_locks.unlock_all_points_locked_by_this_thread();
+          if(could_lock_zone)
+            hint = v;
+        }
+      }
+    }
+  };
+
+  // Inserts the spatially sorted `points` in `tr`.
+  // A sample of the points, spread along the sort, is first inserted sequentially,
+  // so that the triangulation has full dimension and its convex hull is almost complete
+  // before the concurrent insertion of all the points, in which the sample points are
+  // duplicates. The deferred points are finally inserted sequentially, in the order of the sort.
+  static void insert(Tr& tr, const std::vector<Point>& points)
+  {
+    const std::size_t num_points = points.size();
+    const std::size_t sample_size = (std::min)(num_points, std::size_t(100));
+
+    std::vector<Vertex_handle> sample;
+    Full_cell_handle c;
+    for(std::size_t k=0; k<sample_size; ++k) {
+      sample.push_back(tr.insert(points[k * num_points / sample_size], c));
+      c = sample.back()->full_cell();
+    }
+    std::size_t i = 0;
+    while((tr.current_dimension() < tr.maximal_dimension() || tr.current_dimension() < 2)
+          && i < num_points) {
+      c = tr.insert(points[i], c)->full_cell();
+      ++i;
+    }
+    if(i == num_points)
+      return;
+
+    Deferred_points deferred;
+    {
+      Lock_data_structure locks(bbox(tr, points), num_grid_cells_per_axis(num_points));
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(i, num_points),
+                        Insert_point(tr, points, sample, locks, deferred));
+    }
+
+    std::vector<std::size_t> indices;
+    for(const std::vector<std::size_t>& d : deferred)
+      indices.insert(indices.end(), d.begin(), d.end());
+    std::sort(indices.begin(), indices.end());
+    for(std::size_t k : indices)
+      c = tr.insert(points[k], c)->full_cell();
+  }
+};
+
+// Inserts the spatially sorted `points` in `tr` in parallel, when the triangulation data
+// structure has the `Parallel_tag`, and returns `false` otherwise.
+template <class Tr>
+bool insert_in_parallel(Tr&, const std::vector<typename Tr::Point>&, Sequential_tag)
+{
+  return false;
+}
+
+template <class Tr>
+bool insert_in_parallel(Tr& tr, const std::vector<typename Tr::Point>& points, Parallel_tag)
+{
+  Parallel_insertion<Tr>::insert(tr, points);
+  return true;
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+} // namespace Triangulation
+} // namespace internal
+
+} // namespace CGAL
+
+#endif // CGAL_TRIANGULATION_INTERNAL_PARALLEL_INSERTION_H
@@ -18,6 +18,10 @@
 #include <CGAL/Compact_container.h>
 #include <CGAL/Dimension.h>
 #include <CGAL/array.h>
+
+#include <boost/container/small_vector.hpp>
+
+#include <cstddef>
 #include <vector>
 
 namespace CGAL {
@@ -72,13 +76,17 @@ struct S_or_D_array< Containee, Dimension_tag< D >, WithCompactContainerHelper >
     }
 };
 
-// The case of dynamic size
+// The case of dynamic size.
+// The elements are stored in place up to `S_or_D_array_inline_capacity`, that is, for
+// the full cells and faces of triangulations of dimension up to 7, so that creating a
+// full cell does not allocate memory besides the one of its Compact_container.
+const std::size_t S_or_D_array_inline_capacity = 8;
+
 template< typename Containee >
 struct S_or_D_array< Containee, Dynamic_dimension_tag, false >
-: public std::vector<Containee>
+: public boost::container::small_vector<Containee, S_or_D_array_inline_capacity>
 {
-    typedef std::vector<Containee> Base;
-    // TODO: maybe we should use some "small-vector-optimized" class.
+    typedef boost::container::small_vector<Containee, S_or_D_array_inline_capacity> Base;
     S_or_D_array(const int d)
     : Base(d)
     {}
@@ -90,9 +98,9 @@ struct S_or_D_array< Containee, Dynamic_dimension_tag, false >
 // The case of dynamic size with for_compact_container
 template< typename Containee >
 struct S_or_D_array< Containee, Dynamic_dimension_tag, true >
-: public std::vector<Containee>
+: public boost::container::small_vector<Containee, S_or_D_array_inline_capacity>
 {
-    typedef std::vector<Containee> Base;
+    typedef boost::container::small_vector<Containee, S_or_D_array_inline_capacity> Base;
     S_or_D_array(const int d)
     : Base(d), fcc_(nullptr)
     {}
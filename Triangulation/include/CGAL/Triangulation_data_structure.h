@@ -20,6 +20,8 @@
 #include <CGAL/Default.h>
 #include <CGAL/iterator.h>
 #include <CGAL/Compact_container.h>
+#include <CGAL/Concurrent_compact_container.h>
+#include <CGAL/tags.h>
 #include <CGAL/Triangulation_face.h>
 #include <CGAL/Triangulation_ds_vertex.h>
 #include <CGAL/Triangulation_ds_full_cell.h>
@@ -27,35 +29,42 @@
 #include <CGAL/Triangulation/internal/utilities.h>
 #include <CGAL/Triangulation/internal/Triangulation_ds_iterators.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#  include <tbb/scalable_allocator.h>
+#endif
+
 #include <algorithm>
 #include <vector>
 #include <queue>
 #include <set>
+#include <type_traits>
 
 namespace CGAL {
 
 template<   class Dimen,
             class Vb = Default,
-            class Fcb = Default >
+            class Fcb = Default,
+            class Ct = Sequential_tag >
 class Triangulation_data_structure
 {
-    typedef Triangulation_data_structure<Dimen, Vb, Fcb>                     Self;
+    typedef Triangulation_data_structure<Dimen, Vb, Fcb, Ct>                 Self;
     typedef typename Default::Get<Vb, Triangulation_ds_vertex<> >::type     V_base;
     typedef typename Default::Get<Fcb, Triangulation_ds_full_cell<> >::type  FC_base;
 
 public:
     typedef typename V_base::template Rebind_TDS<Self>::Other   Vertex; /* Concept */
     typedef typename FC_base::template Rebind_TDS<Self>::Other  Full_cell; /* Concept */
+    typedef Ct                                                  Concurrency_tag;
 
   // Tools to change the Vertex and Cell types of the TDS.
   template < typename Vb2 >
   struct Rebind_vertex {
-    typedef Triangulation_data_structure<Dimen, Vb2, Fcb>  Other;
+    typedef Triangulation_data_structure<Dimen, Vb2, Fcb, Ct>  Other;
   };
 
   template < typename Fcb2 >
   struct Rebind_full_cell {
-    typedef Triangulation_data_structure<Dimen, Vb, Fcb2>  Other;
+    typedef Triangulation_data_structure<Dimen, Vb, Fcb2, Ct>  Other;
   };
 
 
@@ -80,8 +89,29 @@ public:
     };
 
 protected:
+    // With `Parallel_tag`, vertices and full cells can be created and erased
+    // concurrently, as done by the parallel insertion of `Delaunay_triangulation`.
+#ifdef CGAL_LINKED_WITH_TBB
+    typedef typename std::conditional
+    <
+      std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+      Concurrent_compact_container<Vertex, tbb::scalable_allocator<Vertex> >,
+      Compact_container<Vertex>
+    >::type                             Vertex_container;
+    typedef typename std::conditional
+    <
+      std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+      Concurrent_compact_container<Full_cell, tbb::scalable_allocator<Full_cell> >,
+      Compact_container<Full_cell>
+    >::type                             Full_cell_container;
+#else
+    CGAL_static_assertion_msg
+      (!(std::is_convertible<Concurrency_tag, Parallel_tag>::value),
+       "In CGAL triangulations, `Parallel_tag` can only be used with the Intel TBB library. "
+       "Make TBB available in the build system and then define the macro `CGAL_LINKED_WITH_TBB`.");
     typedef Compact_container<Vertex>   Vertex_container;
     typedef Compact_container<Full_cell>  Full_cell_container;
+#endif
 
 public:
     typedef Dimen                      Maximal_dimension;
@@ -622,10 +652,10 @@ public:
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 // - - - - - - - - - - - - - - - - - - - - - - - - THE GATHERING METHODS
 
-template< class Dim, class Vb, class Fcb >
+template< class Dim, class Vb, class Fcb, class Ct >
 template< typename OutputIterator >
 OutputIterator
-Triangulation_data_structure<Dim, Vb, Fcb>
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::incident_full_cells(const Face & f, OutputIterator out) const /* Concept */
 {
     // CGAL_expensive_precondition_msg(is_full_cell(f.full_cell()), "the facet does not belong to the Triangulation");
@@ -634,10 +664,10 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     return out;
 }
 
-template< class Dim, class Vb, class Fcb >
+template< class Dim, class Vb, class Fcb, class Ct >
 template< typename OutputIterator >
 OutputIterator
-Triangulation_data_structure<Dim, Vb, Fcb>
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::incident_full_cells(Vertex_const_handle v, OutputIterator out) const /* Concept */
 {
 //    CGAL_expensive_precondition(is_vertex(v));
@@ -647,10 +677,10 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     return incident_full_cells(f, out);
 }
 
-template< class Dim, class Vb, class Fcb >
+template< class Dim, class Vb, class Fcb, class Ct >
 template< typename OutputIterator >
 OutputIterator
-Triangulation_data_structure<Dim, Vb, Fcb>
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::star(const Face & f, OutputIterator out) const /* Concept */
 {
     // CGAL_precondition_msg(is_full_cell(f.full_cell()), "the facet does not belong to the Triangulation");
@@ -659,10 +689,10 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     return out;
 }
 
-template< class Dim, class Vb, class Fcb >
+template< class Dim, class Vb, class Fcb, class Ct >
 template< typename TraversalPredicate, typename OutputIterator >
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Facet
-Triangulation_data_structure<Dim, Vb, Fcb>
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Facet
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::gather_full_cells(Full_cell_handle start,
                     TraversalPredicate & tp,
                     OutputIterator & out) const /* Concept */
@@ -695,10 +725,10 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     return ft;
 }
 
-template< class Dim, class Vb, class Fcb >
+template< class Dim, class Vb, class Fcb, class Ct >
 template< typename OutputIterator, typename Comparator >
 OutputIterator
-Triangulation_data_structure<Dim, Vb, Fcb>
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::incident_faces(Vertex_const_handle v, int dim, OutputIterator out, Comparator cmp, bool upper_faces) const
 {
     CGAL_precondition( 0 < dim );
@@ -773,9 +803,9 @@ Triangulation_data_structure<Dim, Vb, Fcb>
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 // - - - - - - - - - - - - - - - - - - - - - - - - THE REMOVAL METHODS
 
-template <class Dim, class Vb, class Fcb>
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Vertex_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+template <class Dim, class Vb, class Fcb, class Ct>
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Vertex_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::collapse_face(const Face & f) /* Concept */
 {
     const int fd = f.face_dimension();
@@ -795,9 +825,9 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     return v;
 }
 
-template <class Dim, class Vb, class Fcb>
+template <class Dim, class Vb, class Fcb, class Ct>
 void
-Triangulation_data_structure<Dim, Vb, Fcb>
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::remove_decrease_dimension(Vertex_handle v, Vertex_handle star) /* Concept */
 {
     CGAL_assertion( current_dimension() >= -1 );
@@ -866,9 +896,9 @@ Triangulation_data_structure<Dim, Vb, Fcb>
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 // - - - - - - - - - - - - - - - - - - - - - - - - THE INSERTION METHODS
 
-template <class Dim, class Vb, class Fcb>
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Vertex_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+template <class Dim, class Vb, class Fcb, class Ct>
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Vertex_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::insert_in_full_cell(Full_cell_handle s) /* Concept */
 {
     CGAL_precondition(0 < current_dimension());
@@ -898,9 +928,9 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     return v;
 }
 
-template <class Dim, class Vb, class Fcb >
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Vertex_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+template <class Dim, class Vb, class Fcb, class Ct >
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Vertex_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::insert_in_face(const Face & f) /* Concept */
 {
     std::vector<Full_cell_handle> simps;
@@ -909,9 +939,9 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     incident_full_cells(f, out);
     return insert_in_hole(simps.begin(), simps.end(), Facet(f.full_cell(), f.index(0)));
 }
-template <class Dim, class Vb, class Fcb >
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Vertex_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+template <class Dim, class Vb, class Fcb, class Ct >
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Vertex_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::insert_in_facet(const Facet & ft) /* Concept */
 {
     Full_cell_handle s[2];
@@ -922,10 +952,10 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     return insert_in_hole(s, s+2, Facet(s[0], i));
 }
 
-template <class Dim, class Vb, class Fcb >
+template <class Dim, class Vb, class Fcb, class Ct >
 template < typename OutputIterator >
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Full_cell_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Full_cell_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::insert_in_tagged_hole(Vertex_handle v, Facet f,
                         OutputIterator new_full_cells)
 {
@@ -1024,10 +1054,10 @@ Triangulation_data_structure<Dim, Vb, Fcb>
   return new_s;
 }
 
-template< class Dim, class Vb, class Fcb >
+template< class Dim, class Vb, class Fcb, class Ct >
 template< typename Forward_iterator, typename OutputIterator >
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Vertex_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Vertex_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::insert_in_hole(Forward_iterator start, Forward_iterator end, Facet f,
                  OutputIterator out) /* Concept */
 {
@@ -1043,19 +1073,19 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     return v;
 }
 
-template< class Dim, class Vb, class Fcb >
+template< class Dim, class Vb, class Fcb, class Ct >
 template< typename Forward_iterator >
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Vertex_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Vertex_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::insert_in_hole(Forward_iterator start, Forward_iterator end, Facet f) /* Concept */
 {
     Emptyset_iterator out;
     return insert_in_hole(start, end, f, out);
 }
 
-template <class Dim, class Vb, class Fcb>
+template <class Dim, class Vb, class Fcb, class Ct>
 void
-Triangulation_data_structure<Dim, Vb, Fcb>
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::clear_visited_marks(Full_cell_handle start) const // NOT DOCUMENTED
 {
     CGAL_precondition(start != Full_cell_handle());
@@ -1079,8 +1109,8 @@ Triangulation_data_structure<Dim, Vb, Fcb>
     }
 }
 
-template <class Dim, class Vb, class Fcb>
-void Triangulation_data_structure<Dim, Vb, Fcb>
+template <class Dim, class Vb, class Fcb, class Ct>
+void Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::do_insert_increase_dimension(Vertex_handle x, Vertex_handle star)
 {
     Full_cell_handle start = full_cells_begin();
@@ -1153,9 +1183,9 @@ void Triangulation_data_structure<Dim, Vb, Fcb>
         swap_me->swap_vertices(1, 2);
 }
 
-template <class Dim, class Vb, class Fcb>
-typename Triangulation_data_structure<Dim, Vb, Fcb>::Vertex_handle
-Triangulation_data_structure<Dim, Vb, Fcb>
+template <class Dim, class Vb, class Fcb, class Ct>
+typename Triangulation_data_structure<Dim, Vb, Fcb, Ct>::Vertex_handle
+Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::insert_increase_dimension(Vertex_handle star) /* Concept */
 {
     const int prev_cur_dim = current_dimension();
@@ -1198,8 +1228,8 @@ Triangulation_data_structure<Dim, Vb, Fcb>
 // - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 // - - - - - - - - - - - - - - - - - - - - - - - - VALIDITY CHECKS
 
-template <class Dimen, class Vb, class Fcb>
-bool Triangulation_data_structure<Dimen, Vb, Fcb>
+template <class Dimen, class Vb, class Fcb, class Ct>
+bool Triangulation_data_structure<Dimen, Vb, Fcb, Ct>
 ::is_valid(bool verbose, int /* level */) const /* Concept */
 {
     Full_cell_const_handle s, t;
@@ -1287,9 +1317,9 @@ bool Triangulation_data_structure<Dimen, Vb, Fcb>
 // - - - - - - - - - - - - - - - - - - - - - - - - INPUT / OUTPUT
 
 // NOT DOCUMENTED
-template <class Dim, class Vb, class Fcb>
+template <class Dim, class Vb, class Fcb, class Ct>
 template <class OutStream>
-void Triangulation_data_structure<Dim, Vb, Fcb>
+void Triangulation_data_structure<Dim, Vb, Fcb, Ct>
 ::write_graph(OutStream & os)
 {
     std::vector<std::set<int> > edges;
@@ -1334,9 +1364,9 @@ void Triangulation_data_structure<Dim, Vb, Fcb>
 }
 
 // NOT DOCUMENTED...
-template<class Dimen, class Vb, class Fcb>
+template<class Dimen, class Vb, class Fcb, class Ct>
 std::istream &
-Triangulation_data_structure<Dimen, Vb, Fcb>
+Triangulation_data_structure<Dimen, Vb, Fcb, Ct>
 ::read_full_cells(std::istream & is, const std::vector<Vertex_handle> & vertices)
 {
     std::size_t m; // number of full_cells
@@ -1414,9 +1444,9 @@ Triangulation_data_structure<Dimen, Vb, Fcb>
 }
 
 // NOT DOCUMENTED...
-template<class Dimen, class Vb, class Fcb>
+template<class Dimen, class Vb, class Fcb, class Ct>
 std::ostream &
-Triangulation_data_structure<Dimen, Vb, Fcb>
+Triangulation_data_structure<Dimen, Vb, Fcb, Ct>
 ::write_full_cells(std::ostream & os, std::map<Vertex_const_handle, int> & index_of_vertex) const
 {
     std::map<Full_cell_const_handle, int> index_of_full_cell;
@@ -1471,9 +1501,9 @@ Triangulation_data_structure<Dimen, Vb, Fcb>
 
 // FUNCTIONS THAT ARE NOT MEMBER FUNCTIONS:
 
-template<class Dimen, class Vb, class Fcb>
+template<class Dimen, class Vb, class Fcb, class Ct>
 std::istream &
-operator>>(std::istream & is, Triangulation_data_structure<Dimen, Vb, Fcb> & tr)
+operator>>(std::istream & is, Triangulation_data_structure<Dimen, Vb, Fcb, Ct> & tr)
   // reads :
   // - the dimensions (maximal and current)
   // - the number of finite vertices
@@ -1483,7 +1513,7 @@ operator>>(std::istream & is, Triangulation_data_structure<Dimen, Vb, Fcb> & tr)
   // of vertices, plus the non combinatorial information on each full_cell
   // - the neighbors of each full_cell by their index in the preceding list
 {
-    typedef Triangulation_data_structure<Dimen, Vb, Fcb> TDS;
+    typedef Triangulation_data_structure<Dimen, Vb, Fcb, Ct> TDS;
     typedef typename TDS::Vertex_handle         Vertex_handle;
 
     // read current dimension and number of vertices
@@ -1521,9 +1551,9 @@ operator>>(std::istream & is, Triangulation_data_structure<Dimen, Vb, Fcb> & tr)
     return tr.read_full_cells(is, vertices);
 }
 
-template<class Dimen, class Vb, class Fcb>
+template<class Dimen, class Vb, class Fcb, class Ct>
 std::ostream &
-operator<<(std::ostream & os, const Triangulation_data_structure<Dimen, Vb, Fcb> & tr)
+operator<<(std::ostream & os, const Triangulation_data_structure<Dimen, Vb, Fcb, Ct> & tr)
   // writes :
   // - the dimensions (maximal and current)
   // - the number of finite vertices
@@ -1533,7 +1563,7 @@ operator<<(std::ostream & os, const Triangulation_data_structure<Dimen, Vb, Fcb>
   // of vertices, plus the non combinatorial information on each full_cell
   // - the neighbors of each full_cell by their index in the preceding list
 {
-    typedef Triangulation_data_structure<Dimen, Vb, Fcb> TDS;
+    typedef Triangulation_data_structure<Dimen, Vb, Fcb, Ct> TDS;
     typedef typename TDS::Vertex_const_handle         Vertex_handle;
     typedef typename TDS::Vertex_const_iterator       Vertex_iterator;
 
@@ -0,0 +1,123 @@
+#include <CGAL/config.h>
+
+#include <CGAL/Epick_d.h>
+#include <CGAL/Delaunay_triangulation.h>
+#include <CGAL/Random.h>
+#include <vector>
+#include <cstdlib>
+#include <iostream>
+#include <cassert>
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+template<int D>
+struct Types
+{
+    typedef CGAL::Epick_d< CGAL::Dimension_tag<D> >                K;
+    typedef CGAL::Delaunay_triangulation<K>                        Sequential_DT;
+    typedef CGAL::Triangulation_data_structure<
+              CGAL::Dimension_tag<D>,
+              CGAL::Triangulation_vertex<K>,
+              CGAL::Triangulation_full_cell<K>,
+              CGAL::Parallel_tag>                                  Parallel_tds;
+    typedef CGAL::Delaunay_triangulation<K, Parallel_tds>          Parallel_DT;
+};
+
+// Without d+2 cospherical points, the triangulations are the same.
+template<typename Sequential_DT, typename Parallel_DT, typename Point>
+void test(const int d, const std::vector<Point> & points)
+{
+    std::cerr << "\nParallel Delaunay triangulation of " << points.size()
+              << " points in dimension " << d;
+    Sequential_DT sdt(d);
+    sdt.insert(points.begin(), points.end());
+
+    Parallel_DT pdt(d);
+    const std::size_t n = pdt.insert(points.begin(), points.end());
+    assert( n == pdt.number_of_vertices() );
+    assert( pdt.is_valid() );
+    assert( pdt.current_dimension() == sdt.current_dimension() );
+    assert( pdt.number_of_vertices() == sdt.number_of_vertices() );
+    assert( pdt.number_of_full_cells() == sdt.number_of_full_cells() );
+    assert( pdt.number_of_finite_full_cells() == sdt.number_of_finite_full_cells() );
+
+    // Insertion in a triangulation that is not empty
+    pdt.insert(points.begin(), points.begin() + points.size() / 10);
+    assert( pdt.is_valid() );
+    assert( pdt.number_of_vertices() == sdt.number_of_vertices() );
+
+    Parallel_DT copy(pdt);
+    assert( copy.is_valid() );
+    assert( copy.number_of_full_cells() == pdt.number_of_full_cells() );
+}
+
+template<int D>
+void test_random(const int N)
+{
+    typedef typename Types<D>::K::Point_d Point;
+    CGAL::Random rng(0);
+    std::vector<Point> points;
+    std::vector<double> coords(D);
+    for( int i = 0; i < N; ++i )
+    {
+        for( int j = 0; j < D; ++j )
+            coords[j] = rng.get_double(-1, 1);
+        points.push_back(Point(D, coords.begin(), coords.end()));
+    }
+    test<typename Types<D>::Sequential_DT, typename Types<D>::Parallel_DT>(D, points);
+
+    // Duplicated points
+    std::vector<Point> duplicates(points.begin(), points.begin() + N / 2);
+    duplicates.insert(duplicates.end(), points.begin(), points.begin() + N / 2);
+    test<typename Types<D>::Sequential_DT, typename Types<D>::Parallel_DT>(D, duplicates);
+}
+
+int main()
+{
+    test_random<2>(20000);
+    test_random<3>(20000);
+    test_random<4>(5000);
+
+    // Points in a hyperplane, which are inserted sequentially
+    typedef Types<3>::K::Point_d Point;
+    CGAL::Random rng(0);
+    std::vector<Point> points;
+    for( int i = 0; i < 1000; ++i )
+        points.push_back(Point(rng.get_double(), rng.get_double(), 0));
+    Types<3>::Parallel_DT pdt(3);
+    pdt.insert(points.begin(), points.end());
+    assert( pdt.current_dimension() == 2 );
+    assert( pdt.is_valid() );
+
+    // The dynamic dimension
+    typedef CGAL::Epick_d< CGAL::Dynamic_dimension_tag > DK;
+    typedef CGAL::Triangulation_data_structure<
+              CGAL::Dynamic_dimension_tag,
+              CGAL::Triangulation_vertex<DK>,
+              CGAL::Triangulation_full_cell<DK>,
+              CGAL::Parallel_tag>                                  Dynamic_parallel_tds;
+    typedef DK::Point_d DPoint;
+    std::vector<DPoint> dpoints;
+    std::vector<double> coords(5);
+    for( int i = 0; i < 2000; ++i )
+    {
+        for( int j = 0; j < 5; ++j )
+            coords[j] = rng.get_double(-1, 1);
+        dpoints.push_back(DPoint(5, coords.begin(), coords.end()));
+    }
+    test<CGAL::Delaunay_triangulation<DK>,
+         CGAL::Delaunay_triangulation<DK, Dynamic_parallel_tds> >(5, dpoints);
+
+    std::cerr << std::endl;
+    return EXIT_SUCCESS;
+}
+
+#else
+
+int main()
+{
+    std::cout << "TBB not found, the parallel insertion is not tested" << std::endl;
+    return EXIT_SUCCESS;
+}
+
+#endif // CGAL_LINKED_WITH_TBB
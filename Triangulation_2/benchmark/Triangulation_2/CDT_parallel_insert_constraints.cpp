@@ -0,0 +1,113 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Constrained_Delaunay_triangulation_2.h>
+#include <CGAL/Triangulation_data_structure_2.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <utility>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_2 Point;
+
+typedef CGAL::Constrained_Delaunay_triangulation_2<K> CDT;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Triangulation_data_structure_2<
+          CGAL::Triangulation_vertex_base_2<K>,
+          CGAL::Constrained_triangulation_face_base_2<K>,
+          CGAL::Parallel_tag> Parallel_tds;
+typedef CGAL::Constrained_Delaunay_triangulation_2<K, Parallel_tds> Parallel_CDT;
+#endif
+
+typedef std::vector<std::pair<std::size_t, std::size_t> > Constraints;
+
+// A street network on a jittered n x n grid, whose streets are polylines, plus
+// as many isolated points as there are points on the streets.
+void street_network(int n, std::vector<Point>& points, Constraints& constraints)
+{
+  CGAL::Random rnd(0);
+  std::vector<Point> nodes;
+  for(int i=0; i<n; ++i)
+    for(int j=0; j<n; ++j)
+      nodes.push_back(Point(i + rnd.get_double(-0.2, 0.2), j + rnd.get_double(-0.2, 0.2)));
+
+  points = nodes;
+  const int subdivisions = 4;
+  for(int i=0; i<n; ++i) {
+    for(int j=0; j<n; ++j) {
+      for(int d=0; d<2; ++d) {
+        if((d == 0 && i+1 == n) || (d == 1 && j+1 == n))
+          continue;
+        const std::size_t s = i*n + j, t = (d == 0) ? (i+1)*n + j : i*n + j+1;
+        std::size_t previous = s;
+        for(int k=1; k<subdivisions; ++k) {
+          const double l = double(k) / subdivisions;
+          points.push_back(Point((1-l) * nodes[s].x() + l * nodes[t].x() + rnd.get_double(-0.02, 0.02),
+                                 (1-l) * nodes[s].y() + l * nodes[t].y() + rnd.get_double(-0.02, 0.02)));
+          constraints.push_back(std::make_pair(previous, points.size() - 1));
+          previous = points.size() - 1;
+        }
+        constraints.push_back(std::make_pair(previous, t));
+      }
+    }
+  }
+  const std::size_t num_street_points = points.size();
+  for(std::size_t k=0; k<num_street_points; ++k)
+    points.push_back(Point(rnd.get_double(0, n-1), rnd.get_double(0, n-1)));
+}
+
+// Reads the segments of a file in the format of `CDT_insert_on_constraints`.
+void read_segments(std::istream& is, std::vector<Point>& points, Constraints& constraints)
+{
+  std::size_t nbs;
+  char s;
+  Point p1, p2;
+  is >> nbs;
+  while(nbs-- != 0 && (is >> s >> p1 >> p2)) {
+    constraints.push_back(std::make_pair(points.size(), points.size() + 1));
+    points.push_back(p1);
+    points.push_back(p2);
+  }
+}
+
+// usage example CDT_parallel_insert_constraints [norway.cin | grid_size]
+int main(int argc, char* argv[])
+{
+  std::vector<Point> points;
+  Constraints constraints;
+  if(argc > 1 && std::ifstream(argv[1])) {
+    std::ifstream is(argv[1]);
+    read_segments(is, points, constraints);
+  } else {
+    street_network(argc > 1 ? std::atoi(argv[1]) : 300, points, constraints);
+  }
+  std::cout << points.size() << " points and " << constraints.size() << " constraints\n";
+
+  CGAL::Real_timer timer;
+  {
+    timer.start();
+    CDT cdt;
+    cdt.insert_constraints(points.begin(), points.end(), constraints.begin(), constraints.end());
+    timer.stop();
+    std::cout << "Sequential: " << cdt.number_of_vertices() << " vertices "
+              << timer.time() << " sec" << std::endl;
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  {
+    timer.reset();
+    timer.start();
+    Parallel_CDT cdt;
+    cdt.insert_constraints(points.begin(), points.end(), constraints.begin(), constraints.end());
+    timer.stop();
+    std::cout << "Parallel:   " << cdt.number_of_vertices() << " vertices "
+              << timer.time() << " sec" << std::endl;
+  }
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -154,6 +154,8 @@ Vertex_handle push_back(const Point& p);
 /*!
 Inserts the points in the range `[first,last)`.
 Returns the number of inserted points.
+If the concurrency tag of `Tds` is `Parallel_tag` and the triangulation is empty,
+the points are inserted in parallel, and the type `Point` must provide the member functions `x()` and `y()`.
 \tparam PointIterator must be an `InputIterator` with the value type `Point`.
 */
 template < class PointIterator >
@@ -214,6 +216,15 @@ More precisely, all endpoints are inserted prior to the segments and according t
 Once endpoints have been inserted, the segments are inserted in the order of the input iterator,
 using the vertex handles of its endpoints.
 
+If the concurrency tag of `Tds` is `Parallel_tag` and the triangulation is empty,
+the points and then the constraints are inserted in parallel, and the type `Point` must provide
+the member functions `x()` and `y()`. Each thread locks the vertices of the faces
+intersected by its constraint. The constraints that intersect another constraint
+are inserted sequentially at the end, in the order of the input iterator. With
+`Exact_predicates_tag`, the constraints that intersect each other may then be inserted
+in another order than with the sequential insertion, and the intersection points that are
+created may differ.
+
 \return the number of inserted points.
 \tparam ConstraintIterator must be an `InputIterator` with the value type `std::pair<Point,Point>` or `Segment`.
 */
@@ -281,6 +281,10 @@ More precisely, all endpoints are inserted prior to the segments and according t
 Once endpoints have been inserted, the segments are inserted in the order of the input iterator,
 using the vertex handles of its endpoints.
 
+Unlike `Constrained_Delaunay_triangulation_2::insert_constraints()`, the constraints are
+inserted sequentially even if the concurrency tag of the data structure is `Parallel_tag`,
+as the constraint hierarchy is updated one constraint at a time.
+
 \return the number of inserted points.
 \tparam ConstraintIterator must be an `InputIterator` with the value type `std::pair<Point,Point>` or `Segment`.
 */
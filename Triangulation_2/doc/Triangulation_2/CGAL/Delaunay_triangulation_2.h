@@ -149,6 +149,8 @@ Returns the number of inserted points.
 Note that this function is not guaranteed to insert the points
 following the order of `PointInputIterator`, as `spatial_sort()`
 is used to improve efficiency.
+If the concurrency tag of `Tds` is `Parallel_tag`, the points are inserted in parallel,
+and the type `Point` must provide the member functions `x()` and `y()`.
 \tparam PointInputIterator must be an input iterator with the value type `Point`.
 */
 template < class PointInputIterator >
@@ -19,6 +19,18 @@
 #include <CGAL/triangulation_assertions.h>
 #include <CGAL/Constrained_triangulation_2.h>
 #include <CGAL/Triangulation_2/insert_constraints.h>
+#include <CGAL/Triangulation_2/internal/Parallel_insertion_2.h>
+
+#include <type_traits>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <CGAL/Spatial_sort_traits_adapter_2.h>
+# include <CGAL/property_map.h>
+# include <tbb/enumerable_thread_specific.h>
+# include <algorithm>
+# include <utility>
+# include <vector>
+#endif
 
 #ifndef CGAL_TRIANGULATION_2_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
 #include <CGAL/Spatial_sort_traits_adapter_2.h>
@@ -126,6 +138,9 @@ public:
   // Tag to distinguish periodic triangulations from others
   typedef Tag_false Periodic_tag;
 
+  // `Parallel_tag` when the points and the constraints of a range are inserted concurrently
+  typedef typename internal::Tds_2_concurrency_tag<Tds>::type Concurrency_tag;
+
 #ifndef CGAL_CFG_USING_BASE_MEMBER_BUG_2
   using Ctr::geom_traits;
   using Ctr::number_of_vertices;
@@ -331,7 +346,14 @@ public:
       size_type n = number_of_vertices();
 
       std::vector<Point> points (first, last);
-      spatial_sort (points.begin(), points.end(), geom_traits());
+      spatial_sort<Concurrency_tag> (points.begin(), points.end(), geom_traits());
+
+#ifdef CGAL_LINKED_WITH_TBB
+      // the concurrent insertion ignores the constrained edges
+      if(n == 0 && internal::insert_in_parallel(*this, points, Concurrency_tag()))
+        return number_of_vertices() - n;
+#endif // CGAL_LINKED_WITH_TBB
+
       Face_handle f;
       for (typename std::vector<Point>::const_iterator p = points.begin(), end = points.end();
               p != end; ++p)
@@ -430,6 +452,10 @@ public:
                                  IndicesIterator indices_beyond)
   {
     std::vector<Point> points(points_first, points_beyond);
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<Concurrency_tag, Parallel_tag>::value && number_of_vertices() == 0)
+      return insert_constraints_in_parallel(points, indices_first, indices_beyond, Concurrency_tag());
+#endif // CGAL_LINKED_WITH_TBB
     return internal::insert_constraints(*this,points, indices_first, indices_beyond);
   }
 
@@ -438,6 +464,21 @@ public:
   std::size_t insert_constraints(ConstraintIterator first,
                                  ConstraintIterator beyond)
   {
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<Concurrency_tag, Parallel_tag>::value && number_of_vertices() == 0)
+    {
+      std::vector<Point> points;
+      std::vector<std::pair<std::size_t, std::size_t> > segment_indices;
+      for(ConstraintIterator s_it=first; s_it!=beyond; ++s_it)
+      {
+        segment_indices.push_back(std::make_pair(points.size(), points.size() + 1));
+        points.push_back(Ctr::get_source(*s_it));
+        points.push_back(Ctr::get_target(*s_it));
+      }
+      return insert_constraints_in_parallel(points, segment_indices.begin(), segment_indices.end(),
+                                            Concurrency_tag());
+    }
+#endif // CGAL_LINKED_WITH_TBB
     return internal::insert_constraints(*this,first,beyond);
   }
 
@@ -666,6 +707,257 @@ public:
   return out;
  }
 
+#ifdef CGAL_LINKED_WITH_TBB
+private:
+  typedef internal::Parallel_insertion_2<CDt>                 Parallel_insertion;
+  typedef typename Parallel_insertion::Lock_data_structure   Lock_data_structure;
+  typedef std::pair<Vertex_handle, Vertex_handle>            Vertex_pair;
+
+  // Inserts the constraint [va,vb], up to the first vertex `vi` of the triangulation
+  // on ]va,vb], in a triangulation that is modified concurrently by other threads.
+  // The cells of `va`, `vi`, and of the vertices of the faces intersected by [va,vi]
+  // are locked, which is enough as only these faces are modified, see
+  // `propagating_flip_in_hole()`. Returns `false`, without modifying the triangulation,
+  // if a cell cannot be locked, and then `could_lock_zone` is `false`, or if [va,vb]
+  // intersects a constrained edge, which is left to the sequential insertion.
+  bool insert_constraint_in_locked_zone(Vertex_handle va,
+                                        Vertex_handle vb,
+                                        Vertex_handle& vi,
+                                        Lock_data_structure& locks,
+                                        bool& could_lock_zone)
+  {
+    could_lock_zone = false;
+    if(! Parallel_insertion::try_lock_vertex(*this, va, locks))
+      return false;
+
+    Face_handle fr;
+    int i;
+    if(this->includes_edge(va, vb, vi, fr, i)) {
+      if(! Parallel_insertion::try_lock_vertex(*this, vi, locks))
+        return false;
+      could_lock_zone = true;
+      if(std::is_same<Itag, No_constraint_intersection_tag>::value && fr->is_constrained(i))
+        return false;
+      this->mark_constraint(fr, i);
+      return true;
+    }
+
+    // Same traversal as `find_intersected_faces()`
+    const Point& pa = va->point();
+    const Point& pb = vb->point();
+    typename Ctr::Line_face_circulator current_face(va, this, pb);
+    int ind = current_face->index(va);
+    if(! Parallel_insertion::try_lock_face(*this, current_face, locks))
+      return false;
+    if(current_face->is_constrained(ind)) {
+      could_lock_zone = true;
+      return false;
+    }
+    Face_handle previous_face = current_face;
+    ++current_face;
+    ind = current_face->index(previous_face);
+    Vertex_handle current_vertex = current_face->vertex(ind);
+    for(;;) {
+      if(! Parallel_insertion::try_lock_vertex(*this, current_vertex, locks))
+        return false;
+      if(current_vertex == vb)
+        break;
+      const Orientation orient = this->orientation(pa, pb, current_vertex->point());
+      if(orient == COLLINEAR)
+        break;
+      if(current_face->is_constrained(orient == LEFT_TURN ? ccw(ind) : cw(ind))) {
+        could_lock_zone = true;
+        return false;
+      }
+      previous_face = current_face;
+      ++current_face;
+      ind = current_face->index(previous_face);
+      current_vertex = current_face->vertex(ind);
+    }
+    could_lock_zone = true;
+
+    List_faces intersected_faces;
+    List_edges conflict_boundary_ab, conflict_boundary_ba, new_edges;
+    this->find_intersected_faces(va, vb, intersected_faces,
+                                 conflict_boundary_ab, conflict_boundary_ba, vi);
+    Ctr::triangulate_hole(intersected_faces,
+                          conflict_boundary_ab, conflict_boundary_ba, new_edges);
+    propagating_flip_in_hole(new_edges);
+    return true;
+  }
+
+  // Makes the triangulation of the hole of a new constraint, whose faces are the faces
+  // of `new_edges`, Delaunay by flipping its edges, but not the edges of its boundary.
+  // The constrained Delaunay triangulation with the new constraint differs from the
+  // previous one only by the faces that intersect the constraint, so that the result
+  // is the same as with `propagating_flip()`.
+  void propagating_flip_in_hole(const List_edges& new_edges)
+  {
+    std::vector<Face_handle> hole;
+    for(const Edge& e : new_edges)
+      hole.push_back(e.first);
+    std::sort(hole.begin(), hole.end());
+
+    std::vector<Edge> edges(new_edges.begin(), new_edges.end());
+    while(! edges.empty()) {
+      Face_handle f = edges.back().first;
+      const int i = edges.back().second;
+      edges.pop_back();
+      Face_handle n = f->neighbor(i);
+      if(! std::binary_search(hole.begin(), hole.end(), n) || ! is_flipable(f, i))
+        continue;
+      const int j = mirror_index(f, i);
+      flip(f, i);
+      edges.push_back(Edge(f, i));
+      edges.push_back(Edge(f, cw(i)));
+      edges.push_back(Edge(n, j));
+      edges.push_back(Edge(n, cw(j)));
+    }
+  }
+
+  // Functor for the parallel insertion of a range of constraints. The constraints that
+  // intersect a constrained edge are stored, with their position, in `deferred`.
+  class Insert_constraint
+  {
+    CDt& m_cdt;
+    const std::vector<Vertex_pair>& m_constraints;
+    Lock_data_structure& m_locks;
+    tbb::enumerable_thread_specific<
+      std::vector<std::pair<std::size_t, Vertex_pair> > >& m_deferred;
+
+  public:
+    Insert_constraint(CDt& cdt,
+                      const std::vector<Vertex_pair>& constraints,
+                      Lock_data_structure& locks,
+                      tbb::enumerable_thread_specific<
+                        std::vector<std::pair<std::size_t, Vertex_pair> > >& deferred)
+      : m_cdt(cdt), m_constraints(constraints), m_locks(locks), m_deferred(deferred)
+    {}
+
+    void operator()(const tbb::blocked_range<std::size_t>& r) const
+    {
+      for(std::size_t i_constraint = r.begin() ; i_constraint != r.end() ; ++i_constraint)
+      {
+        Vertex_handle va = m_constraints[i_constraint].first;
+        const Vertex_handle vb = m_constraints[i_constraint].second;
+        while(va != vb)
+        {
+          Vertex_handle vi;
+          bool could_lock_zone = false;
+          const bool inserted =
+            m_cdt.insert_constraint_in_locked_zone(va, vb, vi, m_locks, could_lock_zone);
+          m_locks.unlock_all_points_locked_by_this_thread();
+          if(inserted) {
+            va = vi;
+          } else if(could_lock_zone) {
+            m_deferred.local().push_back(std::make_pair(i_constraint, Vertex_pair(va, vb)));
+            break;
+          }
+        }
+      }
+    }
+  };
+
+  // Same as `internal::insert_constraints()` in an empty triangulation. The points are
+  // inserted concurrently, and then the constraints, sorted along the spatial sort
+  // of their endpoints so that the zones locked by the threads are mostly disjoint.
+  // The constraints that intersect a constrained edge are inserted sequentially at the end,
+  // in the order of the input: with `Exact_predicates_tag`, the intersection points that
+  // are created depend on the order in which the intersecting constraints are inserted.
+  template <class IndicesIterator>
+  std::size_t insert_constraints_in_parallel(const std::vector<Point>& points,
+                                             IndicesIterator indices_first,
+                                             IndicesIterator indices_beyond,
+                                             Sequential_tag)
+  {
+    return internal::insert_constraints(*this, points, indices_first, indices_beyond);
+  }
+
+  template <class IndicesIterator>
+  std::size_t insert_constraints_in_parallel(const std::vector<Point>& points,
+                                             IndicesIterator indices_first,
+                                             IndicesIterator indices_beyond,
+                                             Parallel_tag)
+  {
+    CGAL_triangulation_precondition(number_of_vertices() == 0);
+    if(indices_first == indices_beyond)
+      return 0;
+
+    std::vector<std::size_t> vertex_indices(points.size());
+    for(std::size_t k=0; k<points.size(); ++k)
+      vertex_indices[k] = k;
+    Spatial_sort_traits_adapter_2<Geom_traits,
+                                  typename Pointer_property_map<Point>::const_type>
+      sort_traits(make_property_map(points), geom_traits());
+    spatial_sort<Parallel_tag>(vertex_indices.begin(), vertex_indices.end(), sort_traits);
+
+    std::vector<Point> sorted_points;
+    sorted_points.reserve(points.size());
+    for(std::size_t k : vertex_indices)
+      sorted_points.push_back(points[k]);
+    std::vector<Vertex_handle> sorted_vertices;
+    Parallel_insertion::insert(*this, sorted_points, &sorted_vertices);
+
+    std::vector<Vertex_handle> vertices(points.size());
+    std::vector<std::size_t> ranks(points.size());
+    for(std::size_t k=0; k<points.size(); ++k) {
+      vertices[vertex_indices[k]] = sorted_vertices[k];
+      ranks[vertex_indices[k]] = k;
+    }
+
+    std::vector<Vertex_pair> input_constraints;
+    std::vector<std::size_t> constraint_ranks;
+    for(IndicesIterator it_cst=indices_first; it_cst!=indices_beyond; ++it_cst)
+    {
+      Vertex_handle v1 = vertices[it_cst->first];
+      Vertex_handle v2 = vertices[it_cst->second];
+      if(v1 != v2) {
+        input_constraints.push_back(Vertex_pair(v1, v2));
+        constraint_ranks.push_back((std::min)(ranks[it_cst->first], ranks[it_cst->second]));
+      }
+    }
+
+    if(dimension() < 2) {
+      for(const Vertex_pair& c : input_constraints)
+        insert_constraint(c.first, c.second);
+      return number_of_vertices();
+    }
+
+    // `order[k]` is the position in the input of the k-th constraint along the spatial sort
+    std::vector<std::size_t> order(input_constraints.size());
+    for(std::size_t k=0; k<order.size(); ++k)
+      order[k] = k;
+    std::stable_sort(order.begin(), order.end(),
+                     [&constraint_ranks](std::size_t c1, std::size_t c2)
+                     { return constraint_ranks[c1] < constraint_ranks[c2]; });
+    std::vector<Vertex_pair> constraints;
+    constraints.reserve(order.size());
+    for(std::size_t k : order)
+      constraints.push_back(input_constraints[k]);
+
+    tbb::enumerable_thread_specific<
+      std::vector<std::pair<std::size_t, Vertex_pair> > > deferred_tls;
+    {
+      Lock_data_structure locks(Parallel_insertion::bbox(points),
+                                Parallel_insertion::num_grid_cells_per_axis(points.size()));
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, constraints.size()),
+                        Insert_constraint(*this, constraints, locks, deferred_tls));
+    }
+
+    std::vector<std::pair<std::size_t, Vertex_pair> > deferred;
+    for(const std::vector<std::pair<std::size_t, Vertex_pair> >& d : deferred_tls)
+      for(const std::pair<std::size_t, Vertex_pair>& c : d)
+        deferred.push_back(std::make_pair(order[c.first], c.second));
+    std::sort(deferred.begin(), deferred.end(),
+              [](const std::pair<std::size_t, Vertex_pair>& c1,
+                 const std::pair<std::size_t, Vertex_pair>& c2)
+              { return c1.first < c2.first; });
+    for(const std::pair<std::size_t, Vertex_pair>& c : deferred)
+      insert_constraint(c.second.first, c.second.second);
+
+    return number_of_vertices();
+  }
+#endif // CGAL_LINKED_WITH_TBB
 };
 
 
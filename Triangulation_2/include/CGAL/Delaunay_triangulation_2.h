@@ -29,6 +29,9 @@
 
 #endif //CGAL_TRIANGULATION_2_DONT_INSERT_RANGE_OF_POINTS_WITH_INFO
 
+#include <CGAL/tags.h>
+#include <CGAL/Triangulation_2/internal/Parallel_insertion_2.h>
+
 namespace CGAL {
 
 template < class Gt,
@@ -72,6 +75,10 @@ public:
   // Tag to distinguish periodic triangulations from others
   typedef Tag_false                                     Periodic_tag;
 
+  // `Parallel_tag` when the points of a range are inserted concurrently
+  typedef typename internal::Tds_2_concurrency_tag<Tds>::type
+                                                        Concurrency_tag;
+
 #ifndef CGAL_CFG_USING_BASE_MEMBER_BUG_2
   using Triangulation::side_of_oriented_circle;
   using Triangulation::circumcenter;
@@ -315,7 +322,13 @@ public:
     size_type n = this->number_of_vertices();
 
     std::vector<Point> points (first, last);
-    spatial_sort (points.begin(), points.end(), geom_traits());
+    spatial_sort<Concurrency_tag> (points.begin(), points.end(), geom_traits());
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if(internal::insert_in_parallel(*this, points, Concurrency_tag()))
+      return this->number_of_vertices() - n;
+#endif // CGAL_LINKED_WITH_TBB
+
     Face_handle f;
     for (typename std::vector<Point>::const_iterator p = points.begin(), end = points.end();
          p != end; ++p)
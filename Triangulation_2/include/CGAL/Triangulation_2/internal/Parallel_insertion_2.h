@@ -0,0 +1,287 @@
+// Copyright (c) 2026  agent <agent@local>.
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+// Author(s)     : agent <agent@local>
+
+#ifndef CGAL_TRIANGULATION_2_INTERNAL_PARALLEL_INSERTION_2_H
+#define CGAL_TRIANGULATION_2_INTERNAL_PARALLEL_INSERTION_2_H
+
+#include <CGAL/license/Triangulation_2.h>
+
+#include <CGAL/tags.h>
+
+#include <boost/mpl/has_xxx.hpp>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <CGAL/Bbox_2.h>
+# include <CGAL/Spatial_lock_grid_2.h>
+# include <tbb/blocked_range.h>
+# include <tbb/parallel_for.h>
+# include <algorithm>
+# include <cmath>
+# include <vector>
+#endif
+
+namespace CGAL {
+
+namespace internal {
+
+// The concurrency tag of a model of `TriangulationDataStructure_2`,
+// which is `Sequential_tag` when it does not define one.
+BOOST_MPL_HAS_XXX_TRAIT_NAMED_DEF(Has_concurrency_tag_2, Concurrency_tag, false)
+
+template <class Tds, bool = Has_concurrency_tag_2<Tds>::value>
+struct Tds_2_concurrency_tag
+{
+  typedef Sequential_tag type;
+};
+
+template <class Tds>
+struct Tds_2_concurrency_tag<Tds, true>
+{
+  typedef typename Tds::Concurrency_tag type;
+};
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+// The concurrent insertion of points in a triangulation `Tr` of dimension 2 without
+// constrained edges, which is a `Delaunay_triangulation_2` or a
+// `Constrained_Delaunay_triangulation_2` whose data structure has the `Parallel_tag`.
+//
+// The vertices are locked with a `Spatial_lock_grid_2`. The vertices of a face are only
+// modified once its three vertices are locked, and the neighbor and the constrained status
+// of an edge once its two vertices are locked. Hence, a face can be read once one of its
+// vertices is locked, and the neighbor across an edge once its two vertices are locked.
+template <class Tr>
+class Parallel_insertion_2
+{
+public:
+  typedef typename Tr::Point                            Point;
+  typedef typename Tr::Vertex_handle                    Vertex_handle;
+  typedef typename Tr::Face_handle                      Face_handle;
+  typedef typename Tr::Edge                             Edge;
+
+  typedef Spatial_lock_grid_2<Tag_priority_blocking>    Lock_data_structure;
+
+  // The infinite vertex has no point, and locks the first cell of the grid.
+  static bool try_lock_vertex(const Tr& tr, Vertex_handle v, Lock_data_structure& locks)
+  {
+    return tr.is_infinite(v) ? locks.try_lock(0) : locks.try_lock(v->point());
+  }
+
+  static bool try_lock_face(const Tr& tr, Face_handle f, Lock_data_structure& locks)
+  {
+    return try_lock_vertex(tr, f->vertex(0), locks)
+        && try_lock_vertex(tr, f->vertex(1), locks)
+        && try_lock_vertex(tr, f->vertex(2), locks);
+  }
+
+  // With projection traits, `x()` and `y()` are not necessarily the coordinates
+  // in the projection plane, which only makes the locking less efficient.
+  static Bbox_2 bbox(const std::vector<Point>& points)
+  {
+    Bbox_2 bbox;
+    for(const Point& p : points) {
+      const double x = CGAL::to_double(p.x()), y = CGAL::to_double(p.y());
+      bbox += Bbox_2(x, y, x, y);
+    }
+    return bbox;
+  }
+
+  // about 16 points per cell of the grid
+  static int num_grid_cells_per_axis(std::size_t num_points)
+  {
+    return (std::max)(8, (std::min)(1024, static_cast<int>(std::sqrt(num_points / 16.))));
+  }
+
+  // Inserts `p` with the Bowyer-Watson algorithm, that is, by starring the boundary
+  // of its conflict zone, in a triangulation of dimension 2 that is modified concurrently
+  // by other threads. The cells of the vertices of all the faces of the walk from `hint`
+  // to `p`, of the conflict zone, and of its boundary are locked, so that, when a face
+  // is entered through an edge, only its third vertex has to be locked. If a cell cannot
+  // be locked, the triangulation is not modified, and `could_lock_zone` is set to `false`.
+  static Vertex_handle insert_in_locked_zone(Tr& tr,
+                                             const Point& p,
+                                             Vertex_handle hint,
+                                             Lock_data_structure& locks,
+                                             std::vector<Face_handle>& faces,
+                                             std::vector<Edge>& edges,
+                                             std::vector<Edge>& stack,
+                                             bool& could_lock_zone)
+  {
+    CGAL_triangulation_precondition(tr.dimension() == 2);
+    could_lock_zone = false;
+
+    if(! try_lock_vertex(tr, hint, locks))
+      return Vertex_handle();
+    Face_handle f = hint->face();
+    if(! try_lock_face(tr, f, locks))
+      return Vertex_handle();
+    if(tr.is_infinite(f)) {
+      f = f->neighbor(f->index(tr.infinite_vertex()));
+      if(! try_lock_face(tr, f, locks))
+        return Vertex_handle();
+    }
+
+    // Walk to a face that contains `p`, or to an infinite face when `p` is outside
+    // the convex hull. The visibility walk terminates in a Delaunay triangulation.
+    int i = 0;
+    while(! tr.is_infinite(f)) {
+      for(i=0; i<3; ++i)
+        if(tr.orientation(f->vertex(Tr::ccw(i))->point(),
+                          f->vertex(Tr::cw(i))->point(), p) == RIGHT_TURN)
+          break;
+      if(i == 3)
+        break;
+      // the two vertices of the common edge are already locked
+      Face_handle fn = f->neighbor(i);
+      if(! try_lock_vertex(tr, fn->vertex(fn->index(f)), locks))
+        return Vertex_handle();
+      f = fn;
+    }
+    if(! tr.is_infinite(f)) {
+      for(i=0; i<3; ++i)
+        if(tr.xy_equal(p, f->vertex(i)->point())) {
+          could_lock_zone = true;
+          return f->vertex(i);
+        }
+    }
+    CGAL_triangulation_assertion(tr.test_conflict(p, f));
+
+    // Same traversal as `propagate_conflicts()`, so that the boundary edges are ccw oriented.
+    faces.clear();
+    edges.clear();
+    stack.clear();
+    faces.push_back(f);
+    stack.push_back(Edge(f, 2));
+    stack.push_back(Edge(f, 1));
+    stack.push_back(Edge(f, 0));
+    while(! stack.empty()) {
+      const Edge e = stack.back();
+      stack.pop_back();
+      Face_handle fn = e.first->neighbor(e.second);
+      const int j = fn->index(e.first);
+      if(! try_lock_vertex(tr, fn->vertex(j), locks))
+        return Vertex_handle();
+      if(tr.test_conflict(p, fn)) {
+        faces.push_back(fn);
+        stack.push_back(Edge(fn, Tr::cw(j)));
+        stack.push_back(Edge(fn, Tr::ccw(j)));
+      } else {
+        edges.push_back(Edge(fn, j));
+      }
+    }
+
+    could_lock_zone = true;
+    Vertex_handle v = tr.tds().create_vertex();
+    v->set_point(p);
+    tr.tds().star_hole(v, edges.begin(), edges.end(), faces.begin(), faces.end());
+    return v;
+  }
+
+  // Functor for the parallel insertion of a range of points. The walk to the first point
+  // of a range starts from the sample vertex that precedes it in the spatial sort.
+  class Insert_point
+  {
+    Tr& m_tr;
+    const std::vector<Point>& m_points;
+    const std::vector<Vertex_handle>& m_sample;
+    Lock_data_structure& m_locks;
+    std::vector<Vertex_handle>* m_vertices;
+
+  public:
+    Insert_point(Tr& tr,
+                 const std::vector<Point>& points,
+                 const std::vector<Vertex_handle>& sample,
+                 Lock_data_structure& locks,
+                 std::vector<Vertex_handle>* vertices)
+      : m_tr(tr), m_points(points), m_sample(sample), m_locks(locks), m_vertices(vertices)
+    {}
+
+    void operator()(const tbb::blocked_range<std::size_t>& r) const
+    {
+      Vertex_handle hint = m_sample[r.begin() * m_sample.size() / m_points.size()];
+      std::vector<Face_handle> faces;
+      std::vector<Edge> edges, stack;
+      for(std::size_t i_point = r.begin() ; i_point != r.end() ; ++i_point)
+      {
+        bool could_lock_zone = false;
+        while(! could_lock_zone)
+        {
+          Vertex_handle v = insert_in_locked_zone(m_tr, m_points[i_point], hint, m_locks,
+                                                  faces, edges, stack, could_lock_zone);
+          m_locks.unlock_all_points_locked_by_this_thread();
+          if(could_lock_zone)
+            hint = v;
+        }
+        if(m_vertices != nullptr)
+          (*m_vertices)[i_point] = hint;
+      }
+    }
+  };
+
+  // Inserts the spatially sorted `points` in `tr`. If `vertices` is not null, it is
+  // resized and its k-th element is set to the vertex of `points[k]`.
+  // A sample of the points, spread along the sort, is first inserted sequentially,
+  // so that the convex hull is almost complete before the concurrent insertion of
+  // all the points, in which the sample points are duplicates.
+  static void insert(Tr& tr,
+                     const std::vector<Point>& points,
+                     std::vector<Vertex_handle>* vertices = nullptr)
+  {
+    const std::size_t num_points = points.size();
+    const std::size_t sample_size = (std::min)(num_points, std::size_t(100));
+    if(vertices != nullptr)
+      vertices->resize(num_points);
+
+    std::vector<Vertex_handle> sample;
+    Face_handle f;
+    for(std::size_t k=0; k<sample_size; ++k) {
+      sample.push_back(tr.insert(points[k * num_points / sample_size], f));
+      f = sample.back()->face();
+    }
+    std::size_t i = 0;
+    while(tr.dimension() < 2 && i < num_points) {
+      Vertex_handle v = tr.insert(points[i], f);
+      if(vertices != nullptr)
+        (*vertices)[i] = v;
+      f = v->face();
+      ++i;
+    }
+    if(i == num_points)
+      return;
+
+    Lock_data_structure locks(bbox(points), num_grid_cells_per_axis(num_points));
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(i, num_points),
+                      Insert_point(tr, points, sample, locks, vertices));
+  }
+};
+
+// Inserts the spatially sorted `points` in `tr` in parallel, when the triangulation data
+// structure has the `Parallel_tag`, and returns `false` otherwise.
+template <class Tr>
+bool insert_in_parallel(Tr&, const std::vector<typename Tr::Point>&, Sequential_tag)
+{
+  return false;
+}
+
+template <class Tr>
+bool insert_in_parallel(Tr& tr, const std::vector<typename Tr::Point>& points, Parallel_tag)
+{
+  Parallel_insertion_2<Tr>::insert(tr, points);
+  return true;
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+} // namespace internal
+
+} // namespace CGAL
+
+#endif // CGAL_TRIANGULATION_2_INTERNAL_PARALLEL_INSERTION_2_H
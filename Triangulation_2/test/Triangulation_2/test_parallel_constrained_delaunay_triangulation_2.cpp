@@ -0,0 +1,192 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Constrained_Delaunay_triangulation_2.h>
+#include <CGAL/Constrained_triangulation_plus_2.h>
+#include <CGAL/Triangulation_data_structure_2.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cassert>
+#include <iostream>
+#include <set>
+#include <utility>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_2                                          Point;
+typedef K::Segment_2                                        Segment;
+typedef CGAL::Exact_predicates_tag                          Itag;
+
+typedef CGAL::Constrained_Delaunay_triangulation_2<K, CGAL::Default, Itag>
+                                                            Sequential_CDT;
+
+typedef CGAL::Triangulation_data_structure_2<
+          CGAL::Triangulation_vertex_base_2<K>,
+          CGAL::Constrained_triangulation_face_base_2<K>,
+          CGAL::Parallel_tag>                               Parallel_tds;
+typedef CGAL::Constrained_Delaunay_triangulation_2<K, Parallel_tds, Itag>
+                                                            Parallel_CDT;
+typedef CGAL::Constrained_triangulation_plus_2<Parallel_CDT> Parallel_CDT_plus;
+
+static_assert(std::is_same<Parallel_CDT::Concurrency_tag, CGAL::Parallel_tag>::value, "");
+static_assert(std::is_same<Sequential_CDT::Concurrency_tag, CGAL::Sequential_tag>::value, "");
+
+typedef std::set<std::pair<Point, Point> > Edges;
+
+template <class CDT>
+void edges(const CDT& cdt, Edges& all, Edges& constrained)
+{
+  for(typename CDT::Finite_edges_iterator eit = cdt.finite_edges_begin(); eit != cdt.finite_edges_end(); ++eit)
+  {
+    Point p = eit->first->vertex(cdt.ccw(eit->second))->point();
+    Point q = eit->first->vertex(cdt.cw(eit->second))->point();
+    if(q < p)
+      std::swap(p, q);
+    all.insert(std::make_pair(p, q));
+    if(cdt.is_constrained(*eit))
+      constrained.insert(std::make_pair(p, q));
+  }
+}
+
+// Without four cocircular points and intersecting constraints, the triangulations are the same.
+void test(const std::vector<Point>& points,
+          const std::vector<std::pair<std::size_t, std::size_t> >& constraints,
+          bool unique)
+{
+  Sequential_CDT scdt;
+  scdt.insert_constraints(points.begin(), points.end(), constraints.begin(), constraints.end());
+
+  Parallel_CDT pcdt;
+  const std::size_t n = pcdt.insert_constraints(points.begin(), points.end(),
+                                                constraints.begin(), constraints.end());
+  assert(n == pcdt.number_of_vertices());
+  assert(pcdt.is_valid());
+  assert(pcdt.number_of_vertices() == scdt.number_of_vertices());
+  assert(pcdt.number_of_faces() == scdt.number_of_faces());
+
+  Edges s_all, s_constrained, p_all, p_constrained;
+  edges(scdt, s_all, s_constrained);
+  edges(pcdt, p_all, p_constrained);
+  assert(p_constrained == s_constrained);
+  if(unique)
+    assert(p_all == s_all);
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  std::vector<Point> points;
+  std::vector<std::pair<std::size_t, std::size_t> > constraints;
+
+  // Polylines on 100 rows that cross many faces, and random points in between
+  for(int row=0; row<100; ++row) {
+    std::vector<double> xs;
+    for(int i=0; i<200; ++i)
+      xs.push_back(rnd.get_double(0, 1));
+    std::sort(xs.begin(), xs.end());
+    for(int i=0; i<200; ++i) {
+      if(i > 0)
+        constraints.push_back(std::make_pair(points.size() - 1, points.size()));
+      points.push_back(Point(xs[i], 0.01 * row + rnd.get_double(0, 0.001)));
+    }
+  }
+  for(int i=0; i<50000; ++i)
+    points.push_back(Point(rnd.get_double(0, 1), rnd.get_double(0, 1)));
+  test(points, constraints, true);
+
+  // The same on a grid, with duplicated points and points on the constraints
+  points.clear();
+  constraints.clear();
+  for(int row=0; row<50; ++row) {
+    for(int i=0; i<20; ++i) {
+      if(i > 0)
+        constraints.push_back(std::make_pair(points.size() - 1, points.size()));
+      points.push_back(Point(50 * i, 20 * row));
+    }
+  }
+  for(int i=0; i<20000; ++i)
+    points.push_back(Point(rnd.get_int(0, 1000), rnd.get_int(0, 1000)));
+  test(points, constraints, false);
+
+  // Intersecting constraints, which are inserted sequentially
+  std::vector<Segment> segments;
+  for(int i=0; i<2000; ++i) {
+    Point p(rnd.get_double(0, 1), rnd.get_double(0, 1));
+    segments.push_back(Segment(p, p + K::Vector_2(rnd.get_double(-0.05, 0.05),
+                                                  rnd.get_double(-0.05, 0.05))));
+  }
+  Parallel_CDT pcdt(segments.begin(), segments.end());
+  assert(pcdt.is_valid());
+  Sequential_CDT scdt(segments.begin(), segments.end());
+  assert(pcdt.number_of_vertices() > 2 * segments.size());
+  assert(scdt.number_of_vertices() > 2 * segments.size());
+
+  // Chords of a circle that intersect each other: one of them is inserted in parallel, and
+  // the others are then inserted in the order of the input, which determines the intersection points
+  points.clear();
+  constraints.clear();
+  for(int i=0; i<20; ++i) {
+    const double theta = rnd.get_double(0, CGAL_PI);
+    const double phi = theta + CGAL_PI + rnd.get_double(-0.1, 0.1);
+    constraints.push_back(std::make_pair(points.size(), points.size() + 1));
+    points.push_back(Point(std::cos(theta), std::sin(theta)));
+    points.push_back(Point(std::cos(phi), std::sin(phi)));
+  }
+  Parallel_CDT chords;
+  chords.insert_constraints(points.begin(), points.end(), constraints.begin(), constraints.end());
+  assert(chords.is_valid());
+  std::set<Point> chord_points;
+  for(Parallel_CDT::Finite_vertices_iterator vit = chords.finite_vertices_begin();
+      vit != chords.finite_vertices_end(); ++vit)
+    chord_points.insert(vit->point());
+  bool same_as_sequential = false;
+  for(std::size_t first=0; first<constraints.size() && !same_as_sequential; ++first)
+  {
+    std::vector<std::pair<std::size_t, std::size_t> > ordered(1, constraints[first]);
+    for(std::size_t i=0; i<constraints.size(); ++i)
+      if(i != first)
+        ordered.push_back(constraints[i]);
+    Sequential_CDT reference;
+    reference.insert_constraints(points.begin(), points.end(), ordered.begin(), ordered.end());
+    std::set<Point> reference_points;
+    for(Sequential_CDT::Finite_vertices_iterator vit = reference.finite_vertices_begin();
+        vit != reference.finite_vertices_end(); ++vit)
+      reference_points.insert(vit->point());
+    same_as_sequential = (reference_points == chord_points);
+  }
+  assert(same_as_sequential);
+
+  // Insertion in a triangulation that is not empty, which is sequential
+  pcdt.insert_constraints(segments.begin(), segments.begin() + 10);
+  assert(pcdt.is_valid());
+
+  // The constraints of Constrained_triangulation_plus_2 are inserted sequentially
+  Parallel_CDT_plus cdt_plus;
+  cdt_plus.insert_constraints(segments.begin(), segments.end());
+  assert(cdt_plus.is_valid());
+  assert(cdt_plus.number_of_constraints() == segments.size());
+  assert(cdt_plus.number_of_vertices() == scdt.number_of_vertices());
+
+  // Collinear points
+  points.clear();
+  constraints.clear();
+  for(int i=0; i<100; ++i)
+    points.push_back(Point(i, 2*i));
+  constraints.push_back(std::make_pair(0, 99));
+  test(points, constraints, true);
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
+
+#else
+
+int main()
+{
+  std::cout << "TBB not found, the parallel insertion is not tested" << std::endl;
+  return EXIT_SUCCESS;
+}
+
+#endif // CGAL_LINKED_WITH_TBB
@@ -0,0 +1,133 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Delaunay_triangulation_2.h>
+#include <CGAL/Triangulation_data_structure_2.h>
+#include <CGAL/point_generators_2.h>
+#include <CGAL/Random.h>
+
+#include <CGAL/_test_traits.h>
+
+#include <cassert>
+#include <iostream>
+#include <set>
+#include <utility>
+#include <vector>
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::Point_2                                          Point;
+
+typedef CGAL::Delaunay_triangulation_2<K>                   Sequential_DT;
+
+typedef CGAL::Triangulation_data_structure_2<
+          CGAL::Triangulation_vertex_base_2<K>,
+          CGAL::Triangulation_face_base_2<K>,
+          CGAL::Parallel_tag>                               Parallel_tds;
+typedef CGAL::Delaunay_triangulation_2<K, Parallel_tds>     Parallel_DT;
+
+static_assert(std::is_same<Parallel_DT::Concurrency_tag, CGAL::Parallel_tag>::value, "");
+static_assert(std::is_same<Sequential_DT::Concurrency_tag, CGAL::Sequential_tag>::value, "");
+
+// The points of these traits have no x() and y(), which the parallel insertion needs:
+// it must not be instantiated for a sequential data structure.
+typedef CGAL::Delaunay_triangulation_2<CGAL::_Triangulation_test_traits> Test_traits_DT;
+
+template <class DT>
+std::set<std::pair<Point, Point> > finite_edges(const DT& dt)
+{
+  std::set<std::pair<Point, Point> > edges;
+  for(typename DT::Finite_edges_iterator eit = dt.finite_edges_begin(); eit != dt.finite_edges_end(); ++eit)
+  {
+    Point p = eit->first->vertex(dt.ccw(eit->second))->point();
+    Point q = eit->first->vertex(dt.cw(eit->second))->point();
+    if(q < p)
+      std::swap(p, q);
+    edges.insert(std::make_pair(p, q));
+  }
+  return edges;
+}
+
+// Without four cocircular points, the triangulations are the same.
+void test(const std::vector<Point>& points, bool unique)
+{
+  Sequential_DT sdt(points.begin(), points.end());
+
+  Parallel_DT pdt;
+  const std::ptrdiff_t n = pdt.insert(points.begin(), points.end());
+  assert(n == std::ptrdiff_t(pdt.number_of_vertices()));
+  assert(pdt.is_valid());
+  assert(pdt.number_of_vertices() == sdt.number_of_vertices());
+  assert(pdt.number_of_faces() == sdt.number_of_faces());
+  if(unique)
+    assert(finite_edges(pdt) == finite_edges(sdt));
+
+  // insertion in a triangulation that is not empty
+  Parallel_DT pdt2;
+  pdt2.insert(points.begin(), points.begin() + points.size() / 2);
+  pdt2.insert(points.begin() + points.size() / 2, points.end());
+  assert(pdt2.is_valid());
+  assert(pdt2.number_of_vertices() == sdt.number_of_vertices());
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+  std::vector<Point> points;
+
+  // random points in a disc, then in a square
+  CGAL::Random_points_in_disc_2<Point> in_disc(1., rnd);
+  for(int i=0; i<100000; ++i)
+    points.push_back(*in_disc++);
+  test(points, true);
+
+  points.clear();
+  CGAL::Random_points_in_square_2<Point> in_square(1., rnd);
+  for(int i=0; i<100000; ++i)
+    points.push_back(*in_square++);
+  test(points, true);
+
+  // points on a grid, with duplicates
+  points.clear();
+  for(int i=0; i<50000; ++i)
+    points.push_back(Point(rnd.get_int(0, 200), rnd.get_int(0, 200)));
+  test(points, false);
+
+  // collinear points first, then points on both sides of their line
+  points.clear();
+  for(int i=0; i<1000; ++i)
+    points.push_back(Point(i, i));
+  for(int i=0; i<10000; ++i)
+    points.push_back(Point(rnd.get_double(0, 1000), rnd.get_double(0, 1000)));
+  test(points, false);
+
+  // collinear points only, and a few points
+  points.clear();
+  for(int i=0; i<1000; ++i)
+    points.push_back(Point(i, 2*i));
+  test(points, false);
+  points.resize(2);
+  test(points, true);
+  points.clear();
+  test(points, true);
+
+  std::vector<Test_traits_DT::Point> test_points;
+  for(int i=0; i<100; ++i)
+    test_points.push_back(Test_traits_DT::Point(rnd.get_double(0, 1), rnd.get_double(0, 1)));
+  Test_traits_DT test_traits_dt;
+  test_traits_dt.insert(test_points.begin(), test_points.end());
+  assert(test_traits_dt.is_valid());
+  assert(test_traits_dt.number_of_vertices() == test_points.size());
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
+
+#else
+
+int main()
+{
+  std::cout << "TBB not found, the parallel insertion is not tested" << std::endl;
+  return EXIT_SUCCESS;
+}
+
+#endif // CGAL_LINKED_WITH_TBB